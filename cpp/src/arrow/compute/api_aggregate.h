@@ -331,6 +331,13 @@ class ARROW_EXPORT Grouper {
   /// be as wide as necessary.
   virtual Result<Datum> Consume(const ExecBatch& batch) = 0;
 
+  /// Find the group ids of a batch of keys without adding new groups. The result is a
+  /// uint32 array which is null wherever the key has not been consumed before.
+  ///
+  /// Lookup does not modify the Grouper, so it may be called concurrently from several
+  /// threads as long as no call to Consume is in progress.
+  virtual Result<Datum> Lookup(const ExecBatch& batch) = 0;
+
   /// Get current unique keys. May be called multiple times.
   virtual Result<ExecBatch> GetUniques() = 0;
 
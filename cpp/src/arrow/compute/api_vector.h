@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
@@ -108,6 +111,44 @@ struct ARROW_EXPORT SortOptions : public FunctionOptions {
   std::vector<SortKey> sort_keys;
 };
 
+/// \brief Options for SelectKUnstable
+struct ARROW_EXPORT SelectKOptions : public FunctionOptions {
+  explicit SelectKOptions(int64_t k = -1, std::vector<SortKey> sort_keys = {})
+      : k(k), sort_keys(std::move(sort_keys)) {}
+
+  static SelectKOptions Defaults() { return SelectKOptions{}; }
+
+  /// Select the k largest values of the given columns
+  static SelectKOptions TopKDefault(int64_t k, std::vector<std::string> key_names = {}) {
+    return WithOrder(k, std::move(key_names), SortOrder::Descending);
+  }
+
+  /// Select the k smallest values of the given columns
+  static SelectKOptions BottomKDefault(int64_t k,
+                                       std::vector<std::string> key_names = {}) {
+    return WithOrder(k, std::move(key_names), SortOrder::Ascending);
+  }
+
+  /// The number of rows to select.
+  int64_t k;
+  /// The sort keys defining which rows come first.  For arrays and chunked
+  /// arrays, only the order of the first key is used (ascending if none).
+  std::vector<SortKey> sort_keys;
+
+ private:
+  static SelectKOptions WithOrder(int64_t k, std::vector<std::string> key_names,
+                                  SortOrder order) {
+    std::vector<SortKey> sort_keys;
+    for (auto& name : key_names) {
+      sort_keys.emplace_back(std::move(name), order);
+    }
+    if (sort_keys.empty()) {
+      sort_keys.emplace_back("not-used", order);
+    }
+    return SelectKOptions(k, std::move(sort_keys));
+  }
+};
+
 /// \brief Partitioning options for NthToIndices
 struct ARROW_EXPORT PartitionNthOptions : public FunctionOptions {
   explicit PartitionNthOptions(int64_t pivot) : pivot(pivot) {}
@@ -269,6 +310,81 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
                                            ExecContext* ctx = NULLPTR);
 
+/// \brief Return the indices of the first k rows of an input in the
+/// specified order, without sorting the whole input.
+///
+/// Input is one of array, chunked array, record batch or table.  The
+/// output holds min(k, length) indices, in sorted order; rows comparing
+/// equal may be selected and ordered arbitrarily.  Nulls and NaNs are
+/// ordered as in SortIndices.
+///
+/// For example given input (array) = [3, null, 7, 1, 5] and
+/// options = SelectKOptions::TopKDefault(2), the output will be [2, 4].
+///
+/// \param[in] datum array, chunked array, record batch or table to select from
+/// \param[in] options the number of rows and the sort keys
+/// \param[in] ctx the function execution context, optional
+/// \return indices of the selected rows
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx = NULLPTR);
+
+/// \brief Options for ExternalSort
+struct ARROW_EXPORT ExternalSortOptions {
+  explicit ExternalSortOptions(SortOptions sort_options = SortOptions::Defaults(),
+                               int64_t memory_limit = kDefaultMemoryLimit,
+                               int64_t batch_size = kDefaultBatchSize,
+                               int max_merge_fan_in = kDefaultMaxMergeFanIn)
+      : sort_options(std::move(sort_options)),
+        memory_limit(memory_limit),
+        batch_size(batch_size),
+        max_merge_fan_in(max_merge_fan_in) {}
+
+  static ExternalSortOptions Defaults() { return ExternalSortOptions{}; }
+
+  static constexpr int64_t kDefaultMemoryLimit = 256 << 20;
+  static constexpr int64_t kDefaultBatchSize = 1 << 15;
+  static constexpr int kDefaultMaxMergeFanIn = 64;
+
+  /// The sort keys, as for SortIndices.
+  SortOptions sort_options;
+  /// The number of bytes of input data which may be buffered in memory.  Once
+  /// exceeded, the buffered data is sorted and spilled to disk.
+  int64_t memory_limit;
+  /// The maximum number of rows in the batches written to spill files and in
+  /// the batches returned by the sorted reader.
+  int64_t batch_size;
+  /// The maximum number of spilled runs merged at once, each holding an open
+  /// file and a batch in memory.  If more runs were spilled, groups of them are
+  /// first merged into longer runs.  Must be at least 2.
+  int max_merge_fan_in;
+};
+
+/// \brief Sort a stream of record batches which may not fit in memory
+///
+/// Input batches are buffered until their size exceeds options.memory_limit;
+/// the buffered data is then split into runs which are sorted in parallel (if
+/// the ExecContext allows threading) and spilled as IPC files to a temporary
+/// directory (see the TMPDIR environment variable).  The returned reader merges
+/// the spilled runs back, holding only one batch per run in memory; if there are
+/// more than options.max_merge_fan_in runs, intermediate merge passes reduce their
+/// number first.  If the whole input fits within the memory limit, it is sorted
+/// in memory.
+///
+/// The sort is stable and orders values like SortIndices.  Spill files are
+/// deleted when the returned reader is destroyed.
+///
+/// \param[in] input the batches to sort
+/// \param[in] options the sort keys and memory limit
+/// \param[in] ctx the function execution context, optional
+/// \return a reader yielding the sorted rows
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatchReader>> ExternalSort(
+    std::shared_ptr<RecordBatchReader> input,
+    const ExternalSortOptions& options = ExternalSortOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
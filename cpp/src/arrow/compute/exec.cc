@@ -47,6 +47,8 @@
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -482,6 +484,43 @@ bool HaveChunkedArray(const std::vector<Datum>& values) {
   return false;
 }
 
+// The minimum number of rows for a task of parallel execution. Smaller batches
+// are grouped together so as to amortize the cost of scheduling tasks.
+static constexpr int64_t kMinParallelTaskLength = 16384;
+
+// Batches of a kernel execution, grouped into tasks for the CPU thread pool
+struct ParallelBatches {
+  std::vector<ExecBatch> batches;
+  // The position of each batch in the arguments
+  std::vector<int64_t> positions;
+  // The index of the first batch of each task, then the number of batches
+  std::vector<size_t> task_starts;
+
+  int num_tasks() const { return static_cast<int>(task_starts.size()) - 1; }
+};
+
+// Pull all batches from the iterator and group consecutive ones into tasks. If
+// `byte_aligned`, tasks only start at multiples of 8 rows, so that tasks writing
+// into slices of the same preallocated bitmap never write into the same byte.
+ParallelBatches GroupBatchesIntoTasks(ExecBatchIterator* iterator, bool byte_aligned) {
+  ParallelBatches out;
+  out.task_starts.push_back(0);
+  int64_t task_length = 0;
+  ExecBatch batch;
+  while (iterator->Next(&batch)) {
+    const int64_t position = iterator->position() - batch.length;
+    if (task_length >= kMinParallelTaskLength && (!byte_aligned || position % 8 == 0)) {
+      out.task_starts.push_back(out.batches.size());
+      task_length = 0;
+    }
+    task_length += batch.length;
+    out.positions.push_back(position);
+    out.batches.push_back(std::move(batch));
+  }
+  out.task_starts.push_back(out.batches.size());
+  return out;
+}
+
 template <typename KernelType>
 class KernelExecutorImpl : public KernelExecutor {
  public:
@@ -529,6 +568,15 @@ class KernelExecutorImpl : public KernelExecutor {
   ExecContext* exec_context() { return kernel_ctx_->exec_context(); }
   KernelState* state() { return kernel_ctx_->state(); }
 
+  // Whether batches may be executed in parallel on the CPU thread pool. A task
+  // already running on the pool executes serially, since waiting on other
+  // tasks of the pool could deadlock it.
+  bool CanExecuteInParallel() {
+    return exec_context()->use_threads() && kernel_->parallelizable &&
+           GetCpuThreadPoolCapacity() > 1 &&
+           !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+  }
+
   // Not all of these members are used for every executor type
 
   KernelContext* kernel_ctx_;
@@ -551,6 +599,9 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
  public:
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
+    if (output_descr_.shape == ValueDescr::ARRAY && CanExecuteInParallel()) {
+      return ExecuteInParallel(listener);
+    }
     ExecBatch batch;
     while (batch_iterator_->Next(&batch)) {
       RETURN_NOT_OK(ExecuteBatch(batch, listener));
@@ -593,14 +644,56 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
   }
 
  protected:
+  Status ExecuteInParallel(ExecListener* listener) {
+    ParallelBatches tasks =
+        GroupBatchesIntoTasks(batch_iterator_.get(), preallocate_contiguous_);
+    std::vector<Datum> outputs(tasks.batches.size());
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        tasks.num_tasks() > 1, tasks.num_tasks(), [&](int task) -> Status {
+          // Kernels may change the state of their context while executing
+          KernelContext task_ctx(exec_context());
+          task_ctx.SetState(state());
+          for (size_t i = tasks.task_starts[task]; i < tasks.task_starts[task + 1];
+               ++i) {
+            RETURN_NOT_OK(ExecuteBatch(&task_ctx, tasks.batches[i], tasks.positions[i],
+                                       &outputs[i]));
+          }
+          return Status::OK();
+        }));
+    if (preallocate_contiguous_) {
+      return listener->OnResult(std::move(preallocated_));
+    }
+    // Emit the chunks of output in order
+    for (auto& out : outputs) {
+      RETURN_NOT_OK(listener->OnResult(std::move(out)));
+    }
+    return Status::OK();
+  }
+
   Status ExecuteBatch(const ExecBatch& batch, ExecListener* listener) {
     Datum out;
-    RETURN_NOT_OK(PrepareNextOutput(batch, &out));
+    RETURN_NOT_OK(ExecuteBatch(kernel_ctx_, batch,
+                               batch_iterator_->position() - batch.length, &out));
+    if (!preallocate_contiguous_) {
+      // If we are producing chunked output rather than one big array, then
+      // emit each chunk as soon as it's available
+      RETURN_NOT_OK(listener->OnResult(std::move(out)));
+    }
+    return Status::OK();
+  }
+
+  // Execute the kernel on a batch starting at the given position in the
+  // arguments. This may be called concurrently for different batches, each
+  // with its own kernel context.
+  Status ExecuteBatch(KernelContext* ctx, const ExecBatch& batch,
+                      int64_t batch_start_position, Datum* out_datum) {
+    Datum& out = *out_datum;
+    RETURN_NOT_OK(PrepareNextOutput(batch, batch_start_position, &out));
 
     if (output_descr_.shape == ValueDescr::ARRAY) {
       ArrayData* out_arr = out.mutable_array();
       if (kernel_->null_handling == NullHandling::INTERSECTION) {
-        RETURN_NOT_OK(PropagateNulls(kernel_ctx_, batch, out_arr));
+        RETURN_NOT_OK(PropagateNulls(ctx, batch, out_arr));
       } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
         out_arr->null_count = 0;
       }
@@ -615,13 +708,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
       }
     }
 
-    RETURN_NOT_OK(kernel_->exec(kernel_ctx_, batch, &out));
-    if (!preallocate_contiguous_) {
-      // If we are producing chunked output rather than one big array, then
-      // emit each chunk as soon as it's available
-      RETURN_NOT_OK(listener->OnResult(std::move(out)));
-    }
-    return Status::OK();
+    return kernel_->exec(ctx, batch, &out);
   }
 
   Status PrepareExecute(const std::vector<Datum>& args) {
@@ -651,12 +738,11 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
   // outputs), then contiguous results are only possible if the input is
   // contiguous.
 
-  Status PrepareNextOutput(const ExecBatch& batch, Datum* out) {
+  Status PrepareNextOutput(const ExecBatch& batch, int64_t batch_start_position,
+                           Datum* out) {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       if (preallocate_contiguous_) {
         // The output is already fully preallocated
-        const int64_t batch_start_position = batch_iterator_->position() - batch.length;
-
         if (batch.length < batch_iterator_->length()) {
           // If this is a partial execution, then we write into a slice of
           // preallocated_
@@ -747,7 +833,9 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
     ExecBatch batch;
-    if (kernel_->can_execute_chunkwise) {
+    if (kernel_->can_execute_chunkwise && CanExecuteInParallel()) {
+      RETURN_NOT_OK(ExecuteInParallel(listener));
+    } else if (kernel_->can_execute_chunkwise) {
       while (batch_iterator_->Next(&batch)) {
         RETURN_NOT_OK(ExecuteBatch(batch, listener));
       }
@@ -775,6 +863,27 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
   }
 
  protected:
+  Status ExecuteInParallel(ExecListener* listener) {
+    ParallelBatches tasks =
+        GroupBatchesIntoTasks(batch_iterator_.get(), /*byte_aligned=*/false);
+    std::vector<Datum> outputs(tasks.batches.size());
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        tasks.num_tasks() > 1, tasks.num_tasks(), [&](int task) -> Status {
+          // Kernels may change the state of their context while executing
+          KernelContext task_ctx(exec_context());
+          task_ctx.SetState(state());
+          for (size_t i = tasks.task_starts[task]; i < tasks.task_starts[task + 1];
+               ++i) {
+            RETURN_NOT_OK(ExecuteBatch(&task_ctx, tasks.batches[i], &outputs[i]));
+          }
+          return Status::OK();
+        }));
+    for (auto& out : outputs) {
+      RETURN_NOT_OK(EmitResult(std::move(out), listener));
+    }
+    return Status::OK();
+  }
+
   Status ExecuteBatch(const ExecBatch& batch, ExecListener* listener) {
     if (batch.length == 0) {
       // Skip empty batches. This may only happen when not using
@@ -782,6 +891,14 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
       return Status::OK();
     }
     Datum out;
+    RETURN_NOT_OK(ExecuteBatch(kernel_ctx_, batch, &out));
+    return EmitResult(std::move(out), listener);
+  }
+
+  // Execute the kernel on a batch. This may be called concurrently for
+  // different batches, each with its own kernel context.
+  Status ExecuteBatch(KernelContext* ctx, const ExecBatch& batch, Datum* out_datum) {
+    Datum& out = *out_datum;
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // We preallocate (maybe) only for the output of processing the current
       // batch
@@ -790,9 +907,12 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
 
     if (kernel_->null_handling == NullHandling::INTERSECTION &&
         output_descr_.shape == ValueDescr::ARRAY) {
-      RETURN_NOT_OK(PropagateNulls(kernel_ctx_, batch, out.mutable_array()));
+      RETURN_NOT_OK(PropagateNulls(ctx, batch, out.mutable_array()));
     }
-    RETURN_NOT_OK(kernel_->exec(kernel_ctx_, batch, &out));
+    return kernel_->exec(ctx, batch, &out);
+  }
+
+  Status EmitResult(Datum out, ExecListener* listener) {
     if (!kernel_->finalize) {
       // If there is no result finalizer (e.g. for hash-based functions, we can
       // emit the processed batch right away rather than waiting
@@ -83,12 +83,14 @@ class ARROW_EXPORT ExecContext {
   // smaller chunks.
   int64_t exec_chunksize() const { return exec_chunksize_; }
 
-  /// \brief Set whether to use multiple threads for function execution. This
-  /// is not yet used.
+  /// \brief Set whether to use multiple threads for function execution.
   void set_use_threads(bool use_threads = true) { use_threads_ = use_threads; }
 
   /// \brief If true, then utilize multiple threads where relevant for function
-  /// execution. This is not yet used.
+  /// execution. Currently, the chunks of ChunkedArray arguments (or of the
+  /// exec_chunksize splits of Array arguments) are executed in parallel on the
+  /// CPU thread pool by scalar and chunkwise vector kernels that are
+  /// parallelizable.
   bool use_threads() const { return use_threads_; }
 
   // Set the preallocation strategy for kernel execution as it relates to
@@ -34,6 +34,12 @@
 namespace arrow {
 namespace compute {
 
+namespace internal {
+
+struct Aggregate;
+
+}  // namespace internal
+
 class ExecNode;
 
 class ARROW_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
@@ -242,5 +248,74 @@ class ARROW_EXPORT ExecNode {
   NodeVector outputs_;
 };
 
+/// \brief Make a node which excludes some rows from the batches passed through it
+///
+/// The filter Expression is bound against `input_schema`, which must describe the
+/// columns of the input.  Rows for which the filter does not evaluate to true are
+/// dropped; each input batch yields exactly one (possibly empty) output batch.
+/// If the ExecContext allows threading, batches are filtered on the CPU thread pool.
+ARROW_EXPORT
+Result<ExecNode*> MakeFilterNode(ExecNode* input, std::string label,
+                                 std::shared_ptr<Schema> input_schema, Expression filter,
+                                 ExecContext* ctx = NULLPTR);
+
+/// \brief Make a node which computes one output column per Expression
+///
+/// The Expressions are bound against `input_schema`, which must describe the
+/// columns of the input, and evaluated against each batch.  If the ExecContext
+/// allows threading, batches are projected on the CPU thread pool.
+ARROW_EXPORT
+Result<ExecNode*> MakeProjectNode(ExecNode* input, std::string label,
+                                  std::shared_ptr<Schema> input_schema,
+                                  std::vector<Expression> exprs,
+                                  ExecContext* ctx = NULLPTR);
+
+/// \brief The kind of join performed by a hash join node
+enum class JoinType {
+  /// Emit each left row having at least one matching right row
+  LEFT_SEMI,
+  /// Emit each left row having no matching right row
+  LEFT_ANTI,
+  /// Emit the concatenation of each left row with each of its matching right rows
+  INNER,
+  /// Like INNER, but also emit left rows without a match, padded with nulls
+  LEFT_OUTER,
+};
+
+/// \brief Make a node which joins its "left" input with its "right" input
+/// on equality of the given key columns.
+///
+/// The right input is the build side: it is accumulated entirely, then hash
+/// partitioned and inserted into one hash table per partition (in parallel if
+/// the ExecContext allows threading).  The left input is the probe side: its
+/// batches are streamed through the hash tables as they arrive, each yielding
+/// exactly one output batch with the same sequence number.
+///
+/// Output columns are the left columns, followed by the right columns for
+/// INNER and LEFT_OUTER joins.  Null keys never match.
+ARROW_EXPORT
+Result<ExecNode*> MakeHashJoinNode(JoinType join_type, ExecNode* left_input,
+                                   ExecNode* right_input, std::string label,
+                                   std::vector<int> left_keys,
+                                   std::vector<int> right_keys,
+                                   ExecContext* ctx = NULLPTR);
+
+/// \brief Make a node which groups its input on the given key columns and computes
+/// hash aggregate functions (such as "hash_sum") of the given argument columns.
+///
+/// Each thread feeding the node accumulates its own partial aggregation, so memory
+/// usage is proportional to the number of groups rather than to the number of rows.
+/// Partial aggregations are merged once all input has been received, and the
+/// groups are then emitted in batches.
+///
+/// Output columns are the aggregates (one per argument, in order), followed by the
+/// keys.  The order of output groups is unspecified.  The aggregates' options must
+/// outlive the node.
+ARROW_EXPORT
+Result<ExecNode*> MakeGroupByNode(ExecNode* input, std::string label,
+                                  std::vector<int> keys, std::vector<int> arguments,
+                                  std::vector<internal::Aggregate> aggregates,
+                                  ExecContext* ctx = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
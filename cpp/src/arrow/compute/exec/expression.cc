@@ -17,9 +17,11 @@
 
 #include "arrow/compute/exec/expression.h"
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec/expression_internal.h"
@@ -28,6 +30,7 @@
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/optional.h"
@@ -383,6 +386,80 @@ bool Expression::IsSatisfiable() const {
 
 namespace {
 
+// A cache of kernel dispatch results, keyed on the function and the argument types.
+// Binding the same expression repeatedly (for example a dataset filter, for each
+// fragment) then doesn't pay for dispatch each time.
+class DispatchCache {
+ public:
+  static DispatchCache* Instance() {
+    static DispatchCache cache;
+    return &cache;
+  }
+
+  // Dispatch a kernel as Function::DispatchBest (or DispatchExact if
+  // !insert_implicit_casts) would, returning a cached result if possible.
+  Result<const compute::Kernel*> Dispatch(
+      const std::shared_ptr<compute::Function>& function, bool insert_implicit_casts,
+      std::vector<ValueDescr>* descrs) {
+    std::string key;
+    const bool cacheable = MakeKey(*function, *descrs, insert_implicit_casts, &key);
+    if (cacheable) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (const Entry* entry = cache_.Find(key)) {
+        *descrs = entry->descrs;
+        return entry->kernel;
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto kernel, insert_implicit_casts
+                                           ? function->DispatchBest(descrs)
+                                           : function->DispatchExact(*descrs));
+    if (cacheable) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cache_.Replace(std::move(key), Entry{function, kernel, *descrs});
+    }
+    return kernel;
+  }
+
+ private:
+  static constexpr int32_t kCapacity = 1024;
+
+  struct Entry {
+    // Keep the function alive, so that another one can't reuse its address
+    std::shared_ptr<compute::Function> function;
+    const compute::Kernel* kernel;
+    // The argument types after implicit casts
+    std::vector<ValueDescr> descrs;
+  };
+
+  DispatchCache() : cache_(kCapacity) {}
+
+  // Return false if a key can't be made for these argument types.
+  static bool MakeKey(const compute::Function& function,
+                      const std::vector<ValueDescr>& descrs, bool insert_implicit_casts,
+                      std::string* out) {
+    const compute::Function* function_ptr = &function;
+    // Adding kernels to a function may invalidate those previously dispatched
+    const int num_kernels = function.num_kernels();
+    out->append(reinterpret_cast<const char*>(&function_ptr), sizeof(function_ptr));
+    out->append(reinterpret_cast<const char*>(&num_kernels), sizeof(num_kernels));
+    out->push_back(insert_implicit_casts ? 1 : 0);
+    for (const ValueDescr& descr : descrs) {
+      const std::string& fingerprint = descr.type->fingerprint();
+      if (fingerprint.empty()) return false;
+      const int64_t fingerprint_length = static_cast<int64_t>(fingerprint.size());
+      out->push_back(static_cast<char>(descr.shape));
+      out->append(reinterpret_cast<const char*>(&fingerprint_length),
+                  sizeof(fingerprint_length));
+      out->append(fingerprint);
+    }
+    return true;
+  }
+
+  std::mutex mutex_;
+  ::arrow::internal::LruCache<std::string, Entry> cache_;
+};
+
 // Produce a bound Expression from unbound Call and bound arguments.
 Result<Expression> BindNonRecursive(Expression::Call call, bool insert_implicit_casts,
                                     compute::ExecContext* exec_context) {
@@ -391,12 +468,10 @@ Result<Expression> BindNonRecursive(Expression::Call call, bool insert_implicit_
 
   auto descrs = GetDescriptors(call.arguments);
   ARROW_ASSIGN_OR_RAISE(call.function, GetFunction(call, exec_context));
+  ARROW_ASSIGN_OR_RAISE(call.kernel, DispatchCache::Instance()->Dispatch(
+                                         call.function, insert_implicit_casts, &descrs));
 
-  if (!insert_implicit_casts) {
-    ARROW_ASSIGN_OR_RAISE(call.kernel, call.function->DispatchExact(descrs));
-  } else {
-    ARROW_ASSIGN_OR_RAISE(call.kernel, call.function->DispatchBest(&descrs));
-
+  if (insert_implicit_casts) {
     for (size_t i = 0; i < descrs.size(); ++i) {
       if (descrs[i] == call.arguments[i].descr()) continue;
 
@@ -480,6 +555,36 @@ inline Result<Datum> GetDatumField(const FieldRef& ref, const Datum& input) {
   return field;
 }
 
+// Bound calls, by unbound call. A call which occurs several times in an expression
+// is bound only once, and its occurrences share the bound Expression.
+using BoundCalls = std::unordered_map<Expression, Expression, Expression::Hash>;
+
+Result<Expression> BindRecursive(const Expression& expr, const ValueDescr& in,
+                                 compute::ExecContext* exec_context,
+                                 BoundCalls* bound_calls) {
+  if (expr.literal()) return expr;
+
+  if (auto ref = expr.field_ref()) {
+    ARROW_ASSIGN_OR_RAISE(auto field, ref->GetOneOrNone(*in.type));
+    auto descr = field ? ValueDescr{field->type(), in.shape} : ValueDescr::Scalar(null());
+    return Expression{Expression::Parameter{*ref, std::move(descr)}};
+  }
+
+  auto it = bound_calls->find(expr);
+  if (it != bound_calls->end()) return it->second;
+
+  auto call = *CallNotNull(expr);
+  for (auto& argument : call.arguments) {
+    ARROW_ASSIGN_OR_RAISE(argument,
+                          BindRecursive(argument, in, exec_context, bound_calls));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto bound, BindNonRecursive(std::move(call),
+                                                     /*insert_implicit_casts=*/true,
+                                                     exec_context));
+  bound_calls->emplace(expr, bound);
+  return bound;
+}
+
 }  // namespace
 
 Result<Expression> Expression::Bind(ValueDescr in,
@@ -489,20 +594,8 @@ Result<Expression> Expression::Bind(ValueDescr in,
     return Bind(std::move(in), &exec_context);
   }
 
-  if (literal()) return *this;
-
-  if (auto ref = field_ref()) {
-    ARROW_ASSIGN_OR_RAISE(auto field, ref->GetOneOrNone(*in.type));
-    auto descr = field ? ValueDescr{field->type(), in.shape} : ValueDescr::Scalar(null());
-    return Expression{Parameter{*ref, std::move(descr)}};
-  }
-
-  auto call = *CallNotNull(*this);
-  for (auto& argument : call.arguments) {
-    ARROW_ASSIGN_OR_RAISE(argument, argument.Bind(in, exec_context));
-  }
-  return BindNonRecursive(std::move(call),
-                          /*insert_implicit_casts=*/true, exec_context);
+  BoundCalls bound_calls;
+  return BindRecursive(*this, in, exec_context, &bound_calls);
 }
 
 Result<Expression> Expression::Bind(const Schema& in_schema,
@@ -510,22 +603,297 @@ Result<Expression> Expression::Bind(const Schema& in_schema,
   return Bind(ValueDescr::Array(struct_(in_schema.fields())), exec_context);
 }
 
-Result<Datum> ExecuteScalarExpression(const Expression& expr, const Datum& input,
-                                      compute::ExecContext* exec_context) {
-  if (exec_context == nullptr) {
-    compute::ExecContext exec_context;
-    return ExecuteScalarExpression(expr, input, &exec_context);
+namespace {
+
+// The results of the calls which occur more than once in an expression, so that
+// each of them is executed only once. A result is empty until executed.
+using CommonSubexpressions = std::unordered_map<Expression, Datum, Expression::Hash>;
+
+void FindCommonSubexpressions(const Expression& expr,
+                              std::unordered_set<Expression, Expression::Hash>* seen,
+                              CommonSubexpressions* common) {
+  auto call = expr.call();
+  if (call == nullptr) return;
+  if (!seen->insert(expr).second) {
+    // The arguments of a repeated call were already visited
+    common->emplace(expr, Datum{});
+    return;
   }
+  for (const Expression& argument : call->arguments) {
+    FindCommonSubexpressions(argument, seen, common);
+  }
+}
 
-  if (!expr.IsBound()) {
-    return Status::Invalid("Cannot Execute unbound expression.");
+Result<Datum> ExecuteRecursive(const Expression& expr, const Datum& input,
+                               compute::ExecContext* exec_context,
+                               CommonSubexpressions* common);
+
+// Number of rows for a batch of fused execution. Small enough that the
+// intermediate results of a few calls stay in the L2 cache.
+constexpr int64_t kFusedBatchLength = 8192;
+
+// Whether a call may be executed as part of a fused tree of calls: its kernel must
+// produce a fixed width array, writing into slices of preallocated buffers.
+bool IsFusable(const Expression& expr) {
+  auto call = expr.call();
+  if (call == nullptr || expr.descr().shape != ValueDescr::ARRAY ||
+      call->function->kind() != compute::Function::SCALAR) {
+    return false;
   }
+  auto kernel = static_cast<const compute::ScalarKernel*>(call->kernel);
+  if (kernel->mem_allocation != compute::MemAllocation::PREALLOCATE ||
+      kernel->null_handling == compute::NullHandling::COMPUTED_NO_PREALLOCATE ||
+      !kernel->can_write_into_slices) {
+    return false;
+  }
+  const DataType& type = *expr.type();
+  return is_fixed_width(type.id()) && !is_dictionary(type.id()) &&
+         type.id() != Type::NA;
+}
 
-  if (!expr.IsScalarExpression()) {
-    return Status::Invalid(
-        "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
+// Scratch memory for the intermediate results of fused execution. Each thread
+// keeps one around, so that it is reused by successive executions.
+struct FusedScratchArena {
+  std::shared_ptr<ResizableBuffer> buffer;
+  bool in_use = false;
+};
+
+// Holds scratch memory for the duration of a fused execution. The thread's arena
+// is used unless it's already in use (execution is reentrant) or memory must come
+// from a pool other than the default one.
+class FusedScratch {
+ public:
+  ~FusedScratch() {
+    if (arena_ != nullptr) arena_->in_use = false;
+  }
+
+  Status Init(int64_t size, MemoryPool* pool) {
+    static thread_local FusedScratchArena arena;
+    if (pool != default_memory_pool() || arena.in_use) {
+      ARROW_ASSIGN_OR_RAISE(owned_, AllocateBuffer(size, pool));
+      data_ = owned_->mutable_data();
+      return Status::OK();
+    }
+    if (arena.buffer == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(arena.buffer, AllocateResizableBuffer(size, pool));
+    } else if (arena.buffer->size() < size) {
+      RETURN_NOT_OK(arena.buffer->Resize(size, /*shrink_to_fit=*/false));
+    }
+    arena_ = &arena;
+    arena_->in_use = true;
+    data_ = arena_->buffer->mutable_data();
+    return Status::OK();
+  }
+
+  uint8_t* data() const { return data_; }
+
+ private:
+  FusedScratchArena* arena_ = NULLPTR;
+  std::unique_ptr<Buffer> owned_;
+  uint8_t* data_ = NULLPTR;
+};
+
+// A tree of fusable calls, executed over batches of rows rather than whole arrays.
+// Instead of materializing a full length intermediate array per call, the result
+// of each call for the current batch is written into scratch memory which is
+// reused for the next batch. Only the root call's output is allocated in full.
+//
+// The arguments which aren't fusable calls (field references, literals and other
+// calls) are the leaves of the tree. They are evaluated up front as usual, as are
+// common subexpressions so that their full results may be reused.
+class FusedExecution {
+ public:
+  explicit FusedExecution(const CommonSubexpressions& common) : common_(common) {}
+
+  // Return false if the expression doesn't have at least two fusable calls.
+  bool Init(const Expression& expr) {
+    if (!IsFusable(expr)) return false;
+    AddNode(expr);
+    return nodes_.size() > 1;
+  }
+
+  Result<Datum> Execute(const Datum& input, compute::ExecContext* exec_context,
+                        CommonSubexpressions* common) {
+    const int64_t length = input.kind() == Datum::RECORD_BATCH
+                               ? input.record_batch()->num_rows()
+                               : input.length();
+
+    std::vector<Datum> leaves(leaves_.size());
+    for (size_t i = 0; i < leaves.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(leaves[i],
+                            ExecuteRecursive(leaves_[i], input, exec_context, common));
+      if (leaves[i].kind() == Datum::CHUNKED_ARRAY) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto concatenated,
+            Concatenate(leaves[i].chunks(), exec_context->memory_pool()));
+        leaves[i] = std::move(concatenated);
+      }
+      if (leaves[i].is_array() && leaves[i].length() != length) {
+        return Status::Invalid("Argument ", leaves_[i].ToString(), " had length ",
+                               leaves[i].length(), " instead of ", length);
+      }
+    }
+
+    const int64_t batch_length =
+        std::min(kFusedBatchLength, exec_context->exec_chunksize());
+    const size_t num_intermediates = nodes_.size() - 1;
+
+    // Lay out the buffers of the intermediate results in scratch memory
+    std::vector<int64_t> buffer_sizes, buffer_offsets;
+    int64_t scratch_size = 0;
+    for (size_t i = 0; i < num_intermediates; ++i) {
+      buffer_sizes.push_back(HasValidity(nodes_[i]) ? BitUtil::BytesForBits(batch_length)
+                                                    : 0);
+      buffer_sizes.push_back(BitUtil::BytesForBits(batch_length * nodes_[i].bit_width));
+    }
+    for (int64_t size : buffer_sizes) {
+      buffer_offsets.push_back(scratch_size);
+      scratch_size += BitUtil::RoundUpToMultipleOf64(size);
+    }
+
+    FusedScratch scratch;
+    RETURN_NOT_OK(scratch.Init(scratch_size, exec_context->memory_pool()));
+
+    std::vector<BufferVector> scratch_buffers(num_intermediates);
+    for (size_t i = 0; i < num_intermediates; ++i) {
+      for (size_t j = 2 * i; j < 2 * i + 2; ++j) {
+        scratch_buffers[i].push_back(
+            buffer_sizes[j] > 0 ? std::make_shared<MutableBuffer>(
+                                      scratch.data() + buffer_offsets[j], buffer_sizes[j])
+                                : NULLPTR);
+      }
+    }
+
+    std::vector<compute::KernelContext> kernel_contexts;
+    for (const Node& node : nodes_) {
+      kernel_contexts.emplace_back(exec_context);
+      kernel_contexts.back().SetState(node.call->kernel_state.get());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto out, AllocateOutput(nodes_.back(), length,
+                                                   &kernel_contexts.back()));
+
+    std::vector<Datum> leaf_values(leaves.size());
+    std::vector<Datum> node_values(nodes_.size());
+    for (int64_t offset = 0; offset < length; offset += batch_length) {
+      const int64_t batch_size = std::min(batch_length, length - offset);
+
+      for (size_t i = 0; i < leaves.size(); ++i) {
+        leaf_values[i] = leaves[i].is_array()
+                             ? Datum(leaves[i].array()->Slice(offset, batch_size))
+                             : leaves[i];
+      }
+
+      for (size_t i = 0; i < nodes_.size(); ++i) {
+        const Node& node = nodes_[i];
+
+        std::vector<Datum> arguments(node.arguments.size());
+        for (size_t j = 0; j < arguments.size(); ++j) {
+          const int source = node.arguments[j];
+          arguments[j] = source >= 0 ? node_values[source] : leaf_values[-1 - source];
+        }
+        compute::ExecBatch batch(std::move(arguments), batch_size);
+
+        Datum result;
+        if (i == num_intermediates) {
+          result = out->Slice(offset, batch_size);
+        } else {
+          result = ArrayData::Make(node.call->descr.type, batch_size, scratch_buffers[i]);
+        }
+        RETURN_NOT_OK(ExecuteNode(node, batch, &kernel_contexts[i], &result));
+        node_values[i] = std::move(result);
+      }
+    }
+
+    out->null_count = HasValidity(nodes_.back()) ? kUnknownNullCount : 0;
+    return out;
+  }
+
+ private:
+  struct Node {
+    const Expression::Call* call;
+    int bit_width;
+    // The source of each argument: the index of a node if >= 0, or (-1 - index) of
+    // a leaf otherwise.
+    std::vector<int> arguments;
+  };
+
+  // Add the nodes of a fusable call and of its fusable arguments, in post order.
+  int AddNode(const Expression& expr) {
+    Node node;
+    node.call = CallNotNull(expr);
+    node.bit_width = checked_cast<const FixedWidthType&>(*expr.type()).bit_width();
+    for (const Expression& argument : node.call->arguments) {
+      if (IsFusable(argument) && common_.find(argument) == common_.end()) {
+        node.arguments.push_back(AddNode(argument));
+        continue;
+      }
+      auto it = leaf_indices_.emplace(argument, static_cast<int>(leaves_.size())).first;
+      if (it->second == static_cast<int>(leaves_.size())) {
+        leaves_.push_back(argument);
+      }
+      node.arguments.push_back(-1 - it->second);
+    }
+    nodes_.push_back(std::move(node));
+    return static_cast<int>(nodes_.size()) - 1;
+  }
+
+  static const compute::ScalarKernel* GetKernel(const Node& node) {
+    return static_cast<const compute::ScalarKernel*>(node.call->kernel);
+  }
+
+  static bool HasValidity(const Node& node) {
+    return GetKernel(node)->null_handling != compute::NullHandling::OUTPUT_NOT_NULL;
+  }
+
+  static Result<std::shared_ptr<ArrayData>> AllocateOutput(
+      const Node& node, int64_t length, compute::KernelContext* kernel_context) {
+    auto out = std::make_shared<ArrayData>(node.call->descr.type, length);
+    out->buffers.resize(2);
+    if (HasValidity(node)) {
+      ARROW_ASSIGN_OR_RAISE(out->buffers[0], kernel_context->AllocateBitmap(length));
+    }
+    if (node.bit_width == 1) {
+      ARROW_ASSIGN_OR_RAISE(out->buffers[1], kernel_context->AllocateBitmap(length));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          out->buffers[1],
+          kernel_context->Allocate(BitUtil::BytesForBits(length * node.bit_width)));
+    }
+    return out;
   }
 
+  // Execute a node's kernel on a batch, as the scalar executor does
+  static Status ExecuteNode(const Node& node, const compute::ExecBatch& batch,
+                            compute::KernelContext* kernel_context, Datum* out) {
+    ArrayData* out_arr = out->mutable_array();
+    switch (GetKernel(node)->null_handling) {
+      case compute::NullHandling::INTERSECTION:
+        RETURN_NOT_OK(compute::detail::PropagateNulls(kernel_context, batch, out_arr));
+        break;
+      case compute::NullHandling::OUTPUT_NOT_NULL:
+        out_arr->null_count = 0;
+        break;
+      default:
+        out_arr->null_count = kUnknownNullCount;
+        break;
+    }
+    return GetKernel(node)->exec(kernel_context, batch, out);
+  }
+
+  const CommonSubexpressions& common_;
+  std::vector<Node> nodes_;
+  std::vector<Expression> leaves_;
+  std::unordered_map<Expression, int, Expression::Hash> leaf_indices_;
+};
+
+Result<Datum> ExecuteCall(const Expression& expr, const Datum& input,
+                          compute::ExecContext* exec_context,
+                          CommonSubexpressions* common);
+
+Result<Datum> ExecuteRecursive(const Expression& expr, const Datum& input,
+                               compute::ExecContext* exec_context,
+                               CommonSubexpressions* common) {
   if (auto lit = expr.literal()) return *lit;
 
   if (auto ref = expr.field_ref()) {
@@ -542,12 +910,36 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Datum& input
     return field;
   }
 
+  auto it = common->find(expr);
+  if (it == common->end()) {
+    return ExecuteCall(expr, input, exec_context, common);
+  }
+  if (it->second.kind() == Datum::NONE) {
+    // First occurrence of a common subexpression
+    ARROW_ASSIGN_OR_RAISE(it->second, ExecuteCall(expr, input, exec_context, common));
+  }
+  return it->second;
+}
+
+Result<Datum> ExecuteCall(const Expression& expr, const Datum& input,
+                          compute::ExecContext* exec_context,
+                          CommonSubexpressions* common) {
   auto call = CallNotNull(expr);
 
+  if ((input.kind() == Datum::ARRAY || input.kind() == Datum::RECORD_BATCH) &&
+      exec_context->preallocate_contiguous()) {
+    // Execute trees of elementwise calls batch by batch, keeping intermediate
+    // results in cache
+    FusedExecution fused(*common);
+    if (fused.Init(expr)) {
+      return fused.Execute(input, exec_context, common);
+    }
+  }
+
   std::vector<Datum> arguments(call->arguments.size());
   for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
+    ARROW_ASSIGN_OR_RAISE(arguments[i], ExecuteRecursive(call->arguments[i], input,
+                                                         exec_context, common));
   }
 
   auto executor = compute::detail::KernelExecutor::MakeScalar();
@@ -565,6 +957,30 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Datum& input
   return executor->WrapResults(arguments, listener->values());
 }
 
+}  // namespace
+
+Result<Datum> ExecuteScalarExpression(const Expression& expr, const Datum& input,
+                                      compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpression(expr, input, &exec_context);
+  }
+
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot Execute unbound expression.");
+  }
+
+  if (!expr.IsScalarExpression()) {
+    return Status::Invalid(
+        "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
+  }
+
+  std::unordered_set<Expression, Expression::Hash> seen;
+  CommonSubexpressions common;
+  FindCommonSubexpressions(expr, &seen, &common);
+  return ExecuteRecursive(expr, input, exec_context, &common);
+}
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
@@ -209,6 +209,11 @@ Result<Expression> SimplifyWithGuarantee(Expression,
 
 /// Execute a scalar expression against the provided state and input Datum. This
 /// expression must be bound.
+///
+/// When the input is an Array or a RecordBatch, nested elementwise calls producing
+/// fixed width outputs are executed together over batches of a few thousand rows,
+/// so that their intermediate results stay in cache rather than being materialized
+/// in full.
 ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Datum& input,
                                       compute::ExecContext* = NULLPTR);
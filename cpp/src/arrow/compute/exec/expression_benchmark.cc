@@ -20,7 +20,9 @@
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec/expression.h"
 #include "arrow/dataset/partition.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 
 namespace arrow {
@@ -84,5 +86,42 @@ BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee,
 BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee, positive_filter_cast_guarantee_dictionary,
                   filter_cast_positive, guarantee_dictionary);
 
+// A benchmark of Bind, as done with a dataset filter for each fragment.
+static void BindFilter(benchmark::State& state, Expression filter) {
+  auto dataset_schema = schema({field("a", int64()), field("b", int64())});
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(filter.Bind(*dataset_schema));
+  }
+}
+
+BENCHMARK_CAPTURE(BindFilter, filter_simple, filter_simple_positive);
+BENCHMARK_CAPTURE(BindFilter, filter_cast, filter_cast_positive);
+
+// A benchmark of ExecuteScalarExpression on a tree of elementwise calls,
+// (a * 2 + b) > c
+static void ExecuteElementwiseCalls(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  auto batch = RecordBatch::Make(
+      schema({field("a", float64()), field("b", float64()), field("c", float64())}),
+      num_rows,
+      {rng.Float64(num_rows, -100, 100, /*null_probability=*/0.1),
+       rng.Float64(num_rows, -100, 100, /*null_probability=*/0.1),
+       rng.Float64(num_rows, -100, 100, /*null_probability=*/0)});
+
+  auto expr = greater(
+      call("add", {call("multiply", {field_ref("a"), literal(2.0)}), field_ref("b")}),
+      field_ref("c"));
+  ASSIGN_OR_ABORT(expr, expr.Bind(*batch->schema()));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExecuteScalarExpression(expr, batch).status());
+  }
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK(ExecuteElementwiseCalls)->Arg(1 << 14)->Arg(1 << 20)->Arg(1 << 23);
+
 }  // namespace compute
 }  // namespace arrow
@@ -27,8 +27,11 @@
 #include <gtest/gtest.h>
 
 #include "arrow/compute/exec/expression_internal.h"
+#include "arrow/compute/function.h"
 #include "arrow/compute/registry.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 using testing::HasSubstr;
 using testing::UnorderedElementsAreArray;
@@ -493,6 +496,48 @@ TEST(Expression, BindNestedCall) {
   EXPECT_TRUE(expr.IsBound());
 }
 
+TEST(Expression, BindCommonSubexpressions) {
+  auto cast_i32 = cast(field_ref("i32"), int64());
+  ASSERT_OK_AND_ASSIGN(
+      auto expr, project({call("add", {cast_i32, literal(int64_t(1))}),
+                          call("multiply", {cast_i32, field_ref("i64")})},
+                         {"a", "b"})
+                     .Bind(*kBoringSchema));
+
+  // Occurrences of a call are bound once
+  const auto& add = *expr.call()->arguments[0].call();
+  const auto& multiply = *expr.call()->arguments[1].call();
+  EXPECT_TRUE(Identical(add.arguments[0], multiply.arguments[0]));
+}
+
+TEST(Expression, BindAfterAddingKernels) {
+  // Dispatch results are cached; adding kernels to a function must not leave
+  // stale ones behind
+  auto func = std::make_shared<ScalarFunction>("test_bind_after_adding_kernels",
+                                               Arity::Unary(), /*doc=*/nullptr);
+  auto exec = [](KernelContext*, const ExecBatch&, Datum*) { return Status::OK(); };
+  ASSERT_OK(func->AddKernel({InputType(int32())}, int32(), exec));
+  ASSERT_OK(GetFunctionRegistry()->AddFunction(func));
+
+  auto i32_expr = call(func->name(), {field_ref("i32")});
+  auto i64_expr = call(func->name(), {field_ref("i64")});
+
+  auto ExpectBindsToKernel = [&](const Expression& expr, ValueDescr descr) {
+    ASSERT_OK_AND_ASSIGN(auto bound, expr.Bind(*kBoringSchema));
+    ASSERT_OK_AND_ASSIGN(auto kernel, func->DispatchExact({descr}));
+    EXPECT_EQ(bound.call()->kernel, kernel);
+  };
+
+  ExpectBindsToKernel(i32_expr, ValueDescr::Array(int32()));
+  ASSERT_RAISES(NotImplemented, i64_expr.Bind(*kBoringSchema));
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(func->AddKernel({InputType(int64())}, int64(), exec));
+  }
+  ExpectBindsToKernel(i32_expr, ValueDescr::Array(int32()));
+  ExpectBindsToKernel(i64_expr, ValueDescr::Array(int64()));
+}
+
 TEST(Expression, ExecuteFieldRef) {
   auto ExpectRefIs = [](FieldRef ref, Datum in, Datum expected) {
     auto expr = field_ref(ref);
@@ -609,6 +654,87 @@ TEST(Expression, ExecuteCall) {
   ])"));
 }
 
+TEST(Expression, ExecuteFusedCalls) {
+  // Trees of elementwise calls are executed over batches of rows; make the input
+  // long enough to span several batches, and not a multiple of their length
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  const int64_t length = 50001;
+  auto batch = RecordBatch::Make(
+      schema({field("a", float64()), field("b", float64()), field("c", float64()),
+              field("i", int32()), field("s", utf8())}),
+      length,
+      {rng.Float64(length, -100, 100, /*null_probability=*/0.1),
+       rng.Float64(length, -100, 100, /*null_probability=*/0.1),
+       rng.Float64(length, -100, 100, /*null_probability=*/0),
+       rng.Int32(length, -100, 100, /*null_probability=*/0.1),
+       rng.String(length, 0, 10, /*null_probability=*/0.1)});
+
+  auto a_times_2_plus_b =
+      call("add", {call("multiply", {field_ref("a"), literal(2.0)}), field_ref("b")});
+
+  for (auto input : {batch, batch->Slice(1001), batch->Slice(0, 100)}) {
+    ExpectExecute(greater(a_times_2_plus_b, field_ref("c")), input);
+
+    // Implicit casts of arguments are fused too
+    ExpectExecute(call("subtract", {a_times_2_plus_b, field_ref("i")}), input);
+
+    // Calls which can't be fused are evaluated separately
+    auto upper_s = call("ascii_upper", {field_ref("s")});
+    ExpectExecute(call("add", {call("utf8_length", {upper_s}), field_ref("i")}), input);
+    auto negate_c = call("negate", {field_ref("c")});
+    ExpectExecute(call("is_null", {call("divide", {field_ref("a"), negate_c})}), input);
+
+    // Input as a struct array
+    ASSERT_OK_AND_ASSIGN(auto struct_input, input->ToStructArray());
+    ExpectExecute(greater(a_times_2_plus_b, field_ref("c")), struct_input);
+  }
+
+  // Scratch memory comes from the execution context's memory pool
+  ProxyMemoryPool pool(default_memory_pool());
+  ExecContext exec_context(&pool);
+  ASSERT_OK_AND_ASSIGN(auto expr,
+                       greater(a_times_2_plus_b, field_ref("c")).Bind(*batch->schema()));
+  ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(expr, batch));
+  ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteScalarExpression(expr, batch, &exec_context));
+  AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  ASSERT_GT(pool.max_memory(), 0);
+}
+
+TEST(Expression, ExecuteCommonSubexpressions) {
+  // A function counting how many times its kernel is executed
+  static int num_executions = 0;
+  auto func = std::make_shared<ScalarFunction>("test_count_executions", Arity::Unary(),
+                                               /*doc=*/nullptr);
+  ASSERT_OK(func->AddKernel(
+      {InputType(int32())}, int32(),
+      [](KernelContext*, const ExecBatch& batch, Datum* out) {
+        ++num_executions;
+        const ArrayData& in = *batch[0].array();
+        std::copy(in.GetValues<int32_t>(1), in.GetValues<int32_t>(1) + in.length,
+                  out->mutable_array()->GetMutableValues<int32_t>(1));
+        return Status::OK();
+      }));
+  ASSERT_OK(GetFunctionRegistry()->AddFunction(func));
+
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  const int64_t length = 50001;
+  auto batch =
+      RecordBatch::Make(schema({field("i", int32())}), length,
+                        {rng.Int32(length, -100, 100, /*null_probability=*/0.1)});
+
+  auto counted = call(func->name(), {field_ref("i")});
+  auto expr = project({call("add", {counted, literal(1)}),
+                       call("multiply", {counted, literal(2)}), counted},
+                      {"a", "b", "c"});
+  ExpectExecute(expr, batch);
+
+  // The common subexpression is executed once, on the whole input
+  ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*batch->schema()));
+  num_executions = 0;
+  ASSERT_OK(ExecuteScalarExpression(expr, batch).status());
+  ASSERT_EQ(num_executions, 1);
+}
+
 TEST(Expression, ExecuteDictionaryTransparent) {
   ExpectExecute(
       equal(field_ref("a"), field_ref("b")),
@@ -0,0 +1,320 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/aggregate.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace compute {
+namespace {
+
+// Output rows are emitted in batches of at most this many groups
+constexpr int64_t kOutputBatchSize = 32 * 1024;
+
+std::vector<ValueDescr> GetDescriptors(const ExecNode::BatchDescr& descr,
+                                       const std::vector<int>& indices) {
+  std::vector<ValueDescr> selected(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    selected[i] = descr[indices[i]];
+  }
+  return selected;
+}
+
+struct GroupByNode : ExecNode {
+  // The partial aggregation of the batches consumed by a single thread.  Group ids
+  // are local to each state; states are merged when all input has been received.
+  struct ThreadLocalState {
+    std::unique_ptr<internal::Grouper> grouper;
+    std::vector<std::unique_ptr<KernelState>> agg_states;
+  };
+
+  GroupByNode(ExecNode* input, std::string label, BatchDescr output_descr,
+              std::vector<int> key_indices, std::vector<int> argument_indices,
+              std::vector<internal::Aggregate> aggs,
+              std::vector<const HashAggregateKernel*> agg_kernels, ExecContext* ctx)
+      : ExecNode(input->plan(), std::move(label), {input->output_descr()},
+                 {"groupby"}, std::move(output_descr), /*num_outputs=*/1),
+        key_indices_(std::move(key_indices)),
+        argument_indices_(std::move(argument_indices)),
+        aggs_(std::move(aggs)),
+        agg_kernels_(std::move(agg_kernels)),
+        ctx_(ctx) {}
+
+  const char* kind_name() override { return "GroupByNode"; }
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) return;
+    }
+
+    Status status = Consume(batch);
+    if (!status.ok()) {
+      ErrorReceived(input, std::move(status));
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++num_received_;
+    MaybeFinish(std::move(lock));
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    StopProducing();
+  }
+
+  void InputFinished(ExecNode* input, int seq_stop) override {
+    DCHECK_EQ(input, inputs_[0]);
+    std::unique_lock<std::mutex> lock(mutex_);
+    input_seq_stop_ = seq_stop;
+    MaybeFinish(std::move(lock));
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void PauseProducing(ExecNode* output) override { inputs_[0]->PauseProducing(this); }
+
+  void ResumeProducing(ExecNode* output) override { inputs_[0]->ResumeProducing(this); }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) return;
+      stopped_ = true;
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+ private:
+  Result<ThreadLocalState*> GetLocalState() {
+    size_t thread_index = get_thread_index_();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (thread_index >= local_states_.size()) {
+      local_states_.resize(thread_index + 1);
+    }
+    auto& state = local_states_[thread_index];
+    if (state == nullptr) {
+      std::unique_ptr<ThreadLocalState> new_state(new ThreadLocalState);
+      ARROW_ASSIGN_OR_RAISE(
+          new_state->grouper,
+          internal::Grouper::Make(GetDescriptors(input_descrs_[0], key_indices_), ctx_));
+      ARROW_ASSIGN_OR_RAISE(
+          new_state->agg_states,
+          internal::InitKernels(agg_kernels_, ctx_, aggs_,
+                                GetDescriptors(input_descrs_[0], argument_indices_)));
+      state = std::move(new_state);
+    }
+    return state.get();
+  }
+
+  Status Consume(const ExecBatch& batch) {
+    ARROW_ASSIGN_OR_RAISE(ThreadLocalState * state, GetLocalState());
+
+    std::vector<Datum> keys(key_indices_.size());
+    for (size_t i = 0; i < key_indices_.size(); ++i) {
+      keys[i] = batch.values[key_indices_[i]];
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum id_batch,
+                          state->grouper->Consume(ExecBatch(keys, batch.length)));
+
+    for (size_t i = 0; i < agg_kernels_.size(); ++i) {
+      KernelContext kernel_ctx{ctx_};
+      kernel_ctx.SetState(state->agg_states[i].get());
+      ARROW_ASSIGN_OR_RAISE(
+          auto agg_batch,
+          ExecBatch::Make({batch.values[argument_indices_[i]], id_batch,
+                           Datum(state->grouper->num_groups())}));
+      RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
+    }
+    return Status::OK();
+  }
+
+  void MaybeFinish(std::unique_lock<std::mutex> lock) {
+    if (stopped_ || finished_ || num_received_ != input_seq_stop_) return;
+    finished_ = true;
+    lock.unlock();
+
+    Status status = Finish();
+    if (!status.ok()) {
+      outputs_[0]->ErrorReceived(this, std::move(status));
+      StopProducing();
+    }
+  }
+
+  // Fold every thread local state into a single one, then emit its groups.
+  //
+  // The states are merged one after the other on the calling thread, which may
+  // belong to the CPU thread pool and so must not wait on tasks of that pool.
+  Status Finish() {
+    std::vector<std::unique_ptr<ThreadLocalState>> states;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto& state : local_states_) {
+        if (state != nullptr) states.push_back(std::move(state));
+      }
+      local_states_.clear();
+    }
+    if (states.empty()) {
+      // No input was received; still emit a well-typed (empty) result
+      RETURN_NOT_OK(GetLocalState().status());
+      std::lock_guard<std::mutex> lock(mutex_);
+      states.push_back(std::move(local_states_.back()));
+      local_states_.clear();
+    }
+
+    ThreadLocalState* merged = states[0].get();
+    for (size_t s = 1; s < states.size(); ++s) {
+      ThreadLocalState* other = states[s].get();
+      if (other->grouper->num_groups() > 0) {
+        // Map the other state's group ids to those of the merged state
+        ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, other->grouper->GetUniques());
+        ARROW_ASSIGN_OR_RAISE(Datum mapping, merged->grouper->Consume(other_keys));
+
+        for (size_t i = 0; i < agg_kernels_.size(); ++i) {
+          KernelContext kernel_ctx{ctx_};
+          kernel_ctx.SetState(merged->agg_states[i].get());
+          RETURN_NOT_OK(agg_kernels_[i]->merge(
+              &kernel_ctx, std::move(*other->agg_states[i]), *mapping.array()));
+        }
+      }
+      states[s].reset();
+    }
+
+    // Aggregates, followed by keys
+    std::vector<Datum> out_values;
+    for (size_t i = 0; i < agg_kernels_.size(); ++i) {
+      KernelContext kernel_ctx{ctx_};
+      kernel_ctx.SetState(merged->agg_states[i].get());
+      Datum out;
+      RETURN_NOT_OK(agg_kernels_[i]->finalize(&kernel_ctx, &out));
+      out_values.push_back(std::move(out));
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, merged->grouper->GetUniques());
+    for (auto& key : out_keys.values) {
+      out_values.push_back(std::move(key));
+    }
+    const int64_t num_groups = merged->grouper->num_groups();
+    states.clear();
+
+    int seq_num = 0;
+    for (int64_t offset = 0; offset < num_groups; offset += kOutputBatchSize) {
+      const int64_t length = std::min(kOutputBatchSize, num_groups - offset);
+      std::vector<Datum> slice(out_values.size());
+      for (size_t i = 0; i < out_values.size(); ++i) {
+        slice[i] = out_values[i].array()->Slice(offset, length);
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) return Status::OK();
+      }
+      outputs_[0]->InputReceived(this, seq_num++, ExecBatch(std::move(slice), length));
+    }
+    outputs_[0]->InputFinished(this, seq_num);
+    return Status::OK();
+  }
+
+  const std::vector<int> key_indices_, argument_indices_;
+  const std::vector<internal::Aggregate> aggs_;
+  const std::vector<const HashAggregateKernel*> agg_kernels_;
+  ExecContext* ctx_;
+
+  util::ThreadIndexer get_thread_index_;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<ThreadLocalState>> local_states_;
+  int num_received_ = 0;
+  int input_seq_stop_ = -1;
+  bool finished_ = false;
+  bool stopped_ = false;
+};
+
+}  // namespace
+
+Result<ExecNode*> MakeGroupByNode(ExecNode* input, std::string label,
+                                  std::vector<int> keys, std::vector<int> arguments,
+                                  std::vector<internal::Aggregate> aggregates,
+                                  ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  if (keys.empty()) {
+    return Status::Invalid("Group by node '", label, "' expects at least one key");
+  }
+
+  const auto& input_descr = input->output_descr();
+  for (const auto& value_descr : input_descr) {
+    if (value_descr.shape != ValueDescr::ARRAY) {
+      return Status::NotImplemented("Group by of inputs with scalar columns");
+    }
+  }
+  for (const auto* indices : {&keys, &arguments}) {
+    for (int index : *indices) {
+      if (index < 0 || index >= static_cast<int>(input_descr.size())) {
+        return Status::Invalid("Group by column index ", index, " out of bounds");
+      }
+    }
+  }
+
+  // Resolve the aggregate kernels and their output types
+  auto argument_descrs = GetDescriptors(input_descr, arguments);
+  ARROW_ASSIGN_OR_RAISE(auto kernels,
+                        internal::GetKernels(ctx, aggregates, argument_descrs));
+  ARROW_ASSIGN_OR_RAISE(auto states,
+                        internal::InitKernels(kernels, ctx, aggregates, argument_descrs));
+  ARROW_ASSIGN_OR_RAISE(
+      FieldVector agg_fields,
+      internal::ResolveKernels(aggregates, kernels, states, ctx, argument_descrs));
+
+  ExecNode::BatchDescr output_descr;
+  for (const auto& agg_field : agg_fields) {
+    output_descr.push_back(ValueDescr::Array(agg_field->type()));
+  }
+  for (int key : keys) {
+    output_descr.push_back(input_descr[key]);
+  }
+
+  auto node = input->plan()->EmplaceNode<GroupByNode>(
+      input, std::move(label), std::move(output_descr), std::move(keys),
+      std::move(arguments), std::move(aggregates), std::move(kernels), ctx);
+  node->AddInput(input);
+  return node;
+}
+
+}  // namespace compute
+}  // namespace arrow
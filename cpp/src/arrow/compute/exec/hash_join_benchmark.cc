@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr int64_t kBatchSize = 32 * 1024;
+
+static RecordBatchVector MakeKeyedBatches(const std::shared_ptr<Schema>& schema,
+                                          int64_t num_rows, int64_t max_key,
+                                          random::SeedType seed) {
+  random::RandomArrayGenerator rng(seed);
+  RecordBatchVector batches;
+  for (int64_t offset = 0; offset < num_rows; offset += kBatchSize) {
+    const int64_t length = std::min(kBatchSize, num_rows - offset);
+    auto key = rng.Int64(length, /*min=*/0, max_key);
+    auto payload = rng.Float64(length, /*min=*/0, /*max=*/1);
+    batches.push_back(RecordBatch::Make(schema, length, {key, payload}));
+  }
+  return batches;
+}
+
+// Join a streamed probe side of state.range(0) rows against a build side of
+// state.range(1) rows, whose keys are drawn from the same domain.
+static void HashJoin(benchmark::State& state, JoinType join_type, bool use_threads) {
+  const int64_t num_probe_rows = state.range(0);
+  const int64_t num_build_rows = state.range(1);
+  const int64_t max_key = num_build_rows * 2;
+
+  auto left_schema = schema({field("l_key", int64()), field("l_payload", float64())});
+  auto right_schema = schema({field("r_key", int64()), field("r_payload", float64())});
+  auto probe_batches = MakeKeyedBatches(left_schema, num_probe_rows, max_key, 0x1234);
+  auto build_batches = MakeKeyedBatches(right_schema, num_build_rows, max_key, 0x5678);
+
+  FieldVector out_fields = left_schema->fields();
+  if (join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER) {
+    out_fields.insert(out_fields.end(), right_schema->fields().begin(),
+                      right_schema->fields().end());
+  }
+  auto out_schema = schema(std::move(out_fields));
+
+  ExecContext ctx;
+  ctx.set_use_threads(use_threads);
+  auto executor = ::arrow::internal::GetCpuThreadPool();
+
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(auto plan, ExecPlan::Make());
+    ASSIGN_OR_ABORT(auto probe_reader,
+                    RecordBatchReader::Make(probe_batches, left_schema));
+    ASSIGN_OR_ABORT(auto build_reader,
+                    RecordBatchReader::Make(build_batches, right_schema));
+    auto probe = MakeRecordBatchReaderNode(plan.get(), "probe", probe_reader, executor);
+    auto build = MakeRecordBatchReaderNode(plan.get(), "build", build_reader, executor);
+    ASSIGN_OR_ABORT(auto join, MakeHashJoinNode(join_type, probe, build, "join",
+                                                /*left_keys=*/{0}, /*right_keys=*/{0},
+                                                &ctx));
+    auto sink = MakeRecordBatchCollectNode(plan.get(), "sink", out_schema);
+    sink->AddInput(join);
+
+    ABORT_NOT_OK(plan->StartProducing());
+    ABORT_NOT_OK(CollectAsyncGenerator(sink->generator()).status());
+  }
+
+  state.SetItemsProcessed(state.iterations() * (num_probe_rows + num_build_rows));
+}
+
+static void HashJoinArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"probe_rows", "build_rows"});
+  for (int64_t build_rows : {1 << 10, 1 << 16, 1 << 20}) {
+    bench->Args({1 << 22, build_rows});
+  }
+  bench->UseRealTime();
+}
+
+BENCHMARK_CAPTURE(HashJoin, LeftSemi, JoinType::LEFT_SEMI, /*use_threads=*/true)
+    ->Apply(HashJoinArgs);
+BENCHMARK_CAPTURE(HashJoin, LeftAnti, JoinType::LEFT_ANTI, /*use_threads=*/true)
+    ->Apply(HashJoinArgs);
+BENCHMARK_CAPTURE(HashJoin, Inner, JoinType::INNER, /*use_threads=*/true)
+    ->Apply(HashJoinArgs);
+BENCHMARK_CAPTURE(HashJoin, LeftOuter, JoinType::LEFT_OUTER, /*use_threads=*/true)
+    ->Apply(HashJoinArgs);
+BENCHMARK_CAPTURE(HashJoin, InnerSerial, JoinType::INNER, /*use_threads=*/false)
+    ->Apply(HashJoinArgs);
+
+}  // namespace compute
+}  // namespace arrow
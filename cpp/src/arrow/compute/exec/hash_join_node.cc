@@ -0,0 +1,655 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+constexpr uint64_t kNullKeyHash = 0x9e3779b97f4a7c15ULL;
+
+inline void MixHash(uint64_t* seed, uint64_t value) {
+  *seed ^= value + 0x9e3779b9 + (*seed << 6) + (*seed >> 2);
+}
+
+// The type of a key column once dictionaries are decoded
+std::shared_ptr<DataType> DecodedKeyType(const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::DICTIONARY) {
+    return checked_cast<const DictionaryType&>(*type).value_type();
+  }
+  return type;
+}
+
+// Replace dictionary encoded keys with their values.  Batches of either input may carry
+// different dictionaries, so the indices can't be compared across batches.
+Result<ExecBatch> DecodeDictionaryKeys(ExecBatch keys, ExecContext* ctx) {
+  for (auto& key : keys.values) {
+    const ArrayData& data = *key.array();
+    if (data.type->id() != Type::DICTIONARY) continue;
+    auto indices = data.Copy();
+    indices->type = checked_cast<const DictionaryType&>(*data.type).index_type();
+    indices->dictionary = nullptr;
+    ARROW_ASSIGN_OR_RAISE(key, Take(MakeArray(data.dictionary), MakeArray(indices),
+                                    TakeOptions::Defaults(), ctx));
+  }
+  return keys;
+}
+
+// Mix the hash of each slot of a key column into `hashes`.
+//
+// Only used to assign rows to partitions, so equal keys must hash equally
+// but collisions are harmless (the partition's Grouper resolves them).
+Status HashKeyColumn(const ArrayData& data, uint64_t* hashes) {
+  const auto& type = *data.type;
+  // Hashing indices would send equal keys with different dictionaries to different
+  // partitions, see DecodeDictionaryKeys
+  DCHECK_NE(type.id(), Type::DICTIONARY);
+  auto visit_null = [&] { MixHash(hashes++, kNullKeyHash); };
+  auto visit_bytes = [&](util::string_view bytes) {
+    MixHash(hashes++, ::arrow::internal::ComputeStringHash<0>(
+                          bytes.data(), static_cast<int64_t>(bytes.size())));
+  };
+
+  if (type.id() == Type::BOOL) {
+    VisitArrayDataInline<BooleanType>(
+        data, [&](bool value) { MixHash(hashes++, value ? 1 : 0); }, visit_null);
+    return Status::OK();
+  }
+
+  if (is_fixed_width(type.id())) {
+    const int byte_width = checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+    ArrayData viewed(fixed_size_binary(byte_width), data.length, data.buffers,
+                     data.null_count, data.offset);
+    VisitArrayDataInline<FixedSizeBinaryType>(viewed, visit_bytes, visit_null);
+    return Status::OK();
+  }
+
+  if (is_binary_like(type.id())) {
+    VisitArrayDataInline<BinaryType>(data, visit_bytes, visit_null);
+    return Status::OK();
+  }
+
+  if (is_large_binary_like(type.id())) {
+    VisitArrayDataInline<LargeBinaryType>(data, visit_bytes, visit_null);
+    return Status::OK();
+  }
+
+  return Status::NotImplemented("Hash join keys of type ", type);
+}
+
+// Assign each row of `keys` to one of `num_partitions` partitions by hashing its keys.
+// Rows with a null key can never match and are not assigned to any partition.
+Result<std::vector<std::shared_ptr<Int64Array>>> PartitionRows(const ExecBatch& keys,
+                                                               int num_partitions,
+                                                               MemoryPool* pool) {
+  const int64_t length = keys.length;
+  std::vector<uint64_t> hashes(length, 0);
+  std::vector<bool> has_null_key(length, false);
+
+  for (const auto& key : keys.values) {
+    const ArrayData& data = *key.array();
+    RETURN_NOT_OK(HashKeyColumn(data, hashes.data()));
+    if (data.GetNullCount() != 0) {
+      const uint8_t* validity = data.buffers[0]->data();
+      for (int64_t i = 0; i < length; ++i) {
+        if (!BitUtil::GetBit(validity, data.offset + i)) {
+          has_null_key[i] = true;
+        }
+      }
+    }
+  }
+
+  std::vector<TypedBufferBuilder<int64_t>> builders;
+  builders.reserve(num_partitions);
+  for (int p = 0; p < num_partitions; ++p) {
+    builders.emplace_back(pool);
+    if (num_partitions == 1) {
+      RETURN_NOT_OK(builders[0].Reserve(length));
+    }
+  }
+
+  for (int64_t i = 0; i < length; ++i) {
+    if (has_null_key[i]) continue;
+    auto p = static_cast<int>((hashes[i] >> 32) % num_partitions);
+    RETURN_NOT_OK(builders[p].Append(i));
+  }
+
+  std::vector<std::shared_ptr<Int64Array>> indices(num_partitions);
+  for (int p = 0; p < num_partitions; ++p) {
+    auto num_rows = builders[p].length();
+    ARROW_ASSIGN_OR_RAISE(auto buffer, builders[p].Finish());
+    indices[p] = std::make_shared<Int64Array>(num_rows, std::move(buffer));
+  }
+  return indices;
+}
+
+ExecBatch SelectColumns(const ExecBatch& batch, const std::vector<int>& indices) {
+  std::vector<Datum> values(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    values[i] = batch.values[indices[i]];
+  }
+  return ExecBatch(std::move(values), batch.length);
+}
+
+Result<ExecBatch> TakeRows(const ExecBatch& batch, const Array& indices,
+                           ExecContext* ctx) {
+  std::vector<Datum> values(batch.values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        values[i], Take(batch.values[i], indices, TakeOptions::NoBoundsCheck(), ctx));
+  }
+  return ExecBatch(std::move(values), indices.length());
+}
+
+Result<ExecBatch> MakeEmptyBatch(const std::vector<ValueDescr>& descrs,
+                                 MemoryPool* pool) {
+  std::vector<Datum> values(descrs.size());
+  for (size_t i = 0; i < descrs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(values[i], MakeArrayOfNull(descrs[i].type, 0, pool));
+  }
+  return ExecBatch(std::move(values), 0);
+}
+
+Result<ExecBatch> ConcatenateBatches(const std::vector<ExecBatch>& batches,
+                                     const std::vector<ValueDescr>& descrs,
+                                     MemoryPool* pool) {
+  if (batches.empty()) {
+    return MakeEmptyBatch(descrs, pool);
+  }
+  if (batches.size() == 1) {
+    return batches[0];
+  }
+  std::vector<Datum> values(descrs.size());
+  int64_t length = 0;
+  for (const auto& batch : batches) {
+    length += batch.length;
+  }
+  for (size_t i = 0; i < values.size(); ++i) {
+    ArrayVector column;
+    column.reserve(batches.size());
+    for (const auto& batch : batches) {
+      column.push_back(batch.values[i].make_array());
+    }
+    ARROW_ASSIGN_OR_RAISE(values[i], Concatenate(column, pool));
+  }
+  return ExecBatch(std::move(values), length);
+}
+
+Result<std::shared_ptr<Int64Array>> FinishIndices(TypedBufferBuilder<int64_t>* builder) {
+  auto length = builder->length();
+  ARROW_ASSIGN_OR_RAISE(auto buffer, builder->Finish());
+  return std::make_shared<Int64Array>(length, std::move(buffer));
+}
+
+struct HashJoinNode : ExecNode {
+  // One shard of the build side.  Right rows are assigned to partitions by
+  // hashing their keys, so each key is present in at most one partition.
+  struct BuildPartition {
+    // Holds the right keys of this partition.  Only read (through Lookup) once the
+    // build is finished, so probes need no locking.
+    std::unique_ptr<internal::Grouper> grouper;
+    // The right rows of this partition and, for each group id, the indices of the
+    // rows bearing that key: group_rows[group_offsets[id]:group_offsets[id + 1]]
+    // (only retained if right columns are emitted)
+    ExecBatch rows;
+    std::vector<int64_t> group_offsets;
+    std::vector<int64_t> group_rows;
+  };
+
+  // A batch of right rows, its decoded keys, and the row indices assigned to each
+  // partition
+  struct BuildBatch {
+    ExecBatch batch;
+    ExecBatch keys;
+    std::vector<std::shared_ptr<Int64Array>> partition_indices;
+  };
+
+  HashJoinNode(ExecNode* left_input, ExecNode* right_input, std::string label,
+               BatchDescr output_descr, JoinType join_type, std::vector<int> left_keys,
+               std::vector<int> right_keys, ExecContext* ctx, int num_partitions)
+      : ExecNode(left_input->plan(), std::move(label),
+                 {left_input->output_descr(), right_input->output_descr()},
+                 {"left", "right"}, std::move(output_descr), /*num_outputs=*/1),
+        join_type_(join_type),
+        emit_right_(join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER),
+        left_keys_(std::move(left_keys)),
+        right_keys_(std::move(right_keys)),
+        ctx_(ctx) {
+    partitions_.reserve(num_partitions);
+    for (int p = 0; p < num_partitions; ++p) {
+      partitions_.emplace_back(new BuildPartition);
+    }
+  }
+
+  const char* kind_name() override { return "HashJoinNode"; }
+
+  int num_partitions() const { return static_cast<int>(partitions_.size()); }
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    if (input == inputs_[1]) {
+      ConsumeBuild(std::move(batch));
+      return;
+    }
+
+    DCHECK_EQ(input, inputs_[0]);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopped_) return;
+    if (!build_ready_) {
+      // Defer probing until the hash tables are complete
+      pending_probe_.emplace_back(seq_num, std::move(batch));
+      if (!probe_paused_) {
+        probe_paused_ = true;
+        lock.unlock();
+        inputs_[0]->PauseProducing(this);
+      }
+      return;
+    }
+    lock.unlock();
+    ProbeAndEmit(seq_num, batch);
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    StopProducing();
+  }
+
+  void InputFinished(ExecNode* input, int seq_stop) override {
+    if (input == inputs_[0]) {
+      // Each probe batch yields exactly one output batch
+      outputs_[0]->InputFinished(this, seq_stop);
+      return;
+    }
+
+    DCHECK_EQ(input, inputs_[1]);
+    std::unique_lock<std::mutex> lock(mutex_);
+    build_seq_stop_ = seq_stop;
+    MaybeStartBuild(std::move(lock));
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void PauseProducing(ExecNode* output) override { inputs_[0]->PauseProducing(this); }
+
+  void ResumeProducing(ExecNode* output) override { inputs_[0]->ResumeProducing(this); }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (stopped_) return;
+      stopped_ = true;
+      pending_probe_.clear();
+      build_batches_.clear();
+    }
+    for (auto input : inputs_) {
+      input->StopProducing(this);
+    }
+  }
+
+ private:
+  void ConsumeBuild(ExecBatch batch) {
+    auto maybe_build_batch = MakeBuildBatch(std::move(batch));
+    if (!maybe_build_batch.ok()) {
+      ErrorReceived(inputs_[1], maybe_build_batch.status());
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopped_) return;
+    build_batches_.push_back(maybe_build_batch.MoveValueUnsafe());
+    ++build_received_;
+    MaybeStartBuild(std::move(lock));
+  }
+
+  Result<BuildBatch> MakeBuildBatch(ExecBatch batch) {
+    BuildBatch build_batch;
+    ARROW_ASSIGN_OR_RAISE(build_batch.keys,
+                          DecodeDictionaryKeys(SelectColumns(batch, right_keys_), ctx_));
+    ARROW_ASSIGN_OR_RAISE(
+        build_batch.partition_indices,
+        PartitionRows(build_batch.keys, num_partitions(), ctx_->memory_pool()));
+    // When right columns are not emitted only the keys are retained
+    if (emit_right_) {
+      build_batch.batch = std::move(batch);
+    }
+    return build_batch;
+  }
+
+  void MaybeStartBuild(std::unique_lock<std::mutex> lock) {
+    if (build_started_ || build_received_ != build_seq_stop_) return;
+    build_started_ = true;
+    lock.unlock();
+
+    auto plan = this->plan()->shared_from_this();
+    std::vector<Future<>> partitions_built(num_partitions());
+    for (int p = 0; p < num_partitions(); ++p) {
+      if (ctx_->use_threads()) {
+        auto maybe_future = ::arrow::internal::GetCpuThreadPool()->Submit(
+            [this, p] { return BuildPartitionTable(p); });
+        if (!maybe_future.ok()) {
+          partitions_built[p] = Future<>::MakeFinished(maybe_future.status());
+          continue;
+        }
+        partitions_built[p] = maybe_future.MoveValueUnsafe();
+      } else {
+        partitions_built[p] = Future<>::MakeFinished(BuildPartitionTable(p));
+      }
+    }
+    AllComplete(partitions_built).AddCallback([plan, this](const Status& status) {
+      FinishBuild(status);
+    });
+  }
+
+  // Gather the right rows assigned to partition `p` and insert their keys
+  // into the partition's hash table.
+  Status BuildPartitionTable(int p) {
+    auto& partition = *partitions_[p];
+    const auto& right_descr = input_descrs_[1];
+
+    std::vector<ValueDescr> key_descrs(right_keys_.size());
+    for (size_t i = 0; i < right_keys_.size(); ++i) {
+      key_descrs[i] =
+          ValueDescr::Array(DecodedKeyType(right_descr[right_keys_[i]].type));
+    }
+    ARROW_ASSIGN_OR_RAISE(partition.grouper, internal::Grouper::Make(key_descrs, ctx_));
+
+    std::vector<ExecBatch> key_pieces, row_pieces;
+    for (const auto& build_batch : build_batches_) {
+      const auto& indices = *build_batch.partition_indices[p];
+      if (indices.length() == 0) continue;
+      ARROW_ASSIGN_OR_RAISE(auto key_piece, TakeRows(build_batch.keys, indices, ctx_));
+      key_pieces.push_back(std::move(key_piece));
+      if (emit_right_) {
+        ARROW_ASSIGN_OR_RAISE(auto row_piece, TakeRows(build_batch.batch, indices, ctx_));
+        row_pieces.push_back(std::move(row_piece));
+      }
+    }
+    if (key_pieces.empty()) {
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto keys, ConcatenateBatches(key_pieces, key_descrs,
+                                                        ctx_->memory_pool()));
+    key_pieces.clear();
+    ARROW_ASSIGN_OR_RAISE(Datum ids, partition.grouper->Consume(keys));
+    if (!emit_right_) {
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(partition.rows, ConcatenateBatches(row_pieces, right_descr,
+                                                             ctx_->memory_pool()));
+    // Sort the row indices by group id, as Grouper::MakeGroupings would but with
+    // 64 bit offsets
+    const uint32_t num_groups = partition.grouper->num_groups();
+    const uint32_t* raw_ids = ids.array()->GetValues<uint32_t>(1);
+    partition.group_offsets.assign(num_groups + 1, 0);
+    for (int64_t i = 0; i < keys.length; ++i) {
+      ++partition.group_offsets[raw_ids[i] + 1];
+    }
+    for (uint32_t id = 0; id < num_groups; ++id) {
+      partition.group_offsets[id + 1] += partition.group_offsets[id];
+    }
+    std::vector<int64_t> next_row(partition.group_offsets.begin(),
+                                  partition.group_offsets.end() - 1);
+    partition.group_rows.resize(keys.length);
+    for (int64_t i = 0; i < keys.length; ++i) {
+      partition.group_rows[next_row[raw_ids[i]]++] = i;
+    }
+    return Status::OK();
+  }
+
+  void FinishBuild(const Status& status) {
+    if (!status.ok()) {
+      ErrorReceived(inputs_[1], status);
+      return;
+    }
+
+    std::vector<std::pair<int, ExecBatch>> pending_probe;
+    bool resume_probe;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      build_batches_.clear();
+      build_ready_ = true;
+      if (stopped_) return;
+      pending_probe.swap(pending_probe_);
+      resume_probe = probe_paused_;
+      probe_paused_ = false;
+    }
+
+    for (const auto& seq_num_batch : pending_probe) {
+      ProbeAndEmit(seq_num_batch.first, seq_num_batch.second);
+    }
+    if (resume_probe) {
+      inputs_[0]->ResumeProducing(this);
+    }
+  }
+
+  void ProbeAndEmit(int seq_num, const ExecBatch& batch) {
+    auto maybe_joined = Probe(batch);
+    if (!maybe_joined.ok()) {
+      ErrorReceived(inputs_[0], maybe_joined.status());
+      return;
+    }
+    outputs_[0]->InputReceived(this, seq_num, maybe_joined.MoveValueUnsafe());
+  }
+
+  Result<ExecBatch> Probe(const ExecBatch& batch) {
+    MemoryPool* pool = ctx_->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(auto keys,
+                          DecodeDictionaryKeys(SelectColumns(batch, left_keys_), ctx_));
+    ARROW_ASSIGN_OR_RAISE(auto partition_indices,
+                          PartitionRows(keys, num_partitions(), pool));
+
+    std::vector<bool> matched(batch.length, false);
+    std::vector<ExecBatch> pieces;
+
+    for (int p = 0; p < num_partitions(); ++p) {
+      const auto& indices = *partition_indices[p];
+      auto& partition = *partitions_[p];
+      if (indices.length() == 0 || partition.grouper->num_groups() == 0) continue;
+
+      ExecBatch partition_keys;
+      if (indices.length() == batch.length) {
+        // All rows were assigned to this partition, in order
+        partition_keys = keys;
+      } else {
+        ARROW_ASSIGN_OR_RAISE(partition_keys, TakeRows(keys, indices, ctx_));
+      }
+
+      // Null ids denote keys which are absent from the right input
+      ARROW_ASSIGN_OR_RAISE(Datum ids, partition.grouper->Lookup(partition_keys));
+      const auto id_array = ids.array_as<UInt32Array>();
+      const uint32_t* raw_ids = id_array->raw_values();
+      const int64_t* raw_indices = indices.raw_values();
+
+      if (!emit_right_) {
+        for (int64_t i = 0; i < indices.length(); ++i) {
+          if (id_array->IsValid(i)) {
+            matched[raw_indices[i]] = true;
+          }
+        }
+        continue;
+      }
+
+      const int64_t* group_offsets = partition.group_offsets.data();
+      const int64_t* group_rows = partition.group_rows.data();
+
+      TypedBufferBuilder<int64_t> left_indices(pool), right_indices(pool);
+      for (int64_t i = 0; i < indices.length(); ++i) {
+        if (id_array->IsNull(i)) continue;
+        const uint32_t group_id = raw_ids[i];
+        matched[raw_indices[i]] = true;
+        for (int64_t j = group_offsets[group_id]; j < group_offsets[group_id + 1]; ++j) {
+          RETURN_NOT_OK(left_indices.Append(raw_indices[i]));
+          RETURN_NOT_OK(right_indices.Append(group_rows[j]));
+        }
+      }
+      if (left_indices.length() == 0) continue;
+
+      ARROW_ASSIGN_OR_RAISE(auto left_take, FinishIndices(&left_indices));
+      ARROW_ASSIGN_OR_RAISE(auto right_take, FinishIndices(&right_indices));
+      ARROW_ASSIGN_OR_RAISE(auto left_rows, TakeRows(batch, *left_take, ctx_));
+      ARROW_ASSIGN_OR_RAISE(auto right_rows,
+                            TakeRows(partition.rows, *right_take, ctx_));
+      for (auto& value : right_rows.values) {
+        left_rows.values.push_back(std::move(value));
+      }
+      pieces.push_back(std::move(left_rows));
+    }
+
+    if (join_type_ == JoinType::INNER) {
+      return ConcatenateBatches(pieces, output_descr_, pool);
+    }
+
+    // Select the left rows to emit without a right counterpart
+    const bool emit_matched = join_type_ == JoinType::LEFT_SEMI;
+    TypedBufferBuilder<int64_t> selected(pool);
+    for (int64_t i = 0; i < batch.length; ++i) {
+      if (matched[i] == emit_matched) {
+        RETURN_NOT_OK(selected.Append(i));
+      }
+    }
+    if (selected.length() == 0) {
+      return ConcatenateBatches(pieces, output_descr_, pool);
+    }
+
+    ExecBatch left_rows = batch;
+    if (selected.length() != batch.length) {
+      ARROW_ASSIGN_OR_RAISE(auto selection, FinishIndices(&selected));
+      ARROW_ASSIGN_OR_RAISE(left_rows, TakeRows(batch, *selection, ctx_));
+    }
+    if (join_type_ == JoinType::LEFT_OUTER) {
+      // Pad unmatched left rows with null right columns
+      for (const auto& descr : input_descrs_[1]) {
+        ARROW_ASSIGN_OR_RAISE(auto nulls,
+                              MakeArrayOfNull(descr.type, left_rows.length, pool));
+        left_rows.values.emplace_back(std::move(nulls));
+      }
+    }
+    pieces.push_back(std::move(left_rows));
+    return ConcatenateBatches(pieces, output_descr_, pool);
+  }
+
+  const JoinType join_type_;
+  const bool emit_right_;
+  const std::vector<int> left_keys_, right_keys_;
+  ExecContext* ctx_;
+
+  std::vector<std::unique_ptr<BuildPartition>> partitions_;
+
+  std::mutex mutex_;
+  std::vector<BuildBatch> build_batches_;
+  int build_received_ = 0;
+  int build_seq_stop_ = -1;
+  bool build_started_ = false;
+  bool build_ready_ = false;
+  std::vector<std::pair<int, ExecBatch>> pending_probe_;
+  bool probe_paused_ = false;
+  bool stopped_ = false;
+};
+
+}  // namespace
+
+Result<ExecNode*> MakeHashJoinNode(JoinType join_type, ExecNode* left_input,
+                                   ExecNode* right_input, std::string label,
+                                   std::vector<int> left_keys,
+                                   std::vector<int> right_keys, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  if (left_input->plan() != right_input->plan()) {
+    return Status::Invalid("Inputs of hash join node '", label,
+                           "' belong to different plans");
+  }
+  if (left_keys.empty() || left_keys.size() != right_keys.size()) {
+    return Status::Invalid("Hash join node '", label, "' expects an equal, non-zero ",
+                           "number of left and right keys (got ", left_keys.size(),
+                           " and ", right_keys.size(), ")");
+  }
+
+  const auto& left_descr = left_input->output_descr();
+  const auto& right_descr = right_input->output_descr();
+  for (const auto* descr : {&left_descr, &right_descr}) {
+    for (const auto& value_descr : *descr) {
+      if (value_descr.shape != ValueDescr::ARRAY) {
+        return Status::NotImplemented("Hash join of inputs with scalar columns");
+      }
+    }
+  }
+
+  for (size_t i = 0; i < left_keys.size(); ++i) {
+    if (left_keys[i] < 0 || left_keys[i] >= static_cast<int>(left_descr.size()) ||
+        right_keys[i] < 0 || right_keys[i] >= static_cast<int>(right_descr.size())) {
+      return Status::Invalid("Hash join key index out of bounds");
+    }
+    const auto& left_type = left_descr[left_keys[i]].type;
+    const auto& right_type = right_descr[right_keys[i]].type;
+    if (!left_type->Equals(*right_type)) {
+      return Status::TypeError("Hash join key types differ: ", *left_type, " vs ",
+                               *right_type);
+    }
+  }
+
+  ExecNode::BatchDescr output_descr = left_descr;
+  if (join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER) {
+    output_descr.insert(output_descr.end(), right_descr.begin(), right_descr.end());
+  }
+
+  int num_partitions = 1;
+  if (ctx->use_threads()) {
+    num_partitions = std::max(1, ::arrow::internal::GetCpuThreadPool()->GetCapacity());
+  }
+
+  auto node = left_input->plan()->EmplaceNode<HashJoinNode>(
+      left_input, right_input, std::move(label), std::move(output_descr), join_type,
+      std::move(left_keys), std::move(right_keys), ctx, num_partitions);
+  node->AddInput(left_input);
+  node->AddInput(right_input);
+  return node;
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -188,6 +188,31 @@ void SwissTable::lookup_1(const uint16_t* selection, const int num_keys,
   }
 }
 
+// Run the first-pass lookup for all keys, using the AVX2 variants when available.
+//
+void SwissTable::lookup_1_all(const int num_keys, const uint32_t* hashes,
+                              uint8_t* out_match_bitvector, uint32_t* out_groupids,
+                              uint32_t* out_slot_ids) {
+#if defined(ARROW_HAVE_AVX2)
+  if (hardware_flags_ & arrow::internal::CpuInfo::AVX2) {
+    if (log_blocks_ <= 4) {
+      int tail = num_keys % 32;
+      int delta = num_keys - tail;
+      lookup_1_avx2_x32(num_keys - tail, hashes, out_match_bitvector, out_groupids,
+                        out_slot_ids);
+      lookup_1_avx2_x8(tail, hashes + delta, out_match_bitvector + delta / 8,
+                       out_groupids + delta, out_slot_ids + delta);
+    } else {
+      lookup_1_avx2_x8(num_keys, hashes, out_match_bitvector, out_groupids,
+                       out_slot_ids);
+    }
+    return;
+  }
+#endif
+  lookup_1<false>(nullptr, num_keys, hashes, out_match_bitvector, out_groupids,
+                  out_slot_ids);
+}
+
 // How many groups we can keep in the hash table without the need for resizing.
 // When we reach this limit, we need to break processing of any further rows and resize.
 //
@@ -352,23 +377,7 @@ Status SwissTable::map(const int num_keys, const uint32_t* hashes,
   // First-pass processing.
   // Optimistically use simplified lookup involving only a start block to find
   // a single group id candidate for every input.
-#if defined(ARROW_HAVE_AVX2)
-  if (hardware_flags_ & arrow::internal::CpuInfo::AVX2) {
-    if (log_blocks_ <= 4) {
-      int tail = num_keys % 32;
-      int delta = num_keys - tail;
-      lookup_1_avx2_x32(num_keys - tail, hashes, match_bitvector, out_groupids, slot_ids);
-      lookup_1_avx2_x8(tail, hashes + delta, match_bitvector + delta / 8,
-                       out_groupids + delta, slot_ids + delta);
-    } else {
-      lookup_1_avx2_x8(num_keys, hashes, match_bitvector, out_groupids, slot_ids);
-    }
-  } else {
-#endif
-    lookup_1<false>(nullptr, num_keys, hashes, match_bitvector, out_groupids, slot_ids);
-#if defined(ARROW_HAVE_AVX2)
-  }
-#endif
+  lookup_1_all(num_keys, hashes, match_bitvector, out_groupids, slot_ids);
 
   int64_t num_matches =
       arrow::internal::CountSetBits(match_bitvector, /*offset=*/0, num_keys);
@@ -422,6 +431,93 @@ Status SwissTable::map(const int num_keys, const uint32_t* hashes,
   return Status::OK();
 }
 
+// Find group ids for keys which are already present, without inserting the others.
+// Only reads the table, so that concurrent calls are safe while nothing is being
+// inserted. Temporary vectors come from the caller's stack and key comparisons go
+// through the caller's callback rather than those given to init().
+//
+void SwissTable::find(const int num_keys, const uint32_t* hashes,
+                      uint8_t* out_match_bitvector, uint32_t* out_groupids,
+                      util::TempVectorStack* temp_stack, const EqualImpl& equal_impl) {
+  ARROW_DCHECK(num_keys <= (1 << log_minibatch_));
+
+  auto slot_ids_buf = util::TempVectorHolder<uint32_t>(temp_stack, num_keys);
+  uint32_t* slot_ids = slot_ids_buf.mutable_data();
+  auto ids_buf = util::TempVectorHolder<uint16_t>(temp_stack, num_keys);
+  uint16_t* ids = ids_buf.mutable_data();
+  auto ids_cmp_buf = util::TempVectorHolder<uint16_t>(temp_stack, num_keys);
+  uint16_t* ids_cmp = ids_cmp_buf.mutable_data();
+
+  lookup_1_all(num_keys, hashes, out_match_bitvector, out_groupids, slot_ids);
+
+  // Keys without a stamp match in their start block go on to the next block, keys with
+  // one are candidates for comparison. The match bit vector is rebuilt from the
+  // comparisons that succeed.
+  int num_ids_result;
+  util::BitUtil::bits_split_indexes(hardware_flags_, num_keys, out_match_bitvector,
+                                    &num_ids_result, ids, ids_cmp);
+  uint32_t num_ids = num_ids_result;
+  uint32_t num_cmp = num_keys - num_ids;
+  memset(out_match_bitvector, 0, (num_keys + 7) / 8);
+
+  uint64_t num_groupid_bits = num_groupid_bits_from_log_blocks(log_blocks_);
+  uint64_t groupid_mask = (1ULL << num_groupid_bits) - 1;
+  constexpr uint64_t stamp_mask = 0x7f;
+  uint64_t num_block_bytes = (8 + num_groupid_bits);
+
+  for (;;) {
+    for (uint32_t i = 0; i < num_cmp; ++i) {
+      int id = util::SafeLoad(&ids_cmp[i]);
+      out_match_bitvector[id / 8] |= 1 << (id & 7);
+    }
+    uint32_t num_not_equal;
+    equal_impl(num_cmp, ids_cmp, out_groupids, &num_not_equal, ids + num_ids);
+    for (uint32_t i = num_ids; i < num_ids + num_not_equal; ++i) {
+      int id = util::SafeLoad(&ids[i]);
+      out_match_bitvector[id / 8] &= static_cast<uint8_t>(~(1 << (id & 7)));
+    }
+    num_ids += num_not_equal;
+    if (num_ids == 0) {
+      break;
+    }
+
+    // A single round of search, as in lookup_2, except that reaching an empty slot
+    // means the key is absent.
+    uint32_t num_next = 0;
+    num_cmp = 0;
+    for (uint32_t i = 0; i < num_ids; ++i) {
+      int id = util::SafeLoad(&ids[i]);
+
+      uint64_t slot_id = wrap_global_slot_id(util::SafeLoad(&slot_ids[id]));
+      uint64_t block_id = slot_id >> 3;
+      uint32_t hash = hashes[id];
+      const uint8_t* blockbase = blocks_ + num_block_bytes * block_id;
+      uint64_t block = util::SafeLoadAs<uint64_t>(blockbase);
+      uint64_t stamp = (hash >> (bits_hash_ - log_blocks_ - bits_stamp_)) & stamp_mask;
+      int start_slot = (slot_id & 7);
+
+      if (blockbase[7 - start_slot] == 0x80) {
+        continue;
+      }
+
+      int new_match_found;
+      int new_slot;
+      search_block<true>(block, static_cast<int>(stamp), start_slot, &new_slot,
+                         &new_match_found);
+      util::SafeStore(&out_groupids[id], static_cast<uint32_t>(extract_group_id(
+                                             blockbase, new_slot, groupid_mask)));
+      util::SafeStore(&slot_ids[id], static_cast<uint32_t>(next_slot_to_visit(
+                                         block_id, new_slot, new_match_found)));
+      if (new_match_found) {
+        util::SafeStore(&ids_cmp[num_cmp++], static_cast<uint16_t>(id));
+      } else {
+        util::SafeStore(&ids[num_next++], static_cast<uint16_t>(id));
+      }
+    }
+    num_ids = num_next;
+  }
+}
+
 Status SwissTable::grow_double() {
   // Before and after metadata
   int num_group_id_bits_before = num_groupid_bits_from_log_blocks(log_blocks_);
@@ -44,6 +44,16 @@ class SwissTable {
 
   Status map(const int ckeys, const uint32_t* hashes, uint32_t* outgroupids);
 
+  /// \brief Find group ids of keys already in the table, without inserting new keys.
+  ///
+  /// Sets the bit of every key found in out_match_bitvector and its group id in
+  /// out_groupids. The table is only read, so that concurrent calls are safe as long
+  /// as map() is not running. Temporary vectors are taken from temp_stack and keys
+  /// are compared using equal_impl rather than the callbacks given to init().
+  void find(const int num_keys, const uint32_t* hashes, uint8_t* out_match_bitvector,
+            uint32_t* out_groupids, util::TempVectorStack* temp_stack,
+            const EqualImpl& equal_impl);
+
  private:
   // Lookup helpers
 
@@ -99,6 +109,9 @@ class SwissTable {
   void lookup_1(const uint16_t* selection, const int num_keys, const uint32_t* hashes,
                 uint8_t* out_match_bitvector, uint32_t* out_group_ids,
                 uint32_t* out_slot_ids);
+  void lookup_1_all(const int num_keys, const uint32_t* hashes,
+                    uint8_t* out_match_bitvector, uint32_t* out_group_ids,
+                    uint32_t* out_slot_ids);
 #if defined(ARROW_HAVE_AVX2)
   void lookup_1_avx2_x8(const int num_hashes, const uint32_t* hashes,
                         uint8_t* out_match_bitvector, uint32_t* out_group_ids,
@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/datum.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+namespace {
+
+Status ValidateInputSchema(const ExecNode& input, const Schema& input_schema) {
+  const auto& descr = input.output_descr();
+  bool matches = static_cast<int>(descr.size()) == input_schema.num_fields();
+  for (size_t i = 0; matches && i < descr.size(); ++i) {
+    matches = descr[i].type->Equals(*input_schema.field(static_cast<int>(i))->type());
+  }
+  if (!matches) {
+    return Status::Invalid("Schema ", input_schema.ToString(),
+                           " does not describe the output of node '", input.label(),
+                           "'");
+  }
+  return Status::OK();
+}
+
+// A node which transforms each input batch into exactly one output batch with the
+// same sequence number.  If the ExecContext allows threading, batches are transformed
+// on the CPU thread pool.
+struct MapNode : ExecNode {
+  MapNode(ExecNode* input, std::string label, BatchDescr output_descr,
+          std::shared_ptr<Schema> input_schema, ExecContext* ctx)
+      : ExecNode(input->plan(), std::move(label), {input->output_descr()}, {"target"},
+                 std::move(output_descr), /*num_outputs=*/1),
+        input_schema_(std::move(input_schema)),
+        ctx_(ctx) {}
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (!ctx_->use_threads()) {
+      MapAndEmit(seq_num, batch);
+      return;
+    }
+
+    auto plan = this->plan()->shared_from_this();
+    auto maybe_future = ::arrow::internal::GetCpuThreadPool()->Submit(
+        [plan, this, seq_num, batch] { MapAndEmit(seq_num, batch); });
+    if (!maybe_future.ok()) {
+      ErrorReceived(input, maybe_future.status());
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    StopProducing();
+  }
+
+  void InputFinished(ExecNode* input, int seq_stop) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->InputFinished(this, seq_stop);
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void PauseProducing(ExecNode* output) override { inputs_[0]->PauseProducing(this); }
+
+  void ResumeProducing(ExecNode* output) override { inputs_[0]->ResumeProducing(this); }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) return;
+      stopped_ = true;
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+ protected:
+  virtual Result<ExecBatch> Map(const ExecBatch& batch) = 0;
+
+  // Expressions reference fields by name, so view the batch through the input schema
+  Result<std::shared_ptr<RecordBatch>> ToRecordBatch(const ExecBatch& batch) const {
+    ArrayVector columns(batch.values.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const Datum& value = batch.values[i];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(columns[i], MakeArrayFromScalar(*value.scalar(),
+                                                              batch.length,
+                                                              ctx_->memory_pool()));
+      } else {
+        columns[i] = value.make_array();
+      }
+    }
+    return RecordBatch::Make(input_schema_, batch.length, std::move(columns));
+  }
+
+  const std::shared_ptr<Schema> input_schema_;
+  ExecContext* ctx_;
+
+ private:
+  void MapAndEmit(int seq_num, const ExecBatch& batch) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) return;
+    }
+    auto maybe_mapped = Map(batch);
+    if (!maybe_mapped.ok()) {
+      ErrorReceived(inputs_[0], maybe_mapped.status());
+      return;
+    }
+    outputs_[0]->InputReceived(this, seq_num, maybe_mapped.MoveValueUnsafe());
+  }
+
+  std::mutex mutex_;
+  bool stopped_ = false;
+};
+
+struct FilterNode : MapNode {
+  FilterNode(ExecNode* input, std::string label, std::shared_ptr<Schema> input_schema,
+             Expression filter, ExecContext* ctx)
+      : MapNode(input, std::move(label), input->output_descr(), std::move(input_schema),
+                ctx),
+        filter_(std::move(filter)) {}
+
+  const char* kind_name() override { return "FilterNode"; }
+
+ protected:
+  Result<ExecBatch> Map(const ExecBatch& batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, ToRecordBatch(batch));
+    ARROW_ASSIGN_OR_RAISE(Datum mask,
+                          ExecuteScalarExpression(filter_, record_batch, ctx_));
+
+    if (mask.is_scalar()) {
+      const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
+      if (mask_scalar.is_valid && mask_scalar.value) {
+        return batch;
+      }
+      return ExecBatch(*record_batch->Slice(0, 0));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Datum filtered, Filter(record_batch, mask,
+                                                 FilterOptions::Defaults(), ctx_));
+    return ExecBatch(*filtered.record_batch());
+  }
+
+ private:
+  const Expression filter_;
+};
+
+struct ProjectNode : MapNode {
+  ProjectNode(ExecNode* input, std::string label, BatchDescr output_descr,
+              std::shared_ptr<Schema> input_schema, std::vector<Expression> exprs,
+              ExecContext* ctx)
+      : MapNode(input, std::move(label), std::move(output_descr),
+                std::move(input_schema), ctx),
+        exprs_(std::move(exprs)) {}
+
+  const char* kind_name() override { return "ProjectNode"; }
+
+ protected:
+  Result<ExecBatch> Map(const ExecBatch& batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, ToRecordBatch(batch));
+    std::vector<Datum> values(exprs_.size());
+    for (size_t i = 0; i < exprs_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(values[i],
+                            ExecuteScalarExpression(exprs_[i], record_batch, ctx_));
+    }
+    return ExecBatch(std::move(values), batch.length);
+  }
+
+ private:
+  const std::vector<Expression> exprs_;
+};
+
+}  // namespace
+
+Result<ExecNode*> MakeFilterNode(ExecNode* input, std::string label,
+                                 std::shared_ptr<Schema> input_schema, Expression filter,
+                                 ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  RETURN_NOT_OK(ValidateInputSchema(*input, *input_schema));
+
+  ARROW_ASSIGN_OR_RAISE(filter, filter.Bind(*input_schema, ctx));
+  if (filter.type()->id() != Type::BOOL) {
+    return Status::TypeError("Filter expression must evaluate to bool, but ",
+                             filter.ToString(), " evaluates to ",
+                             filter.type()->ToString());
+  }
+
+  auto node = input->plan()->EmplaceNode<FilterNode>(
+      input, std::move(label), std::move(input_schema), std::move(filter), ctx);
+  node->AddInput(input);
+  return node;
+}
+
+Result<ExecNode*> MakeProjectNode(ExecNode* input, std::string label,
+                                  std::shared_ptr<Schema> input_schema,
+                                  std::vector<Expression> exprs, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  RETURN_NOT_OK(ValidateInputSchema(*input, *input_schema));
+
+  ExecNode::BatchDescr output_descr(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(exprs[i], exprs[i].Bind(*input_schema, ctx));
+    output_descr[i] = exprs[i].descr();
+  }
+
+  auto node = input->plan()->EmplaceNode<ProjectNode>(
+      input, std::move(label), std::move(output_descr), std::move(input_schema),
+      std::move(exprs), ctx);
+  node->AddInput(input);
+  return node;
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -20,9 +20,14 @@
 #include <functional>
 #include <memory>
 
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/expression.h"
 #include "arrow/compute/exec/test_util.h"
 #include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -285,7 +290,7 @@ static Result<RecordBatchGenerator> MakeSlowRecordBatchGenerator(
 class TestExecPlanExecution : public ::testing::Test {
  public:
   void SetUp() override {
-    ASSERT_OK_AND_ASSIGN(io_executor_, internal::ThreadPool::Make(8));
+    ASSERT_OK_AND_ASSIGN(io_executor_, ::arrow::internal::ThreadPool::Make(8));
   }
 
   RecordBatchVector MakeRandomBatches(const std::shared_ptr<Schema>& schema,
@@ -369,7 +374,91 @@ class TestExecPlanExecution : public ::testing::Test {
     AssertBatchesEqual(batches, got_batches);
   }
 
+  Result<RecordBatchVector> HashJoin(JoinType join_type, const RecordBatchVector& left,
+                                     const RecordBatchVector& right,
+                                     const std::shared_ptr<Schema>& out_schema,
+                                     ExecContext* ctx) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+    ARROW_ASSIGN_OR_RAISE(auto left_reader, RecordBatchReader::Make(left));
+    ARROW_ASSIGN_OR_RAISE(auto right_reader, RecordBatchReader::Make(right));
+    auto left_source =
+        MakeRecordBatchReaderNode(plan.get(), "left", left_reader, io_executor_.get());
+    auto right_source =
+        MakeRecordBatchReaderNode(plan.get(), "right", right_reader, io_executor_.get());
+    ARROW_ASSIGN_OR_RAISE(auto join,
+                          MakeHashJoinNode(join_type, left_source, right_source, "join",
+                                           /*left_keys=*/{0}, /*right_keys=*/{0}, ctx));
+    auto sink = MakeRecordBatchCollectNode(plan.get(), "sink", out_schema);
+    sink->AddInput(join);
+    RETURN_NOT_OK(plan->Validate());
+    return StartAndCollect(plan.get(), sink);
+  }
+
+  void TestHashJoin(JoinType join_type, const std::vector<std::string>& expected_json) {
+    auto left_schema = schema({field("l_key", int32()), field("l_str", utf8())});
+    auto right_schema = schema({field("r_key", int32()), field("r_val", int32())});
+    RecordBatchVector left{
+        RecordBatchFromJSON(left_schema, R"([[1, "a"], [2, "b"], [null, "c"]])"),
+        RecordBatchFromJSON(left_schema, R"([[3, "d"], [1, "e"]])"),
+    };
+    RecordBatchVector right{
+        RecordBatchFromJSON(right_schema, R"([[1, 10], [3, 30]])"),
+        RecordBatchFromJSON(right_schema, R"([[1, 11], [4, 40], [null, 50]])"),
+    };
+
+    auto out_schema = left_schema;
+    if (join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER) {
+      out_schema = schema({left_schema->field(0), left_schema->field(1),
+                           right_schema->field(0), right_schema->field(1)});
+    }
+    RecordBatchVector expected;
+    for (const auto& json : expected_json) {
+      expected.push_back(RecordBatchFromJSON(out_schema, json));
+    }
+
+    // A single partition makes the order of output rows deterministic
+    ExecContext ctx;
+    ctx.set_use_threads(false);
+    ASSERT_OK_AND_ASSIGN(auto got_batches,
+                         HashJoin(join_type, left, right, out_schema, &ctx));
+    AssertBatchesEqual(expected, got_batches);
+  }
+
  protected:
+  // Run a group by on the first column, returning its output as a single batch
+  // sorted by key
+  Result<std::shared_ptr<RecordBatch>> GroupBy(
+      const RecordBatchVector& batches, std::vector<int> arguments,
+      std::vector<internal::Aggregate> aggregates,
+      const std::shared_ptr<Schema>& out_schema) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+    ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchReader::Make(batches));
+    auto source =
+        MakeRecordBatchReaderNode(plan.get(), "source", reader, io_executor_.get());
+    ARROW_ASSIGN_OR_RAISE(auto group_by,
+                          MakeGroupByNode(source, "groupby", /*keys=*/{0},
+                                          std::move(arguments), std::move(aggregates)));
+    auto sink = MakeRecordBatchCollectNode(plan.get(), "sink", out_schema);
+    sink->AddInput(group_by);
+    RETURN_NOT_OK(plan->Validate());
+    ARROW_ASSIGN_OR_RAISE(auto got_batches, StartAndCollect(plan.get(), sink));
+    return SortByLastColumn(got_batches, out_schema);
+  }
+
+  static Result<std::shared_ptr<RecordBatch>> SortByLastColumn(
+      const RecordBatchVector& batches, const std::shared_ptr<Schema>& schema) {
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema, batches));
+    ARROW_ASSIGN_OR_RAISE(table, table->CombineChunks());
+    ArrayVector columns;
+    for (const auto& column : table->columns()) {
+      columns.push_back(column->chunk(0));
+    }
+    auto batch = RecordBatch::Make(schema, table->num_rows(), std::move(columns));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(*batch->columns().back()));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted, Take(batch, indices));
+    return sorted.record_batch();
+  }
+
   std::shared_ptr<Executor> io_executor_;
 };
 
@@ -396,5 +485,226 @@ TEST_F(TestExecPlanExecution, StressSlowSourceSinkParallel) {
   TestStressSourceSink(/*num_batches=*/300, MakeSlowRecordBatchGenerator);
 }
 
+TEST_F(TestExecPlanExecution, FilterProject) {
+  auto in_schema = schema({field("a", int32()), field("b", boolean())});
+  RecordBatchVector batches{
+      RecordBatchFromJSON(in_schema, R"([[null, true], [4, false], [5, null]])"),
+      RecordBatchFromJSON(in_schema, R"([[6, false], [7, false], [8, true]])"),
+      RecordBatchFromJSON(in_schema, R"([[3, true]])"),
+  };
+  auto out_schema = schema({field("a_plus_one", int32()), field("b", boolean())});
+
+  for (bool use_threads : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches));
+    auto source =
+        MakeRecordBatchReaderNode(plan.get(), "source", reader, io_executor_.get());
+    ASSERT_OK_AND_ASSIGN(auto filter,
+                         MakeFilterNode(source, "filter", in_schema,
+                                        greater(field_ref("a"), literal(4)), &ctx));
+    ASSERT_OK_AND_ASSIGN(
+        auto project,
+        MakeProjectNode(filter, "project", in_schema,
+                        {call("add", {field_ref("a"), literal(1)}), field_ref("b")},
+                        &ctx));
+    auto sink = MakeRecordBatchCollectNode(plan.get(), "sink", out_schema);
+    sink->AddInput(project);
+    ASSERT_OK(plan->Validate());
+
+    ASSERT_OK_AND_ASSIGN(auto got_batches, StartAndCollect(plan.get(), sink));
+    AssertBatchesEqual(
+        {
+            RecordBatchFromJSON(out_schema, R"([[6, null]])"),
+            RecordBatchFromJSON(out_schema, R"([[7, false], [8, false], [9, true]])"),
+            RecordBatchFromJSON(out_schema, R"([])"),
+        },
+        got_batches);
+  }
+}
+
+TEST_F(TestExecPlanExecution, HashLeftSemiJoin) {
+  TestHashJoin(JoinType::LEFT_SEMI, {R"([[1, "a"]])", R"([[3, "d"], [1, "e"]])"});
+}
+
+TEST_F(TestExecPlanExecution, HashLeftAntiJoin) {
+  TestHashJoin(JoinType::LEFT_ANTI, {R"([[2, "b"], [null, "c"]])", R"([])"});
+}
+
+TEST_F(TestExecPlanExecution, HashInnerJoin) {
+  TestHashJoin(JoinType::INNER,
+               {R"([[1, "a", 1, 10], [1, "a", 1, 11]])",
+                R"([[3, "d", 3, 30], [1, "e", 1, 10], [1, "e", 1, 11]])"});
+}
+
+TEST_F(TestExecPlanExecution, HashLeftOuterJoin) {
+  TestHashJoin(JoinType::LEFT_OUTER,
+               {R"([[1, "a", 1, 10], [1, "a", 1, 11],
+                    [2, "b", null, null], [null, "c", null, null]])",
+                R"([[3, "d", 3, 30], [1, "e", 1, 10], [1, "e", 1, 11]])"});
+}
+
+TEST_F(TestExecPlanExecution, HashLeftSemiJoinDictionaryKeys) {
+  // Every batch has its own dictionary, so keys must be matched by value
+  auto type = dictionary(int32(), utf8());
+  auto schema = ::arrow::schema({field("key", type)});
+  auto MakeBatch = [&](const std::string& indices, const std::string& dictionary) {
+    auto array = *DictionaryArray::FromArrays(type, ArrayFromJSON(int32(), indices),
+                                              ArrayFromJSON(utf8(), dictionary));
+    return RecordBatch::Make(schema, array->length(), {array});
+  };
+  RecordBatchVector left{MakeBatch("[0, 1, 2, null]", R"(["a", "b", "c"])"),
+                         MakeBatch("[2, 1, 0]", R"(["b", "c", "d"])")};
+  RecordBatchVector right{MakeBatch("[0, 1]", R"(["c", "b"])"),
+                          MakeBatch("[0, null]", R"(["x"])")};
+  RecordBatchVector expected{MakeBatch("[1, 2]", R"(["a", "b", "c"])"),
+                             MakeBatch("[1, 0]", R"(["b", "c", "d"])")};
+
+  for (bool use_threads : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+    ASSERT_OK_AND_ASSIGN(auto got,
+                         HashJoin(JoinType::LEFT_SEMI, left, right, schema, &ctx));
+    AssertBatchesEqual(expected, got);
+  }
+}
+
+TEST_F(TestExecPlanExecution, StressHashLeftSemiJoinParallel) {
+  // Semi join output preserves the order of left rows, so the partitioned
+  // (threaded) join must exactly match the single-partition one
+  auto schema = ::arrow::schema({field("a", int32()), field("b", boolean())});
+  auto left = MakeRandomBatches(schema, /*num_batches=*/50, /*batch_size=*/100);
+  auto right = MakeRandomBatches(schema, /*num_batches=*/20, /*batch_size=*/10);
+
+  ExecContext serial_ctx, threaded_ctx;
+  serial_ctx.set_use_threads(false);
+  threaded_ctx.set_use_threads(true);
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       HashJoin(JoinType::LEFT_SEMI, left, right, schema, &serial_ctx));
+  ASSERT_OK_AND_ASSIGN(auto got,
+                       HashJoin(JoinType::LEFT_SEMI, left, right, schema, &threaded_ctx));
+  AssertBatchesEqual(expected, got);
+}
+
+TEST_F(TestExecPlanExecution, GroupBy) {
+  auto in_schema = schema({field("key", int32()), field("value", int32())});
+  RecordBatchVector batches{
+      RecordBatchFromJSON(in_schema, R"([[1, 10], [2, null], [1, 3]])"),
+      RecordBatchFromJSON(in_schema, R"([[null, 7], [2, 5], [3, null]])"),
+      RecordBatchFromJSON(in_schema, R"([[1, -4], [null, 1], [3, null]])"),
+      RecordBatchFromJSON(in_schema, R"([])"),
+  };
+  auto out_schema = schema({field("hash_sum", int64()), field("hash_count", int64()),
+                            field("hash_min_max", struct_({field("min", int32()),
+                                                           field("max", int32())})),
+                            field("key_0", int32())});
+
+  ASSERT_OK_AND_ASSIGN(auto got, GroupBy(batches, /*arguments=*/{1, 1, 1},
+                                         {{"hash_sum", nullptr},
+                                          {"hash_count", nullptr},
+                                          {"hash_min_max", nullptr}},
+                                         out_schema));
+  AssertBatchesEqual(*RecordBatchFromJSON(out_schema, R"([
+    [9,    3, {"min": -4,   "max": 10},   1],
+    [5,    1, {"min": 5,    "max": 5},    2],
+    [null, 0, {"min": null, "max": null}, 3],
+    [8,    2, {"min": 1,    "max": 7},    null]
+  ])"),
+                     *got);
+}
+
+TEST_F(TestExecPlanExecution, StressGroupByParallel) {
+  // Batches are delivered by several threads, so partial aggregations are merged;
+  // the result must match a one-shot aggregation of the whole input
+  auto in_schema = schema({field("key", int8()), field("value", int32())});
+  auto batches = MakeRandomBatches(in_schema, /*num_batches=*/100, /*batch_size=*/50);
+  auto out_schema = schema({field("hash_sum", int64()), field("hash_count", int64()),
+                            field("hash_min_max", struct_({field("min", int32()),
+                                                           field("max", int32())})),
+                            field("key_0", int8())});
+  std::vector<internal::Aggregate> aggregates{
+      {"hash_sum", nullptr}, {"hash_count", nullptr}, {"hash_min_max", nullptr}};
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(in_schema, batches));
+  ASSERT_OK_AND_ASSIGN(Datum expected_struct,
+                       internal::GroupBy({table->column(1), table->column(1),
+                                          table->column(1)},
+                                         {table->column(0)}, aggregates));
+  ASSERT_OK_AND_ASSIGN(auto expected_batch,
+                       RecordBatch::FromStructArray(expected_struct.make_array()));
+  ASSERT_OK_AND_ASSIGN(
+      auto expected,
+      SortByLastColumn({expected_batch}, out_schema));
+
+  ASSERT_OK_AND_ASSIGN(auto got,
+                       GroupBy(batches, /*arguments=*/{1, 1, 1}, aggregates, out_schema));
+  AssertBatchesEqual(*expected, *got);
+}
+
+TEST_F(TestExecPlanExecution, StressGroupByParallelStatistics) {
+  // As above, for aggregations whose partial states are combined by more than
+  // adding them up; mean and variance may differ slightly in the last bits
+  auto in_schema = schema(
+      {field("key", int8()), field("value", int32()), field("flag", boolean())});
+  auto batches = MakeRandomBatches(in_schema, /*num_batches=*/100, /*batch_size=*/50);
+  auto out_schema = schema({field("hash_mean", float64()),
+                            field("hash_variance", float64()),
+                            field("hash_count_distinct", int64()),
+                            field("hash_any", boolean()), field("hash_all", boolean()),
+                            field("hash_tdigest", fixed_size_list(float64(), 1)),
+                            field("key_0", int8())});
+  std::vector<internal::Aggregate> aggregates{
+      {"hash_mean", nullptr}, {"hash_variance", nullptr},
+      {"hash_count_distinct", nullptr}, {"hash_any", nullptr},
+      {"hash_all", nullptr}, {"hash_tdigest", nullptr}};
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(in_schema, batches));
+  ASSERT_OK_AND_ASSIGN(
+      Datum expected_struct,
+      internal::GroupBy({table->column(1), table->column(1), table->column(1),
+                         table->column(2), table->column(2), table->column(1)},
+                        {table->column(0)}, aggregates));
+  ASSERT_OK_AND_ASSIGN(auto expected_batch,
+                       RecordBatch::FromStructArray(expected_struct.make_array()));
+  ASSERT_OK_AND_ASSIGN(auto expected, SortByLastColumn({expected_batch}, out_schema));
+
+  ASSERT_OK_AND_ASSIGN(auto got, GroupBy(batches, /*arguments=*/{1, 1, 1, 2, 2, 1},
+                                         aggregates, out_schema));
+  AssertBatchesApproxEqual(*expected, *got);
+}
+
+TEST(ExecPlanConstruction, GroupByInvalidKey) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  auto source = MakeDummyNode(plan.get(), "source", /*num_inputs=*/0, /*num_outputs=*/1);
+  ASSERT_RAISES(Invalid, MakeGroupByNode(source, "groupby", /*keys=*/{}, {}, {}));
+  ASSERT_RAISES(Invalid, MakeGroupByNode(source, "groupby", /*keys=*/{1}, {}, {}));
+}
+
+TEST(ExecPlanConstruction, FilterProjectErrors) {
+  auto in_schema = schema({field("a", int32())});
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({}, in_schema));
+  auto source = MakeRecordBatchReaderNode(plan.get(), "source", reader,
+                                          ::arrow::internal::GetCpuThreadPool());
+
+  // The filter must be boolean
+  ASSERT_RAISES(TypeError, MakeFilterNode(source, "filter", in_schema, field_ref("a")));
+  // The schema must match the input
+  ASSERT_RAISES(Invalid, MakeFilterNode(source, "filter", schema({field("a", utf8())}),
+                                        literal(true)));
+}
+
+TEST(ExecPlanConstruction, HashJoinKeyMismatch) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  auto left = MakeDummyNode(plan.get(), "left", /*num_inputs=*/0, /*num_outputs=*/1);
+  auto right = MakeDummyNode(plan.get(), "right", /*num_inputs=*/0, /*num_outputs=*/1);
+  ASSERT_RAISES(Invalid, MakeHashJoinNode(JoinType::INNER, left, right, "join",
+                                          /*left_keys=*/{0}, /*right_keys=*/{}));
+  ASSERT_RAISES(Invalid, MakeHashJoinNode(JoinType::INNER, left, right, "join",
+                                          /*left_keys=*/{1}, /*right_keys=*/{0}));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -284,9 +284,6 @@ struct RecordBatchCollectNodeImpl : public RecordBatchCollectNode {
       DCHECK_EQ(received_batches_[num_emitted_], nullptr);
       return;
     }
-    if (num_received_ == emit_stop_) {
-      StopProducingUnlocked();
-    }
 
     // Emit batches in order as far as possible
     // First collect these batches, then unlock before producing.
@@ -310,6 +307,11 @@ struct RecordBatchCollectNodeImpl : public RecordBatchCollectNode {
 
     DCHECK_EQ(seq_start, num_emitted_);  // num_emitted_ wasn't bumped in the meantime
     num_emitted_ = seq_num;
+
+    // Only close the producer once the last batches were pushed
+    if (num_emitted_ == emit_stop_) {
+      StopProducingUnlocked();
+    }
   }
 
   void ErrorReceived(ExecNode* input, Status error) override {
@@ -324,8 +326,7 @@ struct RecordBatchCollectNodeImpl : public RecordBatchCollectNode {
     DCHECK_GE(seq_stop, static_cast<int>(received_batches_.size()));
     received_batches_.reserve(seq_stop);
     emit_stop_ = seq_stop;
-    if (emit_stop_ == num_received_) {
-      DCHECK_EQ(emit_stop_, num_emitted_);
+    if (emit_stop_ == num_emitted_) {
       StopProducingUnlocked();
     }
   }
@@ -392,7 +393,7 @@ ExecNode* MakeDummyNode(ExecPlan* plan, std::string label, int num_inputs,
 
 RecordBatchCollectNode* MakeRecordBatchCollectNode(
     ExecPlan* plan, std::string label, const std::shared_ptr<Schema>& schema) {
-  return internal::checked_cast<RecordBatchCollectNode*>(
+  return ::arrow::internal::checked_cast<RecordBatchCollectNode*>(
       plan->EmplaceNode<RecordBatchCollectNodeImpl>(plan, std::move(label), schema));
 }
 
@@ -232,5 +232,13 @@ bool BitUtil::are_all_bytes_zero(int64_t hardware_flags, const uint8_t* bytes,
   return result_or == 0;
 }
 
+size_t ThreadIndexer::operator()() {
+  auto id = std::this_thread::get_id();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto& id_index = *id_to_index_.emplace(id, id_to_index_.size()).first;
+  return id_index.second;
+}
+
 }  // namespace util
 }  // namespace arrow
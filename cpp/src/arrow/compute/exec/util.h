@@ -18,6 +18,9 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -169,5 +172,16 @@ class BitUtil {
 #endif
 };
 
+/// Assigns a small, dense index to each thread calling it, in order of first
+/// call.  Useful to select a thread local state among a growable collection.
+class ThreadIndexer {
+ public:
+  size_t operator()();
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::thread::id, size_t> id_to_index_;
+};
+
 }  // namespace util
 }  // namespace arrow
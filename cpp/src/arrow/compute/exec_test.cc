@@ -15,8 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
 #include <cstring>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -625,6 +627,20 @@ Status ExecStateful(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   return Status::OK();
 }
 
+Status ExecSwapState(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  // Point the context at a state local to this call while executing, like
+  // match_like does, and check that no concurrent call changed it meanwhile
+  KernelState* original_state = ctx->state();
+  ExampleState local_state(static_cast<ExampleState*>(original_state)->value);
+  ctx->SetState(&local_state);
+  std::this_thread::sleep_for(std::chrono::microseconds(100));
+  Status status = ctx->state() == &local_state
+                      ? ExecStateful(ctx, batch, out)
+                      : Status::Invalid("Kernel state changed concurrently");
+  ctx->SetState(original_state);
+  return status;
+}
+
 Status ExecAddInt32(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   const Int32Scalar& arg0 = batch[0].scalar_as<Int32Scalar>();
   const Int32Scalar& arg1 = batch[1].scalar_as<Int32Scalar>();
@@ -704,6 +720,13 @@ class TestCallScalarFunction : public TestComputeInternals {
     ScalarKernel kernel({InputType::Array(int32())}, int32(), ExecStateful, InitStateful);
     ASSERT_OK(func->AddKernel(kernel));
     ASSERT_OK(registry->AddFunction(func));
+
+    // A version which swaps the state of its context while executing
+    func = std::make_shared<ScalarFunction>("test_swap_state", Arity::Unary(),
+                                            /*doc=*/nullptr);
+    kernel.exec = ExecSwapState;
+    ASSERT_OK(func->AddKernel(kernel));
+    ASSERT_OK(registry->AddFunction(func));
   }
 
   void AddScalarFunction() {
@@ -837,6 +860,49 @@ TEST_F(TestCallScalarFunction, BasicNonStandardCases) {
   CheckFunction("test_nopre_validity_or_data");
 }
 
+TEST_F(TestCallScalarFunction, ParallelExecution) {
+  // Large enough to be split into several tasks, with chunk lengths that are
+  // not multiples of 8 so that tasks must not share bitmap bytes of the output
+  auto arr = GetUInt8Array(1 << 17, /*null_probability=*/0.2);
+  std::vector<std::shared_ptr<Array>> chunks;
+  for (int64_t offset = 0; offset < arr->length(); offset += 3001) {
+    chunks.push_back(arr->Slice(offset, 3001));
+  }
+  auto carr = std::make_shared<ChunkedArray>(std::move(chunks));
+
+  auto CheckFunction = [&](std::string func_name) {
+    for (bool preallocate_contiguous : {true, false}) {
+      ARROW_SCOPED_TRACE("preallocate_contiguous = ", preallocate_contiguous);
+      ExecContext serial_ctx, threaded_ctx;
+      serial_ctx.set_use_threads(false);
+      serial_ctx.set_preallocate_contiguous(preallocate_contiguous);
+      threaded_ctx.set_use_threads(true);
+      threaded_ctx.set_preallocate_contiguous(preallocate_contiguous);
+
+      for (const Datum& arg : {Datum(arr), Datum(carr)}) {
+        serial_ctx.set_exec_chunksize(arg.is_array() ? 1021 : kDefaultMaxChunksize);
+        threaded_ctx.set_exec_chunksize(serial_ctx.exec_chunksize());
+        ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, {arg}, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, {arg}, &threaded_ctx));
+        // Chunks of output are emitted in order
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+        if (actual.is_array()) {
+          ASSERT_OK(actual.make_array()->ValidateFull());
+          AssertArraysEqual(*arr, *actual.make_array());
+        } else {
+          ASSERT_OK(actual.chunked_array()->ValidateFull());
+          AssertChunkedEquivalent(*carr, *actual.chunked_array());
+        }
+      }
+    }
+  };
+
+  CheckFunction("test_copy");
+  CheckFunction("test_copy_computed_bitmap");
+  CheckFunction("test_nopre_data");
+  CheckFunction("test_nopre_validity_or_data");
+}
+
 TEST_F(TestCallScalarFunction, StatefulKernel) {
   auto input = ArrayFromJSON(int32(), "[1, 2, 3, null, 5]");
   auto multiplier = std::make_shared<Int32Scalar>(2);
@@ -848,6 +914,22 @@ TEST_F(TestCallScalarFunction, StatefulKernel) {
   AssertArraysEqual(*expected, *result.make_array());
 }
 
+TEST_F(TestCallScalarFunction, StatefulKernelParallelExecution) {
+  // Tasks executing in parallel each have their own kernel context
+  auto input = GetInt32Chunked(std::vector<int>(8, 20000));
+  ExampleOptions options(std::make_shared<Int32Scalar>(2));
+  ExecContext serial_ctx, threaded_ctx;
+  serial_ctx.set_use_threads(false);
+  threaded_ctx.set_use_threads(true);
+  ASSERT_OK_AND_ASSIGN(Datum expected,
+                       CallFunction("test_stateful", {input}, &options, &serial_ctx));
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("test_swap_state", {input}, &options,
+                                                    &threaded_ctx));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
 TEST_F(TestCallScalarFunction, ScalarFunction) {
   std::vector<Datum> args = {Datum(std::make_shared<Int32Scalar>(5)),
                              Datum(std::make_shared<Int32Scalar>(7))};
@@ -858,6 +940,66 @@ TEST_F(TestCallScalarFunction, ScalarFunction) {
   ASSERT_TRUE(expected->Equals(*result.scalar()));
 }
 
+class TestCallVectorFunction : public TestComputeInternals {
+ protected:
+  static bool initialized_;
+
+  void SetUp() {
+    TestComputeInternals::SetUp();
+
+    if (!initialized_) {
+      initialized_ = true;
+      AddChunkwiseFunction();
+    }
+  }
+
+  void AddChunkwiseFunction() {
+    auto registry = GetFunctionRegistry();
+
+    // A stateful vector function executing chunk by chunk, which swaps the
+    // state of its context while executing
+    auto func = std::make_shared<VectorFunction>("test_vector_swap_state",
+                                                 Arity::Unary(), /*doc=*/nullptr);
+    VectorKernel kernel({InputType::Array(int32())}, int32(), ExecSwapState,
+                        InitStateful);
+    kernel.null_handling = NullHandling::INTERSECTION;
+    kernel.mem_allocation = MemAllocation::PREALLOCATE;
+    ASSERT_OK(func->AddKernel(kernel));
+    ASSERT_OK(registry->AddFunction(func));
+  }
+};
+
+bool TestCallVectorFunction::initialized_ = false;
+
+TEST_F(TestCallVectorFunction, ChunkwiseParallelExecution) {
+  const std::vector<int> chunk_lengths = {20000, 3001, 0, 20000, 17, 40000, 20000};
+  auto input = GetInt32Chunked(chunk_lengths);
+  ExampleOptions options(std::make_shared<Int32Scalar>(3));
+
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads = ", use_threads);
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("test_vector_swap_state", {input},
+                                                    &options, &ctx));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+    const ChunkedArray& output = *actual.chunked_array();
+    ASSERT_OK(output.ValidateFull());
+
+    // One chunk of output for each non-empty chunk of input, in order
+    int chunk = 0;
+    for (const auto& input_chunk : input->chunks()) {
+      if (input_chunk->length() == 0) continue;
+      ASSERT_LT(chunk, output.num_chunks());
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction("test_stateful", {input_chunk}, &options));
+      AssertArraysEqual(*expected.make_array(), *output.chunk(chunk++),
+                        /*verbose=*/true);
+    }
+    ASSERT_EQ(chunk, output.num_chunks());
+  }
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
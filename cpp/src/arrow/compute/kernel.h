@@ -683,8 +683,10 @@ struct ScalarAggregateKernel : public Kernel {
 
 using HashAggregateConsume = std::function<Status(KernelContext*, const ExecBatch&)>;
 
+// Merge receives the state to fold into the state found in the KernelContext,
+// along with an array which maps each of its group ids to a group id of the latter.
 using HashAggregateMerge =
-    std::function<Status(KernelContext*, KernelState&&, KernelState*)>;
+    std::function<Status(KernelContext*, KernelState&&, const ArrayData&)>;
 
 // Finalize returns Datum to permit multiple return values
 using HashAggregateFinalize = std::function<Status(KernelContext*, Datum*)>;
@@ -697,7 +699,8 @@ using HashAggregateFinalize = std::function<Status(KernelContext*, Datum*)>;
 /// * consume: processes an ExecBatch (which includes the argument as well
 ///   as an array of group identifiers) and updates the KernelState found in the
 ///   KernelContext.
-/// * merge: combines one KernelState with another.
+/// * merge: combines one KernelState with another, given a mapping from the
+///   group ids of the former to those of the latter.
 /// * finalize: produces the end result of the aggregation using the
 ///   KernelState in the KernelContext.
 struct HashAggregateKernel : public Kernel {
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+// The location of a logical index in a chunked array.
+struct ChunkLocation {
+  // The index of the chunk
+  int64_t chunk_index;
+  // The index in that chunk
+  int64_t index_in_chunk;
+};
+
+// An object that resolves the chunk of a logical index in a chunked array.
+class ChunkResolver {
+ public:
+  explicit ChunkResolver(const ArrayVector& chunks)
+      : num_chunks_(static_cast<int64_t>(chunks.size())),
+        offsets_(MakeEndOffsets(chunks)),
+        cached_chunk_(0) {}
+
+  explicit ChunkResolver(const std::vector<const Array*>& chunks)
+      : num_chunks_(static_cast<int64_t>(chunks.size())),
+        offsets_(MakeEndOffsets(chunks)),
+        cached_chunk_(0) {}
+
+  ChunkLocation Resolve(int64_t index) const {
+    // It is common for the algorithms using this to make consecutive accesses
+    // at a relatively small distance from each other, hence often falling in
+    // the same chunk.
+    const bool cache_hit =
+        (index >= offsets_[cached_chunk_] && index < offsets_[cached_chunk_ + 1]);
+    if (ARROW_PREDICT_TRUE(cache_hit)) {
+      return {cached_chunk_, index - offsets_[cached_chunk_]};
+    } else {
+      cached_chunk_ = Bisect(index);
+      return {cached_chunk_, index - offsets_[cached_chunk_]};
+    }
+  }
+
+  // Like Resolve(), but without using the cached chunk.  This is faster for
+  // random accesses in a loop, as each resolution doesn't have to wait for the
+  // previous one to update the cache.
+  ChunkLocation ResolveUncached(int64_t index) const {
+    const int64_t chunk_index = Bisect(index);
+    return {chunk_index, index - offsets_[chunk_index]};
+  }
+
+  // The logical index of the first element of the given chunk
+  int64_t chunk_offset(int64_t chunk_index) const { return offsets_[chunk_index]; }
+
+ private:
+  int64_t Bisect(int64_t index) const {
+    // Like std::upper_bound(), but hand-written as it can help the compiler.
+    const int64_t* raw_offsets = offsets_.data();
+    // Search [lo, lo + n)
+    int64_t lo = 0, n = num_chunks_;
+    while (n > 1) {
+      const int64_t m = n >> 1;
+      // Written so as to compile to a conditional move, as the outcome of
+      // the comparison is unpredictable with random accesses.
+      lo = (index >= raw_offsets[lo + m]) ? lo + m : lo;
+      n -= m;
+    }
+    return lo;
+  }
+
+  template <typename ArrayPtrVector>
+  static std::vector<int64_t> MakeEndOffsets(const ArrayPtrVector& chunks) {
+    std::vector<int64_t> end_offsets(chunks.size() + 1);
+    int64_t offset = 0;
+    end_offsets[0] = 0;
+    std::transform(chunks.begin(), chunks.end(), end_offsets.begin() + 1,
+                   [&](const typename ArrayPtrVector::value_type& chunk) {
+                     offset += chunk->length();
+                     return offset;
+                   });
+    return end_offsets;
+  }
+
+  int64_t num_chunks_;
+  std::vector<int64_t> offsets_;
+
+  mutable int64_t cached_chunk_;
+};
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
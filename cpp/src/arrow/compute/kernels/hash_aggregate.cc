@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <string>
@@ -24,6 +26,7 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/aggregate.h"
 #include "arrow/compute/exec/key_compare.h"
 #include "arrow/compute/exec/key_encode.h"
 #include "arrow/compute/exec/key_hash.h"
@@ -39,6 +42,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/tdigest.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -63,6 +67,12 @@ struct KeyEncoder {
 
   virtual Status Encode(const ArrayData&, uint8_t** encoded_bytes) = 0;
 
+  // Encode without recording anything about the keys, so that concurrent lookups of
+  // previously consumed keys are safe. Only encoders with state need to override this.
+  virtual Status EncodeForLookup(const ArrayData& data, uint8_t** encoded_bytes) {
+    return Encode(data, encoded_bytes);
+  }
+
   virtual Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes,
                                                     int32_t length, MemoryPool*) = 0;
 
@@ -218,6 +228,14 @@ struct DictionaryKeyEncoder : FixedWidthKeyEncoder {
     return FixedWidthKeyEncoder::Encode(data, encoded_bytes);
   }
 
+  Status EncodeForLookup(const ArrayData& data, uint8_t** encoded_bytes) override {
+    // Without a recorded dictionary no key has been consumed, so any encoding will do
+    if (dictionary_ && !dictionary_->Equals(MakeArray(data.dictionary))) {
+      return Status::NotImplemented("Unifying differing dictionaries");
+    }
+    return FixedWidthKeyEncoder::Encode(data, encoded_bytes);
+  }
+
   Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
                                             MemoryPool* pool) override {
     ARROW_ASSIGN_OR_RAISE(auto data,
@@ -360,29 +378,45 @@ struct GrouperImpl : Grouper {
     return std::move(impl);
   }
 
-  Result<Datum> Consume(const ExecBatch& batch) override {
-    std::vector<int32_t> offsets_batch(batch.length + 1);
+  // Encode each row of keys into a contiguous run of key_bytes_batch
+  Status EncodeKeys(const ExecBatch& batch, bool for_lookup,
+                    std::vector<int32_t>* offsets_batch,
+                    std::vector<uint8_t>* key_bytes_batch) {
+    offsets_batch->assign(batch.length + 1, 0);
     for (int i = 0; i < batch.num_values(); ++i) {
-      encoders_[i]->AddLength(*batch[i].array(), offsets_batch.data());
+      encoders_[i]->AddLength(*batch[i].array(), offsets_batch->data());
     }
 
     int32_t total_length = 0;
     for (int64_t i = 0; i < batch.length; ++i) {
       auto total_length_before = total_length;
-      total_length += offsets_batch[i];
-      offsets_batch[i] = total_length_before;
+      total_length += (*offsets_batch)[i];
+      (*offsets_batch)[i] = total_length_before;
     }
-    offsets_batch[batch.length] = total_length;
+    (*offsets_batch)[batch.length] = total_length;
 
-    std::vector<uint8_t> key_bytes_batch(total_length);
+    key_bytes_batch->resize(total_length);
     std::vector<uint8_t*> key_buf_ptrs(batch.length);
     for (int64_t i = 0; i < batch.length; ++i) {
-      key_buf_ptrs[i] = key_bytes_batch.data() + offsets_batch[i];
+      key_buf_ptrs[i] = key_bytes_batch->data() + (*offsets_batch)[i];
     }
 
     for (int i = 0; i < batch.num_values(); ++i) {
-      RETURN_NOT_OK(encoders_[i]->Encode(*batch[i].array(), key_buf_ptrs.data()));
+      if (for_lookup) {
+        RETURN_NOT_OK(
+            encoders_[i]->EncodeForLookup(*batch[i].array(), key_buf_ptrs.data()));
+      } else {
+        RETURN_NOT_OK(encoders_[i]->Encode(*batch[i].array(), key_buf_ptrs.data()));
+      }
     }
+    return Status::OK();
+  }
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    std::vector<int32_t> offsets_batch;
+    std::vector<uint8_t> key_bytes_batch;
+    RETURN_NOT_OK(EncodeKeys(batch, /*for_lookup=*/false, &offsets_batch,
+                             &key_bytes_batch));
 
     TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
     RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
@@ -412,6 +446,35 @@ struct GrouperImpl : Grouper {
     return Datum(UInt32Array(batch.length, std::move(group_ids)));
   }
 
+  Result<Datum> Lookup(const ExecBatch& batch) override {
+    std::vector<int32_t> offsets_batch;
+    std::vector<uint8_t> key_bytes_batch;
+    RETURN_NOT_OK(
+        EncodeKeys(batch, /*for_lookup=*/true, &offsets_batch, &key_bytes_batch));
+
+    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
+    TypedBufferBuilder<bool> found_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(found_batch.Resize(batch.length));
+
+    for (int64_t i = 0; i < batch.length; ++i) {
+      int32_t key_length = offsets_batch[i + 1] - offsets_batch[i];
+      std::string key(
+          reinterpret_cast<const char*>(key_bytes_batch.data() + offsets_batch[i]),
+          key_length);
+
+      auto it = map_.find(key);
+      found_batch.UnsafeAppend(it != map_.end());
+      group_ids_batch.UnsafeAppend(it != map_.end() ? it->second : 0);
+    }
+
+    auto null_count = found_batch.false_count();
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto found, found_batch.Finish());
+    return Datum(
+        UInt32Array(batch.length, std::move(group_ids), std::move(found), null_count));
+  }
+
   uint32_t num_groups() const override { return num_groups_; }
 
   Result<ExecBatch> GetUniques() override {
@@ -553,20 +616,7 @@ struct GrouperFastImpl : Grouper {
     ARROW_ASSIGN_OR_RAISE(
         group_ids, AllocateBuffer(sizeof(uint32_t) * num_rows, ctx_->memory_pool()));
 
-    for (int icol = 0; icol < num_columns; ++icol) {
-      const uint8_t* non_nulls = nullptr;
-      if (batch[icol].array()->buffers[0] != NULLPTR) {
-        non_nulls = batch[icol].array()->buffers[0]->data();
-      }
-      const uint8_t* fixedlen = batch[icol].array()->buffers[1]->data();
-      const uint8_t* varlen = nullptr;
-      if (!col_metadata_[icol].is_fixed_length) {
-        varlen = batch[icol].array()->buffers[2]->data();
-      }
-
-      cols_[icol] = arrow::compute::KeyEncoder::KeyColumnArray(
-          col_metadata_[icol], num_rows, non_nulls, fixedlen, varlen);
-    }
+    MakeColumnArrays(batch, &cols_);
 
     // Split into smaller mini-batches
     //
@@ -581,17 +631,7 @@ struct GrouperFastImpl : Grouper {
       encoder_.Encode(start_row, batch_size_next, &rows_minibatch_, cols_);
 
       // Compute hash
-      if (encoder_.row_metadata().is_fixed_length) {
-        Hashing::hash_fixed(encode_ctx_.hardware_flags, batch_size_next,
-                            encoder_.row_metadata().fixed_length, rows_minibatch_.data(1),
-                            minibatch_hashes_.data());
-      } else {
-        auto hash_temp_buf =
-            util::TempVectorHolder<uint32_t>(&temp_stack_, 4 * batch_size_next);
-        Hashing::hash_varlen(encode_ctx_.hardware_flags, batch_size_next,
-                             rows_minibatch_.offsets(), rows_minibatch_.data(2),
-                             hash_temp_buf.mutable_data(), minibatch_hashes_.data());
-      }
+      HashRows(batch_size_next, rows_minibatch_, &temp_stack_, minibatch_hashes_.data());
 
       // Map
       RETURN_NOT_OK(
@@ -605,9 +645,107 @@ struct GrouperFastImpl : Grouper {
       }
     }
 
+    // Refresh the cached nullity of rows_ so that Lookup only ever reads it
+    rows_.has_any_nulls(&encode_ctx_);
+
     return Datum(UInt32Array(batch.length, std::move(group_ids)));
   }
 
+  Result<Datum> Lookup(const ExecBatch& batch) override {
+    int64_t num_rows = batch.length;
+    int num_columns = batch.num_values();
+
+    for (int icol = 0; icol < num_columns; ++icol) {
+      if (key_types_[icol]->id() == Type::DICTIONARY && dictionaries_[icol] &&
+          !dictionaries_[icol]->Equals(MakeArray(batch[icol].array()->dictionary))) {
+        return Status::NotImplemented("Unifying differing dictionaries");
+      }
+    }
+
+    std::shared_ptr<Buffer> group_ids, found;
+    ARROW_ASSIGN_OR_RAISE(
+        group_ids, AllocateBuffer(sizeof(uint32_t) * num_rows, ctx_->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(found, AllocateBitmap(num_rows, ctx_->memory_pool()));
+
+    // Lookups may run concurrently, so all scratch space is private to this call
+    util::TempVectorStack temp_stack;
+    RETURN_NOT_OK(temp_stack.Init(ctx_->memory_pool(), 64 * minibatch_size_max_));
+    arrow::compute::KeyEncoder::KeyEncoderContext encode_ctx;
+    encode_ctx.hardware_flags = encode_ctx_.hardware_flags;
+    encode_ctx.stack = &temp_stack;
+    arrow::compute::KeyEncoder encoder;
+    encoder.Init(col_metadata_, &encode_ctx,
+                 /* row_alignment = */ sizeof(uint64_t),
+                 /* string_alignment = */ sizeof(uint64_t));
+    arrow::compute::KeyEncoder::KeyRowArray rows_minibatch;
+    RETURN_NOT_OK(rows_minibatch.Init(ctx_->memory_pool(), encoder.row_metadata()));
+    std::vector<arrow::compute::KeyEncoder::KeyColumnArray> cols(num_columns);
+    MakeColumnArrays(batch, &cols);
+    std::vector<uint32_t> hashes(minibatch_size_max_ +
+                                 kPaddingForSIMD / sizeof(uint32_t));
+
+    auto equal_func = [&](int num_keys_to_compare, const uint16_t* selection_may_be_null,
+                          const uint32_t* group_ids, uint32_t* out_num_keys_mismatch,
+                          uint16_t* out_selection_mismatch) {
+      arrow::compute::KeyCompare::CompareRows(
+          num_keys_to_compare, selection_may_be_null, group_ids, &encode_ctx,
+          out_num_keys_mismatch, out_selection_mismatch, rows_minibatch, rows_);
+    };
+
+    // Mini-batches start at multiples of 8 rows, so each one begins on a whole byte of
+    // the output bitmap
+    for (uint32_t start_row = 0; start_row < num_rows;) {
+      uint32_t batch_size_next = std::min(static_cast<uint32_t>(minibatch_size_max_),
+                                          static_cast<uint32_t>(num_rows) - start_row);
+
+      rows_minibatch.Clean();
+      RETURN_NOT_OK(encoder.PrepareOutputForEncode(start_row, batch_size_next,
+                                                   &rows_minibatch, cols));
+      encoder.Encode(start_row, batch_size_next, &rows_minibatch, cols);
+      HashRows(batch_size_next, rows_minibatch, &temp_stack, hashes.data());
+      map_.find(batch_size_next, hashes.data(), found->mutable_data() + start_row / 8,
+                reinterpret_cast<uint32_t*>(group_ids->mutable_data()) + start_row,
+                &temp_stack, equal_func);
+
+      start_row += batch_size_next;
+    }
+
+    auto null_count = num_rows - arrow::internal::CountSetBits(found->data(),
+                                                               /*offset=*/0, num_rows);
+    return Datum(UInt32Array(num_rows, std::move(group_ids), std::move(found),
+                             null_count));
+  }
+
+  void MakeColumnArrays(const ExecBatch& batch,
+                        std::vector<arrow::compute::KeyEncoder::KeyColumnArray>* cols) {
+    for (int icol = 0; icol < batch.num_values(); ++icol) {
+      const uint8_t* non_nulls = nullptr;
+      if (batch[icol].array()->buffers[0] != NULLPTR) {
+        non_nulls = batch[icol].array()->buffers[0]->data();
+      }
+      const uint8_t* fixedlen = batch[icol].array()->buffers[1]->data();
+      const uint8_t* varlen = nullptr;
+      if (!col_metadata_[icol].is_fixed_length) {
+        varlen = batch[icol].array()->buffers[2]->data();
+      }
+
+      (*cols)[icol] = arrow::compute::KeyEncoder::KeyColumnArray(
+          col_metadata_[icol], batch.length, non_nulls, fixedlen, varlen);
+    }
+  }
+
+  void HashRows(uint32_t num_rows, const arrow::compute::KeyEncoder::KeyRowArray& rows,
+                util::TempVectorStack* temp_stack, uint32_t* out_hashes) {
+    if (rows.metadata().is_fixed_length) {
+      Hashing::hash_fixed(encode_ctx_.hardware_flags, num_rows,
+                          rows.metadata().fixed_length, rows.data(1), out_hashes);
+    } else {
+      auto hash_temp_buf = util::TempVectorHolder<uint32_t>(temp_stack, 4 * num_rows);
+      Hashing::hash_varlen(encode_ctx_.hardware_flags, num_rows, rows.offsets(),
+                           rows.data(2), hash_temp_buf.mutable_data(), out_hashes);
+    }
+  }
+
   uint32_t num_groups() const override { return static_cast<uint32_t>(rows_.length()); }
 
   // Make sure padded buffers end up with the right logical size
@@ -746,18 +884,29 @@ struct GroupedAggregator : KernelState {
   virtual Status Init(ExecContext*, const FunctionOptions*,
                       const std::shared_ptr<DataType>&) = 0;
 
+  /// Grow the state to accommodate at least new_num_groups groups.
+  virtual Status Resize(int64_t new_num_groups) = 0;
+
   virtual Status Consume(const ExecBatch& batch) = 0;
 
+  /// Fold the state of another aggregator of the same kind into this one.
+  /// group_id_mapping is a uint32 array mapping each group id of `other`
+  /// to the corresponding group id in this aggregator.
+  virtual Status Merge(GroupedAggregator&& other, const ArrayData& group_id_mapping) = 0;
+
   virtual Result<Datum> Finalize() = 0;
 
-  template <typename Reserve>
-  Status MaybeReserve(int64_t old_num_groups, const ExecBatch& batch,
-                      const Reserve& reserve) {
-    int64_t new_num_groups = batch[2].scalar_as<UInt32Scalar>().value;
-    if (new_num_groups <= old_num_groups) {
-      return Status::OK();
+  Status MaybeResize(const ExecBatch& batch) {
+    return Resize(batch[2].scalar_as<UInt32Scalar>().value);
+  }
+
+  Status ResizeForMerge(const ArrayData& group_id_mapping) {
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    int64_t new_num_groups = 0;
+    for (int64_t i = 0; i < group_id_mapping.length; ++i) {
+      new_num_groups = std::max<int64_t>(new_num_groups, g[i] + 1);
     }
-    return reserve(new_num_groups - old_num_groups);
+    return Resize(new_num_groups);
   }
 
   virtual std::shared_ptr<DataType> out_type() const = 0;
@@ -774,11 +923,15 @@ struct GroupedCountImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  Status Resize(int64_t new_num_groups) override {
+    if (new_num_groups <= num_groups_) return Status::OK();
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    return counts_.Append(added_groups * sizeof(int64_t), 0);
+  }
+
   Status Consume(const ExecBatch& batch) override {
-    RETURN_NOT_OK(MaybeReserve(num_groups_, batch, [&](int64_t added_groups) {
-      num_groups_ += added_groups;
-      return counts_.Append(added_groups * sizeof(int64_t), 0);
-    }));
+    RETURN_NOT_OK(MaybeResize(batch));
 
     auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
     auto raw_counts = reinterpret_cast<int64_t*>(counts_.mutable_data());
@@ -807,6 +960,21 @@ struct GroupedCountImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedCountImpl*>(&raw_other);
+    RETURN_NOT_OK(ResizeForMerge(group_id_mapping));
+
+    auto raw_counts = reinterpret_cast<int64_t*>(counts_.mutable_data());
+    auto other_counts = reinterpret_cast<const int64_t*>(other->counts_.data());
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      raw_counts[*g] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
   Result<Datum> Finalize() override {
     ARROW_ASSIGN_OR_RAISE(auto counts, counts_.Finish());
     return std::make_shared<Int64Array>(num_groups_, std::move(counts));
@@ -819,6 +987,29 @@ struct GroupedCountImpl : public GroupedAggregator {
   BufferBuilder counts_;
 };
 
+// Build a validity bitmap which is unset for each group with fewer than min_count
+// values, or return null if there are no such groups.
+Result<std::shared_ptr<Buffer>> CountsToNullBitmap(const int64_t* counts,
+                                                   int64_t num_groups, int64_t min_count,
+                                                   MemoryPool* pool,
+                                                   int64_t* null_count) {
+  std::shared_ptr<Buffer> null_bitmap;
+  *null_count = 0;
+
+  for (int64_t i = 0; i < num_groups; ++i) {
+    if (counts[i] >= min_count) continue;
+
+    if (null_bitmap == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_groups, pool));
+      BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups, true);
+    }
+
+    *null_count += 1;
+    BitUtil::SetBitTo(null_bitmap->mutable_data(), i, false);
+  }
+  return null_bitmap;
+}
+
 // ----------------------------------------------------------------------
 // Sum implementation
 
@@ -830,6 +1021,8 @@ struct GroupedSumImpl : public GroupedAggregator {
   using ConsumeImpl = std::function<void(const std::shared_ptr<ArrayData>&,
                                          const uint32_t*, void*, int64_t*)>;
 
+  using MergeImpl = std::function<void(const void*, const uint32_t*, int64_t, void*)>;
+
   struct GetConsumeImpl {
     template <typename T, typename AccType = typename FindAccumulatorType<T>::Type>
     Status Visit(const T&) {
@@ -846,6 +1039,15 @@ struct GroupedSumImpl : public GroupedAggregator {
             },
             [&] { ++group; });
       };
+      merge_impl = [](const void* boxed_other_sums, const uint32_t* group,
+                      int64_t length, void* boxed_sums) {
+        using AccCType = typename TypeTraits<AccType>::CType;
+        auto other_sums = reinterpret_cast<const AccCType*>(boxed_other_sums);
+        auto sums = reinterpret_cast<AccCType*>(boxed_sums);
+        for (int64_t other_g = 0; other_g < length; ++other_g, ++group) {
+          sums[*group] += other_sums[other_g];
+        }
+      };
       out_type = TypeTraits<AccType>::type_singleton();
       return Status::OK();
     }
@@ -859,6 +1061,7 @@ struct GroupedSumImpl : public GroupedAggregator {
     }
 
     ConsumeImpl consume_impl;
+    MergeImpl merge_impl;
     std::shared_ptr<DataType> out_type;
   };
 
@@ -872,18 +1075,23 @@ struct GroupedSumImpl : public GroupedAggregator {
     RETURN_NOT_OK(VisitTypeInline(*input_type, &get_consume_impl));
 
     consume_impl_ = std::move(get_consume_impl.consume_impl);
+    merge_impl_ = std::move(get_consume_impl.merge_impl);
     out_type_ = std::move(get_consume_impl.out_type);
 
     return Status::OK();
   }
 
+  Status Resize(int64_t new_num_groups) override {
+    if (new_num_groups <= num_groups_) return Status::OK();
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(sums_.Append(added_groups * kSumSize, 0));
+    RETURN_NOT_OK(counts_.Append(added_groups * sizeof(int64_t), 0));
+    return Status::OK();
+  }
+
   Status Consume(const ExecBatch& batch) override {
-    RETURN_NOT_OK(MaybeReserve(num_groups_, batch, [&](int64_t added_groups) {
-      num_groups_ += added_groups;
-      RETURN_NOT_OK(sums_.Append(added_groups * kSumSize, 0));
-      RETURN_NOT_OK(counts_.Append(added_groups * sizeof(int64_t), 0));
-      return Status::OK();
-    }));
+    RETURN_NOT_OK(MaybeResize(batch));
 
     auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
     consume_impl_(batch[0].array(), group_ids, sums_.mutable_data(),
@@ -891,21 +1099,28 @@ struct GroupedSumImpl : public GroupedAggregator {
     return Status::OK();
   }
 
-  Result<Datum> Finalize() override {
-    std::shared_ptr<Buffer> null_bitmap;
-    int64_t null_count = 0;
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedSumImpl*>(&raw_other);
+    RETURN_NOT_OK(ResizeForMerge(group_id_mapping));
 
-    for (int64_t i = 0; i < num_groups_; ++i) {
-      if (reinterpret_cast<const int64_t*>(counts_.data())[i] > 0) continue;
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    merge_impl_(other->sums_.data(), g, group_id_mapping.length, sums_.mutable_data());
 
-      if (null_bitmap == nullptr) {
-        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_groups_, pool_));
-        BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups_, true);
-      }
-
-      null_count += 1;
-      BitUtil::SetBitTo(null_bitmap->mutable_data(), i, false);
+    auto raw_counts = reinterpret_cast<int64_t*>(counts_.mutable_data());
+    auto other_counts = reinterpret_cast<const int64_t*>(other->counts_.data());
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      raw_counts[*g] += other_counts[other_g];
     }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    int64_t null_count = 0;
+    ARROW_ASSIGN_OR_RAISE(
+        auto null_bitmap,
+        CountsToNullBitmap(reinterpret_cast<const int64_t*>(counts_.data()), num_groups_,
+                           /*min_count=*/1, pool_, &null_count));
 
     ARROW_ASSIGN_OR_RAISE(auto sums, sums_.Finish());
 
@@ -916,14 +1131,67 @@ struct GroupedSumImpl : public GroupedAggregator {
   std::shared_ptr<DataType> out_type() const override { return out_type_; }
 
   // NB: counts are used here instead of a simple "has_values_" bitmap since
-  // we expect to reuse this kernel to handle Mean
+  // GroupedMeanImpl reuses this kernel
   int64_t num_groups_ = 0;
   BufferBuilder sums_, counts_;
   std::shared_ptr<DataType> out_type_;
   ConsumeImpl consume_impl_;
+  MergeImpl merge_impl_;
   MemoryPool* pool_;
 };
 
+// ----------------------------------------------------------------------
+// Mean implementation
+
+struct GroupedMeanImpl : public GroupedSumImpl {
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const ScalarAggregateOptions*>(options);
+    return GroupedSumImpl::Init(ctx, options, input_type);
+  }
+
+  template <typename SumCType>
+  void DivideSums(const int64_t* counts, double* means) const {
+    auto sums = reinterpret_cast<const SumCType*>(sums_.data());
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      means[i] = static_cast<double>(sums[i]) / counts[i];
+    }
+  }
+
+  Result<Datum> Finalize() override {
+    auto counts = reinterpret_cast<const int64_t*>(counts_.data());
+
+    int64_t null_count = 0;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          CountsToNullBitmap(counts, num_groups_, options_.min_count,
+                                             pool_, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto means,
+                          AllocateBuffer(num_groups_ * sizeof(double), pool_));
+    auto raw_means = reinterpret_cast<double*>(means->mutable_data());
+    switch (out_type_->id()) {
+      case Type::DOUBLE:
+        DivideSums<double>(counts, raw_means);
+        break;
+      case Type::INT64:
+        DivideSums<int64_t>(counts, raw_means);
+        break;
+      case Type::UINT64:
+        DivideSums<uint64_t>(counts, raw_means);
+        break;
+      default:
+        return Status::TypeError("Unexpected sum type ", *out_type_);
+    }
+
+    return ArrayData::Make(float64(), num_groups_,
+                           {std::move(null_bitmap), std::move(means)}, null_count);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+  ScalarAggregateOptions options_;
+};
+
 // ----------------------------------------------------------------------
 // MinMax implementation
 
@@ -947,6 +1215,9 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
       std::function<void(const std::shared_ptr<ArrayData>&, const uint32_t*, void*, void*,
                          uint8_t*, uint8_t*)>;
 
+  using MergeImpl = std::function<void(const void*, const void*, const uint32_t*,
+                                       int64_t, void*, void*)>;
+
   using ResizeImpl = std::function<Status(BufferBuilder*, int64_t)>;
 
   template <typename CType>
@@ -979,6 +1250,19 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
             [&] { BitUtil::SetBit(has_nulls, *group++); });
       };
 
+      merge_impl = [](const void* other_mins, const void* other_maxes,
+                      const uint32_t* group, int64_t length, void* mins, void* maxes) {
+        auto raw_other_mins = reinterpret_cast<const CType*>(other_mins);
+        auto raw_other_maxes = reinterpret_cast<const CType*>(other_maxes);
+        auto raw_mins = reinterpret_cast<CType*>(mins);
+        auto raw_maxes = reinterpret_cast<CType*>(maxes);
+
+        for (int64_t other_g = 0; other_g < length; ++other_g, ++group) {
+          raw_mins[*group] = std::min(raw_mins[*group], raw_other_mins[other_g]);
+          raw_maxes[*group] = std::max(raw_maxes[*group], raw_other_maxes[other_g]);
+        }
+      };
+
       resize_min_impl = MakeResizeImpl(Extrema<CType>::max());
       resize_max_impl = MakeResizeImpl(Extrema<CType>::min());
       return Status::OK();
@@ -997,6 +1281,7 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
     }
 
     ConsumeImpl consume_impl;
+    MergeImpl merge_impl;
     ResizeImpl resize_min_impl, resize_max_impl;
   };
 
@@ -1014,21 +1299,26 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
     RETURN_NOT_OK(VisitTypeInline(*input_type, &get_impl));
 
     consume_impl_ = std::move(get_impl.consume_impl);
+    merge_impl_ = std::move(get_impl.merge_impl);
     resize_min_impl_ = std::move(get_impl.resize_min_impl);
     resize_max_impl_ = std::move(get_impl.resize_max_impl);
 
     return Status::OK();
   }
 
+  Status Resize(int64_t new_num_groups) override {
+    if (new_num_groups <= num_groups_) return Status::OK();
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(resize_min_impl_(&mins_, added_groups));
+    RETURN_NOT_OK(resize_max_impl_(&maxes_, added_groups));
+    RETURN_NOT_OK(has_values_.Append(added_groups, false));
+    RETURN_NOT_OK(has_nulls_.Append(added_groups, false));
+    return Status::OK();
+  }
+
   Status Consume(const ExecBatch& batch) override {
-    RETURN_NOT_OK(MaybeReserve(num_groups_, batch, [&](int64_t added_groups) {
-      num_groups_ += added_groups;
-      RETURN_NOT_OK(resize_min_impl_(&mins_, added_groups));
-      RETURN_NOT_OK(resize_max_impl_(&maxes_, added_groups));
-      RETURN_NOT_OK(has_values_.Append(added_groups, false));
-      RETURN_NOT_OK(has_nulls_.Append(added_groups, false));
-      return Status::OK();
-    }));
+    RETURN_NOT_OK(MaybeResize(batch));
 
     auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
     consume_impl_(batch[0].array(), group_ids, mins_.mutable_data(),
@@ -1037,6 +1327,26 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
+    RETURN_NOT_OK(ResizeForMerge(group_id_mapping));
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    merge_impl_(other->mins_.data(), other->maxes_.data(), g, group_id_mapping.length,
+                mins_.mutable_data(), maxes_.mutable_data());
+
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      if (BitUtil::GetBit(other->has_values_.data(), other_g)) {
+        BitUtil::SetBit(has_values_.mutable_data(), *g);
+      }
+      if (BitUtil::GetBit(other->has_nulls_.data(), other_g)) {
+        BitUtil::SetBit(has_nulls_.mutable_data(), *g);
+      }
+    }
+    return Status::OK();
+  }
+
   Result<Datum> Finalize() override {
     // aggregation for group is valid if there was at least one value in that group
     ARROW_ASSIGN_OR_RAISE(auto null_bitmap, has_values_.Finish());
@@ -1061,15 +1371,441 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
     return struct_({field("min", type_), field("max", type_)});
   }
 
-  int64_t num_groups_;
+  int64_t num_groups_ = 0;
   BufferBuilder mins_, maxes_;
   TypedBufferBuilder<bool> has_values_, has_nulls_;
   std::shared_ptr<DataType> type_;
   ConsumeImpl consume_impl_;
+  MergeImpl merge_impl_;
   ResizeImpl resize_min_impl_, resize_max_impl_;
   ScalarAggregateOptions options_;
 };
 
+// ----------------------------------------------------------------------
+// Variance/Stddev implementation
+
+enum class VarOrStd : bool { Var, Std };
+
+template <VarOrStd result_type>
+struct GroupedVarStdImpl : public GroupedAggregator {
+  using ConsumeImpl = std::function<void(const std::shared_ptr<ArrayData>&,
+                                         const uint32_t*, int64_t*, double*, double*)>;
+
+  struct GetConsumeImpl {
+    template <typename T, typename CType = typename TypeTraits<T>::CType>
+    enable_if_number<T, Status> Visit(const T&) {
+      // Welford's online update of the count, mean and m2 (sum((X-mean)^2)) of
+      // each group, which avoids the cancellation of a naive sum of squares
+      consume_impl = [](const std::shared_ptr<ArrayData>& input, const uint32_t* group,
+                        int64_t* counts, double* means, double* m2s) {
+        VisitArrayDataInline<T>(
+            *input,
+            [&](CType value) {
+              auto g = *group++;
+              const double v = static_cast<double>(value);
+              const double delta = v - means[g];
+              means[g] += delta / ++counts[g];
+              m2s[g] += delta * (v - means[g]);
+            },
+            [&] { ++group; });
+      };
+      return Status::OK();
+    }
+
+    Status Visit(const HalfFloatType& type) {
+      return Status::NotImplemented("Computing variance/stddev of data of type ", type);
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::NotImplemented("Computing variance/stddev of data of type ", type);
+    }
+
+    ConsumeImpl consume_impl;
+  };
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const VarianceOptions*>(options);
+    pool_ = ctx->memory_pool();
+    counts_ = BufferBuilder(pool_);
+    means_ = BufferBuilder(pool_);
+    m2s_ = BufferBuilder(pool_);
+
+    GetConsumeImpl get_consume_impl;
+    RETURN_NOT_OK(VisitTypeInline(*input_type, &get_consume_impl));
+    consume_impl_ = std::move(get_consume_impl.consume_impl);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    if (new_num_groups <= num_groups_) return Status::OK();
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(counts_.Append(added_groups * sizeof(int64_t), 0));
+    RETURN_NOT_OK(means_.Append(added_groups * sizeof(double), 0));
+    RETURN_NOT_OK(m2s_.Append(added_groups * sizeof(double), 0));
+    return Status::OK();
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeResize(batch));
+
+    auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
+    consume_impl_(batch[0].array(), group_ids,
+                  reinterpret_cast<int64_t*>(counts_.mutable_data()),
+                  reinterpret_cast<double*>(means_.mutable_data()),
+                  reinterpret_cast<double*>(m2s_.mutable_data()));
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedVarStdImpl*>(&raw_other);
+    RETURN_NOT_OK(ResizeForMerge(group_id_mapping));
+
+    auto counts = reinterpret_cast<int64_t*>(counts_.mutable_data());
+    auto means = reinterpret_cast<double*>(means_.mutable_data());
+    auto m2s = reinterpret_cast<double*>(m2s_.mutable_data());
+    auto other_counts = reinterpret_cast<const int64_t*>(other->counts_.data());
+    auto other_means = reinterpret_cast<const double*>(other->means_.data());
+    auto other_m2s = reinterpret_cast<const double*>(other->m2s_.data());
+
+    // Combine the partial states of each group with Chan et al.'s pairwise formula,
+    // as VarStdState::MergeFrom does for chunks of a single array
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      const int64_t other_count = other_counts[other_g];
+      if (other_count == 0) continue;
+
+      const int64_t count = counts[*g];
+      const int64_t total = count + other_count;
+      const double delta = other_means[other_g] - means[*g];
+      means[*g] += delta * other_count / total;
+      m2s[*g] += other_m2s[other_g] +
+                 delta * delta * (static_cast<double>(count) * other_count / total);
+      counts[*g] = total;
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    auto counts = reinterpret_cast<const int64_t*>(counts_.data());
+    auto m2s = reinterpret_cast<const double*>(m2s_.data());
+
+    // Groups without enough non-null values to satisfy ddof are null
+    int64_t null_count = 0;
+    ARROW_ASSIGN_OR_RAISE(
+        auto null_bitmap,
+        CountsToNullBitmap(counts, num_groups_, static_cast<int64_t>(options_.ddof) + 1,
+                           pool_, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto values,
+                          AllocateBuffer(num_groups_ * sizeof(double), pool_));
+    auto raw_values = reinterpret_cast<double*>(values->mutable_data());
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (counts[i] <= options_.ddof) {
+        raw_values[i] = 0;
+        continue;
+      }
+      const double var = m2s[i] / (counts[i] - options_.ddof);
+      raw_values[i] = result_type == VarOrStd::Var ? var : std::sqrt(var);
+    }
+
+    return ArrayData::Make(float64(), num_groups_,
+                           {std::move(null_bitmap), std::move(values)}, null_count);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+  int64_t num_groups_ = 0;
+  BufferBuilder counts_, means_, m2s_;
+  ConsumeImpl consume_impl_;
+  VarianceOptions options_;
+  MemoryPool* pool_;
+};
+
+// ----------------------------------------------------------------------
+// Any/All implementation
+
+template <typename Impl>
+struct GroupedBooleanAggregator : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const FunctionOptions*,
+              const std::shared_ptr<DataType>&) override {
+    reduced_ = TypedBufferBuilder<bool>(ctx->memory_pool());
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    if (new_num_groups <= num_groups_) return Status::OK();
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    return reduced_.Append(added_groups, Impl::kInitValue);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeResize(batch));
+
+    auto group = batch[1].array()->GetValues<uint32_t>(1);
+    uint8_t* reduced = reduced_.mutable_data();
+    VisitArrayDataInline<BooleanType>(
+        *batch[0].array(),
+        [&](bool value) { Impl::UpdateGroupWith(reduced, *group++, value); },
+        [&] { ++group; });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedBooleanAggregator*>(&raw_other);
+    RETURN_NOT_OK(ResizeForMerge(group_id_mapping));
+
+    uint8_t* reduced = reduced_.mutable_data();
+    const uint8_t* other_reduced = other->reduced_.data();
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      Impl::UpdateGroupWith(reduced, *g, BitUtil::GetBit(other_reduced, other_g));
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    ARROW_ASSIGN_OR_RAISE(auto reduced, reduced_.Finish());
+    return std::make_shared<BooleanArray>(num_groups_, std::move(reduced));
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  int64_t num_groups_ = 0;
+  TypedBufferBuilder<bool> reduced_;
+};
+
+struct GroupedAnyImpl : public GroupedBooleanAggregator<GroupedAnyImpl> {
+  static constexpr bool kInitValue = false;
+
+  static void UpdateGroupWith(uint8_t* seen, uint32_t g, bool value) {
+    if (value) BitUtil::SetBit(seen, g);
+  }
+};
+
+struct GroupedAllImpl : public GroupedBooleanAggregator<GroupedAllImpl> {
+  static constexpr bool kInitValue = true;
+
+  static void UpdateGroupWith(uint8_t* seen, uint32_t g, bool value) {
+    if (!value) BitUtil::ClearBit(seen, g);
+  }
+};
+
+// ----------------------------------------------------------------------
+// CountDistinct implementation
+
+struct GroupedCountDistinctImpl : public GroupedAggregator {
+  // Distinct (value, group id) pairs are identified with a Grouper of their own,
+  // which also makes the state mergeable: the uniques of another aggregator are
+  // simply consumed after translating their group ids.
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const ScalarAggregateOptions*>(options);
+    pool_ = ctx->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(
+        grouper_,
+        Grouper::Make({ValueDescr::Array(input_type), ValueDescr::Array(uint32())}, ctx));
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    num_groups_ = std::max(num_groups_, new_num_groups);
+    return Status::OK();
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeResize(batch));
+    return grouper_->Consume(ExecBatch({batch[0], batch[1]}, batch.length)).status();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedCountDistinctImpl*>(&raw_other);
+    RETURN_NOT_OK(ResizeForMerge(group_id_mapping));
+
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, other->grouper_->GetUniques());
+    if (uniques.length == 0) return Status::OK();
+
+    ARROW_ASSIGN_OR_RAISE(auto remapped,
+                          AllocateBuffer(uniques.length * sizeof(uint32_t), pool_));
+    auto raw_remapped = reinterpret_cast<uint32_t*>(remapped->mutable_data());
+    auto other_g = uniques[1].array()->GetValues<uint32_t>(1);
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t i = 0; i < uniques.length; ++i) {
+      raw_remapped[i] = g[other_g[i]];
+    }
+    uniques.values[1] =
+        ArrayData::Make(uint32(), uniques.length, {nullptr, std::move(remapped)}, 0);
+
+    return grouper_->Consume(uniques).status();
+  }
+
+  Result<Datum> Finalize() override {
+    ARROW_ASSIGN_OR_RAISE(auto counts,
+                          AllocateBuffer(num_groups_ * sizeof(int64_t), pool_));
+    auto raw_counts = reinterpret_cast<int64_t*>(counts->mutable_data());
+    std::fill(raw_counts, raw_counts + num_groups_, 0);
+
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, grouper_->GetUniques());
+    const auto& values = *uniques[0].array();
+    const uint8_t* validity = nullptr;
+    if (options_.skip_nulls && values.MayHaveNulls() && values.buffers[0]) {
+      validity = values.buffers[0]->data();
+    }
+    auto g = uniques[1].array()->GetValues<uint32_t>(1);
+    for (int64_t i = 0; i < uniques.length; ++i) {
+      if (validity && !BitUtil::GetBit(validity, values.offset + i)) continue;
+      raw_counts[g[i]] += 1;
+    }
+
+    return std::make_shared<Int64Array>(num_groups_, std::move(counts));
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  int64_t num_groups_ = 0;
+  ScalarAggregateOptions options_;
+  std::unique_ptr<Grouper> grouper_;
+  MemoryPool* pool_;
+};
+
+// ----------------------------------------------------------------------
+// TDigest implementation
+
+struct GroupedTDigestImpl : public GroupedAggregator {
+  using TDigest = ::arrow::internal::TDigest;
+  using ConsumeImpl =
+      std::function<void(const std::shared_ptr<ArrayData>&, const uint32_t*,
+                         const TDigestOptions&, std::unique_ptr<TDigest>*)>;
+
+  struct GetConsumeImpl {
+    template <typename T, typename CType = typename TypeTraits<T>::CType>
+    enable_if_number<T, Status> Visit(const T&) {
+      consume_impl = [](const std::shared_ptr<ArrayData>& input, const uint32_t* group,
+                        const TDigestOptions& options,
+                        std::unique_ptr<TDigest>* tdigests) {
+        VisitArrayDataInline<T>(
+            *input,
+            [&](CType value) {
+              // A digest is only built once its group has a valid value
+              std::unique_ptr<TDigest>& tdigest = tdigests[*group++];
+              if (tdigest == nullptr) {
+                tdigest = ::arrow::internal::make_unique<TDigest>(options.delta,
+                                                                  options.buffer_size);
+              }
+              tdigest->NanAdd(value);
+            },
+            [&] { ++group; });
+      };
+      return Status::OK();
+    }
+
+    Status Visit(const HalfFloatType& type) {
+      return Status::NotImplemented("Computing t-digest of data of type ", type);
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::NotImplemented("Computing t-digest of data of type ", type);
+    }
+
+    ConsumeImpl consume_impl;
+  };
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const TDigestOptions*>(options);
+    pool_ = ctx->memory_pool();
+
+    GetConsumeImpl get_consume_impl;
+    RETURN_NOT_OK(VisitTypeInline(*input_type, &get_consume_impl));
+    consume_impl_ = std::move(get_consume_impl.consume_impl);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    tdigests_.resize(new_num_groups);
+    return Status::OK();
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeResize(batch));
+
+    auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
+    consume_impl_(batch[0].array(), group_ids, options_, tdigests_.data());
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedTDigestImpl*>(&raw_other);
+    RETURN_NOT_OK(ResizeForMerge(group_id_mapping));
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    std::vector<TDigest> other_tdigest(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      std::unique_ptr<TDigest>& tdigest = other->tdigests_[other_g];
+      if (tdigest == nullptr) continue;
+      if (tdigests_[*g] == nullptr) {
+        tdigests_[*g] = std::move(tdigest);
+        continue;
+      }
+      other_tdigest[0] = std::move(*tdigest);
+      tdigests_[*g]->Merge(&other_tdigest);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t num_groups = static_cast<int64_t>(tdigests_.size());
+    const int64_t slot_length = static_cast<int64_t>(options_.q.size());
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto quantiles, AllocateBuffer(num_groups * slot_length * sizeof(double), pool_));
+    auto raw_quantiles = reinterpret_cast<double*>(quantiles->mutable_data());
+
+    // Groups with no valid data points are null
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < num_groups; ++i, raw_quantiles += slot_length) {
+      TDigest* tdigest = tdigests_[i].get();
+      if (tdigest != nullptr && !tdigest->is_empty()) {
+        for (int64_t j = 0; j < slot_length; ++j) {
+          raw_quantiles[j] = tdigest->Quantile(options_.q[j]);
+        }
+        continue;
+      }
+
+      std::fill(raw_quantiles, raw_quantiles + slot_length, 0.0);
+      if (null_bitmap == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_groups, pool_));
+        BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups, true);
+      }
+      null_count += 1;
+      BitUtil::SetBitTo(null_bitmap->mutable_data(), i, false);
+    }
+    tdigests_.clear();
+
+    auto child = ArrayData::Make(float64(), num_groups * slot_length,
+                                 {nullptr, std::move(quantiles)}, /*null_count=*/0);
+    return ArrayData::Make(out_type(), num_groups, {std::move(null_bitmap)},
+                           {std::move(child)}, null_count);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return fixed_size_list(float64(), static_cast<int32_t>(options_.q.size()));
+  }
+
+  TDigestOptions options_;
+  // Null until the group's first valid value, as each digest preallocates its buffers
+  std::vector<std::unique_ptr<TDigest>> tdigests_;
+  ConsumeImpl consume_impl_;
+  MemoryPool* pool_;
+};
+
 template <typename Impl>
 HashAggregateKernel MakeKernel(InputType argument_type) {
   HashAggregateKernel kernel;
@@ -1095,9 +1831,10 @@ HashAggregateKernel MakeKernel(InputType argument_type) {
     return checked_cast<GroupedAggregator*>(ctx->state())->Consume(batch);
   };
 
-  kernel.merge = [](KernelContext* ctx, KernelState&&, KernelState*) {
-    // TODO(ARROW-11840) merge two hash tables
-    return Status::NotImplemented("Merge hashed aggregations");
+  kernel.merge = [](KernelContext* ctx, KernelState&& other,
+                    const ArrayData& group_id_mapping) {
+    return checked_cast<GroupedAggregator*>(ctx->state())
+        ->Merge(checked_cast<GroupedAggregator&&>(other), group_id_mapping);
   };
 
   kernel.finalize = [](KernelContext* ctx, Datum* out) {
@@ -1109,80 +1846,6 @@ HashAggregateKernel MakeKernel(InputType argument_type) {
   return kernel;
 }
 
-Result<std::vector<const HashAggregateKernel*>> GetKernels(
-    ExecContext* ctx, const std::vector<Aggregate>& aggregates,
-    const std::vector<ValueDescr>& in_descrs) {
-  if (aggregates.size() != in_descrs.size()) {
-    return Status::Invalid(aggregates.size(), " aggregate functions were specified but ",
-                           in_descrs.size(), " arguments were provided.");
-  }
-
-  std::vector<const HashAggregateKernel*> kernels(in_descrs.size());
-
-  for (size_t i = 0; i < aggregates.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(auto function,
-                          ctx->func_registry()->GetFunction(aggregates[i].function));
-    ARROW_ASSIGN_OR_RAISE(
-        const Kernel* kernel,
-        function->DispatchExact(
-            {in_descrs[i], ValueDescr::Array(uint32()), ValueDescr::Scalar(uint32())}));
-    kernels[i] = static_cast<const HashAggregateKernel*>(kernel);
-  }
-  return kernels;
-}
-
-Result<std::vector<std::unique_ptr<KernelState>>> InitKernels(
-    const std::vector<const HashAggregateKernel*>& kernels, ExecContext* ctx,
-    const std::vector<Aggregate>& aggregates, const std::vector<ValueDescr>& in_descrs) {
-  std::vector<std::unique_ptr<KernelState>> states(kernels.size());
-
-  for (size_t i = 0; i < aggregates.size(); ++i) {
-    auto options = aggregates[i].options;
-
-    if (options == nullptr) {
-      // use known default options for the named function if possible
-      auto maybe_function = ctx->func_registry()->GetFunction(aggregates[i].function);
-      if (maybe_function.ok()) {
-        options = maybe_function.ValueOrDie()->default_options();
-      }
-    }
-
-    KernelContext kernel_ctx{ctx};
-    ARROW_ASSIGN_OR_RAISE(
-        states[i], kernels[i]->init(&kernel_ctx, KernelInitArgs{kernels[i],
-                                                                {
-                                                                    in_descrs[i].type,
-                                                                    uint32(),
-                                                                    uint32(),
-                                                                },
-                                                                options}));
-  }
-
-  return std::move(states);
-}
-
-Result<FieldVector> ResolveKernels(
-    const std::vector<Aggregate>& aggregates,
-    const std::vector<const HashAggregateKernel*>& kernels,
-    const std::vector<std::unique_ptr<KernelState>>& states, ExecContext* ctx,
-    const std::vector<ValueDescr>& descrs) {
-  FieldVector fields(descrs.size());
-
-  for (size_t i = 0; i < kernels.size(); ++i) {
-    KernelContext kernel_ctx{ctx};
-    kernel_ctx.SetState(states[i].get());
-
-    ARROW_ASSIGN_OR_RAISE(auto descr, kernels[i]->signature->out_type().Resolve(
-                                          &kernel_ctx, {
-                                                           descrs[i].type,
-                                                           uint32(),
-                                                           uint32(),
-                                                       }));
-    fields[i] = field(aggregates[i].function, std::move(descr.type));
-  }
-  return fields;
-}
-
 }  // namespace
 
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
@@ -1340,6 +2003,58 @@ const FunctionDoc hash_min_max_doc{
      "This can be changed through ScalarAggregateOptions."),
     {"array", "group_id_array", "group_count"},
     "ScalarAggregateOptions"};
+
+const FunctionDoc hash_mean_doc{
+    "Compute the mean of a numeric array",
+    ("Null values are ignored. Minimum count of non-null\n"
+     "values can be set and null is returned if too few are "
+     "present.\nThis can be changed through ScalarAggregateOptions.\n"
+     "The result is always computed as a double, regardless of the input types."),
+    {"array", "group_id_array", "group_count"},
+    "ScalarAggregateOptions"};
+
+const FunctionDoc hash_stddev_doc{
+    "Calculate the standard deviation of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population standard deviation is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is returned."),
+    {"array", "group_id_array", "group_count"},
+    "VarianceOptions"};
+
+const FunctionDoc hash_variance_doc{
+    "Calculate the variance of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population variance is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is returned."),
+    {"array", "group_id_array", "group_count"},
+    "VarianceOptions"};
+
+const FunctionDoc hash_any_doc{
+    "Test whether any element in a boolean array evaluates to true",
+    ("Null values are ignored."),
+    {"array", "group_id_array", "group_count"}};
+
+const FunctionDoc hash_all_doc{
+    "Test whether all elements in a boolean array evaluate to true",
+    ("Null values are ignored."),
+    {"array", "group_id_array", "group_count"}};
+
+const FunctionDoc hash_count_distinct_doc{
+    "Count the number of distinct values",
+    ("By default, only non-null values are counted. If skip_nulls is false\n"
+     "in ScalarAggregateOptions, null is counted as one more distinct value."),
+    {"array", "group_id_array", "group_count"},
+    "ScalarAggregateOptions"};
+
+const FunctionDoc hash_tdigest_doc{
+    "Approximate quantiles of a numeric array with T-Digest algorithm",
+    ("By default, 0.5 quantile (median) is returned.\n"
+     "Nulls and NaNs are ignored.\n"
+     "A null list is returned for groups with no valid data point."),
+    {"array", "group_id_array", "group_count"},
+    "TDigestOptions"};
 }  // namespace
 
 void RegisterHashAggregateBasic(FunctionRegistry* registry) {
@@ -1367,6 +2082,65 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(func->AddKernel(MakeKernel<GroupedMinMaxImpl>(ValueDescr::ARRAY)));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+
+  {
+    static auto default_scalar_aggregate_options = ScalarAggregateOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_mean", Arity::Ternary(), &hash_mean_doc,
+        &default_scalar_aggregate_options);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedMeanImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_variance_options = VarianceOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_stddev", Arity::Ternary(), &hash_stddev_doc, &default_variance_options);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel<GroupedVarStdImpl<VarOrStd::Std>>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_variance_options = VarianceOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_variance", Arity::Ternary(), &hash_variance_doc,
+        &default_variance_options);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel<GroupedVarStdImpl<VarOrStd::Var>>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_any", Arity::Ternary(),
+                                                        &hash_any_doc);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedAnyImpl>(InputType::Array(boolean()))));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_all", Arity::Ternary(),
+                                                        &hash_all_doc);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedAllImpl>(InputType::Array(boolean()))));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_scalar_aggregate_options = ScalarAggregateOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_count_distinct", Arity::Ternary(), &hash_count_distinct_doc,
+        &default_scalar_aggregate_options);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedCountDistinctImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_tdigest_options = TDigestOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_tdigest", Arity::Ternary(), &hash_tdigest_doc, &default_tdigest_options);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedTDigestImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 }
 
 }  // namespace internal
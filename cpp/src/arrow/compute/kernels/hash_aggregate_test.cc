@@ -109,8 +109,12 @@ Result<Datum> NaiveGroupBy(std::vector<Datum> arguments, std::vector<Datum> keys
   return StructArray::Make(std::move(out_columns), std::move(out_names));
 }
 
+// Compare GroupBy against per-group invocations of the corresponding scalar
+// aggregate function.  If approx is true, floating point results need only be
+// approximately equal (e.g. when the grouped kernel sums in a different order).
 void ValidateGroupBy(const std::vector<internal::Aggregate>& aggregates,
-                     std::vector<Datum> arguments, std::vector<Datum> keys) {
+                     std::vector<Datum> arguments, std::vector<Datum> keys,
+                     bool approx = false) {
   ASSERT_OK_AND_ASSIGN(Datum expected, NaiveGroupBy(arguments, keys, aggregates));
 
   ASSERT_OK_AND_ASSIGN(Datum actual, GroupBy(arguments, keys, aggregates));
@@ -118,7 +122,11 @@ void ValidateGroupBy(const std::vector<internal::Aggregate>& aggregates,
   ASSERT_OK(expected.make_array()->ValidateFull());
   ValidateOutput(actual);
 
-  AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  if (approx) {
+    AssertDatumsApproxEqual(expected, actual, /*verbose=*/true);
+  } else {
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
 }
 
 }  // namespace
@@ -379,6 +387,62 @@ TEST(Grouper, DictKey) {
           ArrayFromJSON(utf8(), R"(["different", "dictionary"])"))})));
 }
 
+TEST(Grouper, Lookup) {
+  // large_utf8 keys are handled by GrouperImpl, utf8 keys by GrouperFastImpl
+  for (const auto& string_type : {utf8(), large_utf8()}) {
+    SCOPED_TRACE(string_type->ToString());
+    TestGrouper g({string_type, int64()});
+
+    Datum consumed_ids;
+    g.ConsumeAndValidate(
+        ExecBatch(*RecordBatchFromJSON(
+            g.key_schema_, R"([["eh", 0], ["bee", 1], ["eh", null], [null, 1]])")),
+        &consumed_ids);
+
+    ASSERT_OK_AND_ASSIGN(Datum ids, g.grouper_->Lookup(ExecBatch(*RecordBatchFromJSON(
+                                        g.key_schema_, R"([
+      ["bee", 1], ["eh", 1], [null, 1], ["eh", 0], ["sea", 2], ["eh", null]
+    ])"))));
+    ValidateOutput(ids);
+    ASSERT_OK_AND_ASSIGN(
+        Datum expected,
+        Take(consumed_ids, ArrayFromJSON(int32(), "[1, null, 3, 0, null, 2]")));
+    AssertDatumsEqual(expected, ids, /*verbose=*/true);
+
+    // Lookup doesn't add groups
+    ASSERT_EQ(g.grouper_->num_groups(), 4);
+  }
+}
+
+TEST(Grouper, LookupManyKeys) {
+  // Enough keys to span several mini-batches
+  constexpr int64_t kNumKeys = 5000;
+  std::vector<int64_t> consumed, looked_up;
+  std::vector<bool> is_found;
+  std::vector<int64_t> consumed_index;
+  for (int64_t i = 0; i < kNumKeys; ++i) {
+    consumed.push_back(2 * i);
+    looked_up.push_back(i);
+    is_found.push_back(i % 2 == 0);
+    consumed_index.push_back(i / 2);
+  }
+  std::shared_ptr<Array> consumed_array, looked_up_array, consumed_indices;
+  ArrayFromVector<Int64Type>(consumed, &consumed_array);
+  ArrayFromVector<Int64Type>(looked_up, &looked_up_array);
+  ArrayFromVector<Int64Type>(is_found, consumed_index, &consumed_indices);
+
+  TestGrouper g({int64()});
+  Datum consumed_ids;
+  g.ConsumeAndValidate(*ExecBatch::Make({consumed_array}), &consumed_ids);
+
+  ASSERT_OK_AND_ASSIGN(Datum ids,
+                       g.grouper_->Lookup(*ExecBatch::Make({looked_up_array})));
+  ValidateOutput(ids);
+  ASSERT_OK_AND_ASSIGN(Datum expected, Take(consumed_ids, consumed_indices));
+  AssertDatumsEqual(expected, ids, /*verbose=*/true);
+  ASSERT_EQ(g.grouper_->num_groups(), kNumKeys);
+}
+
 TEST(Grouper, StringInt64Key) {
   TestGrouper g({utf8(), int64()});
 
@@ -719,6 +783,125 @@ TEST(GroupBy, ConcreteCaseWithValidateGroupBy) {
   }
 }
 
+TEST(GroupBy, ConcreteCaseStatisticsWithValidateGroupBy) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", utf8())}), R"([
+    [1.0,   "alfa"],
+    [null,  "alfa"],
+    [0.0,   "beta"],
+    [null,  "gama"],
+    [4.0,    null ],
+    [3.25,  "alfa"],
+    [0.125, "beta"],
+    [-0.25, "beta"],
+    [0.75,   null ],
+    [null,  "gama"]
+  ])");
+
+  ScalarAggregateOptions min_count{true, 3};
+  VarianceOptions ddof{1};
+
+  using internal::Aggregate;
+  for (auto agg : {
+           Aggregate{"hash_mean", nullptr},
+           Aggregate{"hash_mean", &min_count},
+           Aggregate{"hash_variance", nullptr},
+           Aggregate{"hash_variance", &ddof},
+           Aggregate{"hash_stddev", nullptr},
+           Aggregate{"hash_stddev", &ddof},
+       }) {
+    SCOPED_TRACE(agg.function);
+    ValidateGroupBy({agg}, {batch->GetColumnByName("argument")},
+                    {batch->GetColumnByName("key")}, /*approx=*/true);
+  }
+}
+
+TEST(GroupBy, AnyAndAll) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", boolean()), field("key", int64())}), R"([
+    [true,  1],
+    [null,  1],
+    [false, 2],
+    [null,  3],
+    [true,  null],
+    [false, 1],
+    [false, 2],
+    [true,  4],
+    [true,  null],
+    [null,  3]
+  ])");
+
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       internal::GroupBy({batch->GetColumnByName("argument"),
+                                          batch->GetColumnByName("argument")},
+                                         {batch->GetColumnByName("key")},
+                                         {
+                                             {"hash_any", nullptr},
+                                             {"hash_all", nullptr},
+                                         }));
+
+  AssertDatumsEqual(ArrayFromJSON(struct_({
+                                      field("hash_any", boolean()),
+                                      field("hash_all", boolean()),
+                                      field("key_0", int64()),
+                                  }),
+                                  R"([
+    [true,  false, 1],
+    [false, false, 2],
+    [false, true,  3],
+    [true,  true,  null],
+    [true,  true,  4]
+  ])"),
+                    aggregated_and_grouped,
+                    /*verbose=*/true);
+}
+
+TEST(GroupBy, CountDistinct) {
+  auto table =
+      TableFromJSON(schema({field("argument", utf8()), field("key", int64())}),
+                    {R"([{"argument": "foo", "key": 1},
+                         {"argument": "bar", "key": 1},
+                         {"argument": null,  "key": 2}
+                        ])",
+                     R"([{"argument": "foo", "key": 1},
+                         {"argument": "foo", "key": 2},
+                         {"argument": null,  "key": 2},
+                         {"argument": null,  "key": 3},
+                         {"argument": "baz", "key": null},
+                         {"argument": "foo", "key": 2},
+                         {"argument": "bar", "key": null}
+                        ])"});
+
+  ScalarAggregateOptions keepna{false};
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       internal::GroupBy(
+                           {
+                               table->GetColumnByName("argument"),
+                               table->GetColumnByName("argument"),
+                           },
+                           {
+                               table->GetColumnByName("key"),
+                           },
+                           {
+                               {"hash_count_distinct", nullptr},
+                               {"hash_count_distinct", &keepna},
+                           }));
+
+  AssertDatumsEqual(ArrayFromJSON(struct_({
+                                      field("hash_count_distinct", int64()),
+                                      field("hash_count_distinct", int64()),
+                                      field("key_0", int64()),
+                                  }),
+                                  R"([
+    [2, 2, 1],
+    [1, 2, 2],
+    [0, 1, 3],
+    [2, 2, null]
+  ])"),
+                    aggregated_and_grouped,
+                    /*verbose=*/true);
+}
+
 // Count nulls/non_nulls from record batch with no nulls
 TEST(GroupBy, CountNull) {
   auto batch = RecordBatchFromJSON(
@@ -762,6 +945,129 @@ TEST(GroupBy, RandomArraySum) {
   }
 }
 
+TEST(GroupBy, RandomArrayStatistics) {
+  for (int64_t length : {1 << 10, 1 << 12, 1 << 15}) {
+    for (auto null_probability : {0.0, 0.01, 0.5, 1.0}) {
+      auto metadata = key_value_metadata(
+          {{"null_probability", std::to_string(null_probability)}, {"min", "-100"},
+           {"max", "100"}});
+      auto batch = random::GenerateBatch(
+          {
+              field("argument", float64(), metadata),
+              field("integers", int32(), metadata),
+              field("key", int64(), key_value_metadata({{"min", "0"}, {"max", "100"}})),
+          },
+          length, 0xDEADBEEF);
+
+      ValidateGroupBy(
+          {
+              {"hash_mean", nullptr},
+              {"hash_mean", nullptr},
+              {"hash_variance", nullptr},
+              {"hash_stddev", nullptr},
+          },
+          {batch->GetColumnByName("argument"), batch->GetColumnByName("integers"),
+           batch->GetColumnByName("argument"), batch->GetColumnByName("integers")},
+          {batch->GetColumnByName("key")}, /*approx=*/true);
+    }
+  }
+}
+
+TEST(GroupBy, RandomArrayAnyAndAll) {
+  for (auto null_probability : {0.0, 0.5, 1.0}) {
+    for (auto true_probability : {0.0, 0.01, 0.99, 1.0}) {
+      auto batch = random::GenerateBatch(
+          {
+              field("argument", boolean(),
+                    key_value_metadata(
+                        {{"null_probability", std::to_string(null_probability)},
+                         {"true_probability", std::to_string(true_probability)}})),
+              field("key", int64(), key_value_metadata({{"min", "0"}, {"max", "100"}})),
+          },
+          1 << 12, 0xDEADBEEF);
+
+      ValidateGroupBy(
+          {
+              {"hash_any", nullptr},
+              {"hash_all", nullptr},
+          },
+          {batch->GetColumnByName("argument"), batch->GetColumnByName("argument")},
+          {batch->GetColumnByName("key")});
+    }
+  }
+}
+
+TEST(GroupBy, RandomArrayTDigest) {
+  auto batch = random::GenerateBatch(
+      {
+          field("argument", float64(),
+                key_value_metadata({{"null_probability", "0.1"}})),
+          field("key", int64(),
+                key_value_metadata(
+                    {{"null_probability", "0"}, {"min", "0"}, {"max", "20"}})),
+      },
+      1 << 14, 0xDEADBEEF);
+
+  TDigestOptions options(std::vector<double>{0.1, 0.5, 0.9});
+  ASSERT_OK_AND_ASSIGN(
+      Datum aggregated_and_grouped,
+      internal::GroupBy({batch->GetColumnByName("argument")},
+                        {batch->GetColumnByName("key")}, {{"hash_tdigest", &options}}));
+  ValidateOutput(aggregated_and_grouped);
+
+  const auto& out = aggregated_and_grouped.array_as<StructArray>();
+  ASSERT_TRUE(out->field(0)->type()->Equals(fixed_size_list(float64(), 3)));
+  const auto& quantiles = checked_cast<const FixedSizeListArray&>(*out->field(0));
+  const auto& keys = checked_cast<const Int64Array&>(*out->field(1));
+
+  // Values are consumed in order, so each group's digest matches the one built by
+  // the scalar kernel from that group's values
+  for (int64_t i = 0; i < out->length(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto key, keys.GetScalar(i));
+    ASSERT_OK_AND_ASSIGN(Datum mask,
+                         CallFunction("equal", {batch->GetColumnByName("key"), key}));
+    ASSERT_OK_AND_ASSIGN(Datum group_values,
+                         Filter(batch->GetColumnByName("argument"), mask));
+    ASSERT_OK_AND_ASSIGN(Datum expected, TDigest(group_values, options));
+    AssertArraysEqual(*expected.make_array(), *quantiles.value_slice(i),
+                      /*verbose=*/true);
+  }
+}
+
+TEST(GroupBy, TDigestEmptyGroups) {
+  // Groups without valid values are null, including those which get their first
+  // valid value in a later chunk
+  auto table =
+      TableFromJSON(schema({field("argument", float64()), field("key", int64())}),
+                    {R"([{"argument": null,  "key": 1},
+                         {"argument": null,  "key": 2},
+                         {"argument": null,  "key": null}
+                        ])",
+                     R"([{"argument": 5.0,   "key": 4},
+                         {"argument": 2.0,   "key": 1},
+                         {"argument": null,  "key": 2}
+                        ])"});
+  TDigestOptions options;
+  ASSERT_OK_AND_ASSIGN(
+      Datum aggregated_and_grouped,
+      internal::GroupBy({table->GetColumnByName("argument")},
+                        {table->GetColumnByName("key")}, {{"hash_tdigest", &options}}));
+  ValidateOutput(aggregated_and_grouped);
+
+  auto expected_type = struct_({
+      field("hash_tdigest", fixed_size_list(float64(), 1)),
+      field("key_0", int64()),
+  });
+  AssertDatumsEqual(ArrayFromJSON(expected_type, R"([
+    [[2.0], 1],
+    [null,  2],
+    [null,  null],
+    [[5.0], 4]
+  ])"),
+                    aggregated_and_grouped,
+                    /*verbose=*/true);
+}
+
 TEST(GroupBy, WithChunkedArray) {
   auto table =
       TableFromJSON(schema({field("argument", float64()), field("key", int64())}),
@@ -24,6 +24,8 @@
 #include <utf8proc.h>
 #endif
 
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -840,6 +842,26 @@ TYPED_TEST(TestStringKernels, MatchLikeEscaping) {
   this->CheckUnary("match_like", R"(["\n\tfoo\t", "\n\t", "\n"])", boolean(),
                    "[true, true, false]", &escape_sequences);
 }
+
+TYPED_TEST(TestStringKernels, MatchLikeParallel) {
+  // match_like swaps the state of its kernel context while executing, which must
+  // not leak into other chunks executing in parallel
+  auto input = ArrayFromJSON(this->type(), R"(["foo", "bar", "xfoox", null, "fo"])");
+  auto expected = ArrayFromJSON(boolean(), "[true, false, true, null, false]");
+  ASSERT_OK_AND_ASSIGN(auto input_chunk, Concatenate(ArrayVector(5000, input)));
+  ASSERT_OK_AND_ASSIGN(auto expected_chunk, Concatenate(ArrayVector(5000, expected)));
+  auto chunked_input = std::make_shared<ChunkedArray>(ArrayVector(8, input_chunk));
+  auto chunked_expected = std::make_shared<ChunkedArray>(ArrayVector(8, expected_chunk));
+
+  MatchSubstringOptions options{"%foo%"};
+  ExecContext ctx;
+  ctx.set_use_threads(true);
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         CallFunction("match_like", {chunked_input}, &options, &ctx));
+    AssertDatumsEqual(chunked_expected, actual, /*verbose=*/true);
+  }
+}
 #endif
 
 TYPED_TEST(TestStringKernels, FindSubstring) {
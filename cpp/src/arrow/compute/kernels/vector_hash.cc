@@ -723,6 +723,8 @@ const FunctionDoc dictionary_encode_doc(
 void RegisterVectorHash(FunctionRegistry* registry) {
   VectorKernel base;
   base.exec = HashExec;
+  // The kernels accumulate into a hash table shared by all chunks of the input
+  base.parallelizable = false;
 
   // ----------------------------------------------------------------------
   // unique
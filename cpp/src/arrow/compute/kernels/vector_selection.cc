@@ -25,9 +25,11 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/extension_type.h"
@@ -1918,29 +1920,354 @@ Result<std::shared_ptr<Array>> TakeAA(const Array& values, const Array& indices,
   return result.make_array();
 }
 
+// ----------------------------------------------------------------------
+// Take from a ChunkedArray without concatenating its chunks
+//
+// Indices must have been boundschecked.
+
+// Gather fixed-width values directly from the chunk of each index.  kBitWidth
+// is the bit width of the values, or 0 if it is only known at runtime.
+template <typename IndexType, int kBitWidth>
+Result<std::shared_ptr<Array>> TakeCAFixedWidth(const ChunkedArray& values,
+                                                const ArrayData& indices,
+                                                MemoryPool* pool) {
+  using IndexCType = typename IndexType::c_type;
+
+  struct ChunkView {
+    const uint8_t* is_valid;
+    const uint8_t* data;
+    int64_t offset;
+  };
+  std::vector<ChunkView> chunks;
+  bool may_have_nulls = indices.MayHaveNulls();
+  for (const auto& chunk : values.chunks()) {
+    const ArrayData& data = *chunk->data();
+    // An empty chunk may have no values buffer, indices never resolve to it
+    chunks.push_back({data.MayHaveNulls() ? data.buffers[0]->data() : nullptr,
+                      data.buffers[1] ? data.buffers[1]->data() : nullptr, data.offset});
+    may_have_nulls |= data.MayHaveNulls();
+  }
+  ChunkResolver resolver(values.chunks());
+
+  const int64_t length = indices.length;
+  const int bit_width =
+      kBitWidth != 0 ? kBitWidth
+                     : checked_cast<const FixedWidthType&>(*values.type()).bit_width();
+  const int64_t byte_width = bit_width / 8;
+  std::shared_ptr<Buffer> out_is_valid;
+  std::shared_ptr<Buffer> out_data;
+  if (may_have_nulls) {
+    ARROW_ASSIGN_OR_RAISE(out_is_valid, AllocateEmptyBitmap(length, pool));
+  }
+  if (bit_width == 1) {
+    ARROW_ASSIGN_OR_RAISE(out_data, AllocateEmptyBitmap(length, pool));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(out_data, AllocateBuffer(length * byte_width, pool));
+    if (may_have_nulls) {
+      // Zero the slots of nulls
+      std::memset(out_data->mutable_data(), 0, length * byte_width);
+    }
+  }
+  uint8_t* is_valid = may_have_nulls ? out_is_valid->mutable_data() : nullptr;
+  uint8_t* data = out_data->mutable_data();
+  auto copy_value = [&](int64_t position, const ChunkView& chunk, int64_t chunk_index) {
+    if (bit_width == 1) {
+      BitUtil::SetBitTo(data, position, BitUtil::GetBit(chunk.data, chunk_index));
+    } else {
+      std::memcpy(data + position * byte_width, chunk.data + chunk_index * byte_width,
+                  byte_width);
+    }
+  };
+
+  // Resolve the chunks of a batch of indices before gathering their values.
+  // Otherwise each value load waits on the chunk search for its index, and
+  // cache misses on randomly accessed values can't overlap with each other.
+  // The resolver's cached chunk is only used while most indices fall in the
+  // same chunk as the previous one, as with sorted indices.
+  constexpr int64_t kBatchSize = 1024;
+  bool use_cache = true;
+  ChunkLocation locations[kBatchSize];
+  const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+  const uint8_t* indices_is_valid =
+      indices.MayHaveNulls() ? indices.buffers[0]->data() : nullptr;
+
+  int64_t valid_count = 0;
+  for (int64_t batch_start = 0; batch_start < length; batch_start += kBatchSize) {
+    const int64_t batch_length = std::min(kBatchSize, length - batch_start);
+    int64_t same_chunk_count = 0;
+    int64_t previous_chunk = -1;
+    for (int64_t i = 0; i < batch_length; ++i) {
+      const int64_t position = batch_start + i;
+      if (indices_is_valid != nullptr &&
+          !BitUtil::GetBit(indices_is_valid, indices.offset + position)) {
+        locations[i] = {-1, 0};
+        continue;
+      }
+      const auto index = static_cast<int64_t>(raw_indices[position]);
+      locations[i] =
+          use_cache ? resolver.Resolve(index) : resolver.ResolveUncached(index);
+      same_chunk_count += locations[i].chunk_index == previous_chunk;
+      previous_chunk = locations[i].chunk_index;
+    }
+    use_cache = same_chunk_count * 2 >= batch_length;
+    if (!may_have_nulls) {
+      for (int64_t i = 0; i < batch_length; ++i) {
+        const ChunkView& chunk = chunks[locations[i].chunk_index];
+        copy_value(batch_start + i, chunk, chunk.offset + locations[i].index_in_chunk);
+      }
+      continue;
+    }
+    for (int64_t i = 0; i < batch_length; ++i) {
+      if (locations[i].chunk_index < 0) continue;
+      const ChunkView& chunk = chunks[locations[i].chunk_index];
+      const int64_t chunk_index = chunk.offset + locations[i].index_in_chunk;
+      if (chunk.is_valid != nullptr && !BitUtil::GetBit(chunk.is_valid, chunk_index)) {
+        continue;
+      }
+      const int64_t position = batch_start + i;
+      BitUtil::SetBit(is_valid, position);
+      ++valid_count;
+      copy_value(position, chunk, chunk_index);
+    }
+  }
+
+  const int64_t null_count = may_have_nulls ? length - valid_count : 0;
+  if (null_count == 0) {
+    out_is_valid = nullptr;
+  }
+  return MakeArray(ArrayData::Make(values.type(), length,
+                                   {std::move(out_is_valid), std::move(out_data)},
+                                   null_count));
+}
+
+// Partition the indices by chunk and take from each chunk separately, then put
+// the results back in the order of the indices.  Only values which are taken
+// are copied (up to three times), however large the chunked array is.
+//
+// When the chunks of the indices are non-decreasing, as when they are sorted or
+// all fall in the same chunk, each partition is a slice of the indices and
+// reordering isn't needed.
+template <typename IndexType>
+Result<std::shared_ptr<Array>> TakeCAPartitioned(const ChunkedArray& values,
+                                                 const ArrayData& indices,
+                                                 ExecContext* ctx) {
+  using IndexCType = typename IndexType::c_type;
+
+  const int64_t num_chunks = values.num_chunks();
+  const int64_t length = indices.length;
+  ChunkResolver resolver(values.chunks());
+
+  // Null indices are attributed to the same chunk as the previous index, or to
+  // the first non-empty chunk if there is none, so as to never take from an
+  // empty chunk.
+  int64_t first_chunk = 0;
+  while (values.chunk(static_cast<int>(first_chunk))->length() == 0) {
+    ++first_chunk;
+  }
+
+  // First pass: count the indices falling in each chunk
+  std::vector<int64_t> chunk_lengths(num_chunks, 0);
+  int64_t current_chunk = first_chunk;
+  bool in_order = true;
+  VisitArrayDataInline<IndexType>(
+      indices,
+      [&](IndexCType index) {
+        const auto chunk_index =
+            resolver.Resolve(static_cast<int64_t>(index)).chunk_index;
+        in_order &= chunk_index >= current_chunk;
+        current_chunk = chunk_index;
+        ++chunk_lengths[current_chunk];
+      },
+      [&]() { ++chunk_lengths[current_chunk]; });
+
+  std::vector<int64_t> chunk_starts(num_chunks, 0);
+  for (int64_t i = 1; i < num_chunks; ++i) {
+    chunk_starts[i] = chunk_starts[i - 1] + chunk_lengths[i - 1];
+  }
+
+  // Second pass: write the indices rebased into their chunk, grouped by chunk,
+  // along with the position of each index in the grouped indices.
+  MemoryPool* pool = ctx->memory_pool();
+  ARROW_ASSIGN_OR_RAISE(auto grouped_data,
+                        AllocateBuffer(length * sizeof(int64_t), pool));
+  std::shared_ptr<Buffer> grouped_is_valid;
+  if (indices.MayHaveNulls()) {
+    ARROW_ASSIGN_OR_RAISE(grouped_is_valid, AllocateEmptyBitmap(length, pool));
+  }
+  std::shared_ptr<Buffer> positions_data;
+  if (!in_order) {
+    ARROW_ASSIGN_OR_RAISE(positions_data, AllocateBuffer(length * sizeof(int64_t), pool));
+  }
+  auto grouped = reinterpret_cast<int64_t*>(grouped_data->mutable_data());
+  auto positions = in_order ? nullptr
+                            : reinterpret_cast<int64_t*>(positions_data->mutable_data());
+
+  std::vector<int64_t> cursors = chunk_starts;
+  int64_t position = 0;
+  current_chunk = first_chunk;
+  VisitArrayDataInline<IndexType>(
+      indices,
+      [&](IndexCType index) {
+        const auto loc = resolver.Resolve(static_cast<int64_t>(index));
+        current_chunk = loc.chunk_index;
+        const int64_t grouped_position = cursors[current_chunk]++;
+        grouped[grouped_position] = loc.index_in_chunk;
+        if (grouped_is_valid) {
+          BitUtil::SetBit(grouped_is_valid->mutable_data(), grouped_position);
+        }
+        if (positions) {
+          positions[position] = grouped_position;
+        }
+        ++position;
+      },
+      [&]() {
+        const int64_t grouped_position = cursors[current_chunk]++;
+        grouped[grouped_position] = 0;
+        if (positions) {
+          positions[position] = grouped_position;
+        }
+        ++position;
+      });
+  const auto grouped_indices =
+      std::make_shared<Int64Array>(length, std::move(grouped_data),
+                                   std::move(grouped_is_valid), indices.null_count);
+
+  // Take from each chunk which has any indices
+  ArrayVector taken;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    if (chunk_lengths[i] == 0) continue;
+    ARROW_ASSIGN_OR_RAISE(
+        auto chunk_taken,
+        TakeAA(*values.chunk(static_cast<int>(i)),
+               *grouped_indices->Slice(chunk_starts[i], chunk_lengths[i]),
+               TakeOptions::NoBoundsCheck(), ctx));
+    taken.push_back(std::move(chunk_taken));
+  }
+  std::shared_ptr<Array> result;
+  if (taken.size() == 1) {
+    result = std::move(taken[0]);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(result, Concatenate(taken, pool));
+  }
+
+  if (!in_order) {
+    // Restore the order of the indices
+    Int64Array positions_array(length, std::move(positions_data));
+    ARROW_ASSIGN_OR_RAISE(
+        result, TakeAA(*result, positions_array, TakeOptions::NoBoundsCheck(), ctx));
+  }
+  return result;
+}
+
+// Whether the non-null indices are in non-decreasing order
+template <typename IndexType>
+bool IndicesAreSorted(const ArrayData& indices) {
+  using IndexCType = typename IndexType::c_type;
+  if (!indices.MayHaveNulls()) {
+    const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+    return std::is_sorted(raw_indices, raw_indices + indices.length);
+  }
+  bool sorted = true;
+  IndexCType previous = 0;
+  VisitArrayDataInline<IndexType>(
+      indices,
+      [&](IndexCType index) {
+        sorted &= index >= previous;
+        previous = index;
+      },
+      [] {});
+  return sorted;
+}
+
+// Taking from the chunks directly pays a chunk search per index instead of a
+// copy per value, so it is only done when there are comparatively few indices
+// or when they are sorted, which makes the searches cheap.  Otherwise `values`
+// is concatenated, only once for all the indices if `concatenated_values` is
+// reused.
+constexpr int64_t kMinValuesPerIndexForChunkedTake = 16;
+
+template <typename IndexType>
+Result<std::shared_ptr<Array>> TakeCAImpl(const ChunkedArray& values,
+                                          const Array& indices, ExecContext* ctx,
+                                          std::shared_ptr<Array>* concatenated_values) {
+  if (indices.length() * kMinValuesPerIndexForChunkedTake > values.length() &&
+      !IndicesAreSorted<IndexType>(*indices.data())) {
+    if (*concatenated_values == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(*concatenated_values,
+                            Concatenate(values.chunks(), ctx->memory_pool()));
+    }
+    return TakeAA(**concatenated_values, indices, TakeOptions::NoBoundsCheck(), ctx);
+  }
+
+  const auto type_id = values.type()->id();
+  if (!is_primitive(type_id) && !is_fixed_size_binary(type_id)) {
+    return TakeCAPartitioned<IndexType>(values, *indices.data(), ctx);
+  }
+  MemoryPool* pool = ctx->memory_pool();
+  const ArrayData& data = *indices.data();
+  switch (checked_cast<const FixedWidthType&>(*values.type()).bit_width()) {
+    case 1:
+      return TakeCAFixedWidth<IndexType, 1>(values, data, pool);
+    case 8:
+      return TakeCAFixedWidth<IndexType, 8>(values, data, pool);
+    case 16:
+      return TakeCAFixedWidth<IndexType, 16>(values, data, pool);
+    case 32:
+      return TakeCAFixedWidth<IndexType, 32>(values, data, pool);
+    case 64:
+      return TakeCAFixedWidth<IndexType, 64>(values, data, pool);
+    default:
+      return TakeCAFixedWidth<IndexType, 0>(values, data, pool);
+  }
+}
+
+Result<std::shared_ptr<Array>> TakeCAToArray(
+    const ChunkedArray& values, const Array& indices, const TakeOptions& options,
+    ExecContext* ctx, std::shared_ptr<Array>* concatenated_values) {
+  // Case 1: `values` has a single chunk, so just use it
+  if (values.num_chunks() == 1) {
+    return TakeAA(*values.chunk(0), indices, options, ctx);
+  }
+
+  // Case 2: resolve the chunk of each index
+  if (!is_integer(indices.type_id())) {
+    return Status::NotImplemented("Indices must be integers, got ", *indices.type());
+  }
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(*indices.data(), values.length()));
+  }
+  if (indices.length() == indices.null_count()) {
+    // Also handles empty `values`, which can't be resolved into
+    return MakeArrayOfNull(values.type(), indices.length(), ctx->memory_pool());
+  }
+  switch (indices.type_id()) {
+    case Type::UINT8:
+      return TakeCAImpl<UInt8Type>(values, indices, ctx, concatenated_values);
+    case Type::INT8:
+      return TakeCAImpl<Int8Type>(values, indices, ctx, concatenated_values);
+    case Type::UINT16:
+      return TakeCAImpl<UInt16Type>(values, indices, ctx, concatenated_values);
+    case Type::INT16:
+      return TakeCAImpl<Int16Type>(values, indices, ctx, concatenated_values);
+    case Type::UINT32:
+      return TakeCAImpl<UInt32Type>(values, indices, ctx, concatenated_values);
+    case Type::INT32:
+      return TakeCAImpl<Int32Type>(values, indices, ctx, concatenated_values);
+    case Type::UINT64:
+      return TakeCAImpl<UInt64Type>(values, indices, ctx, concatenated_values);
+    default:
+      return TakeCAImpl<Int64Type>(values, indices, ctx, concatenated_values);
+  }
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
                                              ExecContext* ctx) {
-  auto num_chunks = values.num_chunks();
+  std::shared_ptr<Array> concatenated_values;
   std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
-
-  // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
-  } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
-    ARROW_ASSIGN_OR_RAISE(current_chunk,
-                          Concatenate(values.chunks(), ctx->memory_pool()));
-  }
-  // Call Array Take on our single chunk
-  ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeAA(*current_chunk, indices, options, ctx));
+  ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeCAToArray(values, indices, options, ctx,
+                                                     &concatenated_values));
   return std::make_shared<ChunkedArray>(std::move(new_chunks));
 }
 
@@ -1950,15 +2277,11 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
                                              ExecContext* ctx) {
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
+  std::shared_ptr<Array> concatenated_values;
   for (int i = 0; i < num_chunks; i++) {
     // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
-                          TakeCA(values, *indices.chunk(i), options, ctx));
-    // Concatenate the result to make a single array for this chunk
-    ARROW_ASSIGN_OR_RAISE(new_chunks[i],
-                          Concatenate(current_chunk->chunks(), ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(new_chunks[i], TakeCAToArray(values, *indices.chunk(i), options,
+                                                       ctx, &concatenated_values));
   }
   return std::make_shared<ChunkedArray>(std::move(new_chunks));
 }
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <sstream>
 
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -106,14 +107,21 @@ struct TakeBenchmark {
   random::RandomArrayGenerator rand;
   bool indices_have_nulls;
   bool monotonic_indices = false;
+  // If greater than 1, take from a ChunkedArray with this many chunks
+  int64_t num_chunks = 1;
+  // Ratio of the number of values to the number of indices
+  int64_t values_per_index = 1;
 
   TakeBenchmark(benchmark::State& state, bool indices_have_nulls,
-                bool monotonic_indices = false)
+                bool monotonic_indices = false, int64_t num_chunks = 1,
+                int64_t values_per_index = 1)
       : state(state),
         args(state, /*size_is_bytes=*/false),
         rand(kSeed),
         indices_have_nulls(indices_have_nulls),
-        monotonic_indices(monotonic_indices) {}
+        monotonic_indices(monotonic_indices),
+        num_chunks(num_chunks),
+        values_per_index(values_per_index) {}
 
   void Int64() {
     auto values = rand.Int64(args.size, -100, 100, args.null_proportion);
@@ -137,15 +145,29 @@ struct TakeBenchmark {
 
   void Bench(const std::shared_ptr<Array>& values) {
     double indices_null_proportion = indices_have_nulls ? args.null_proportion : 0;
-    auto indices =
-        rand.Int32(values->length(), 0, static_cast<int32_t>(values->length() - 1),
-                   indices_null_proportion);
+    auto indices = rand.Int32(values->length() / values_per_index, 0,
+                              static_cast<int32_t>(values->length() - 1),
+                              indices_null_proportion);
 
     if (monotonic_indices) {
       auto arg_sorter = *SortIndices(*indices);
       indices = *Take(*indices, *arg_sorter);
     }
 
+    if (num_chunks > 1) {
+      ArrayVector chunks;
+      const int64_t chunk_length = values->length() / num_chunks;
+      for (int64_t i = 0; i < num_chunks - 1; ++i) {
+        chunks.push_back(values->Slice(i * chunk_length, chunk_length));
+      }
+      chunks.push_back(values->Slice((num_chunks - 1) * chunk_length));
+      auto chunked_values = std::make_shared<ChunkedArray>(std::move(chunks));
+      for (auto _ : state) {
+        ABORT_NOT_OK(Take(chunked_values, indices).status());
+      }
+      return;
+    }
+
     for (auto _ : state) {
       ABORT_NOT_OK(Take(values, indices).status());
     }
@@ -307,6 +329,31 @@ static void TakeStringMonotonicIndices(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).FSLInt64();
 }
 
+static void TakeChunkedInt64RandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, false, /*num_chunks=*/100).Int64();
+}
+
+static void TakeChunkedInt64FewRandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, false, /*num_chunks=*/100, /*values_per_index=*/64).Int64();
+}
+
+static void TakeChunkedInt64MonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, /*monotonic=*/true, /*num_chunks=*/100).Int64();
+}
+
+static void TakeChunkedStringRandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, false, /*num_chunks=*/100).String();
+}
+
+static void TakeChunkedStringFewRandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, false, /*num_chunks=*/100, /*values_per_index=*/64)
+      .String();
+}
+
+static void TakeChunkedStringMonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, /*monotonic=*/true, /*num_chunks=*/100).String();
+}
+
 void FilterSetArgs(benchmark::internal::Benchmark* bench) {
   for (int64_t size : g_data_sizes) {
     for (int i = 0; i < static_cast<int>(g_filter_params.size()); ++i) {
@@ -349,6 +396,12 @@ BENCHMARK(TakeFSLInt64MonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedInt64RandomIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedInt64FewRandomIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedInt64MonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringRandomIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringFewRandomIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringMonotonicIndices)->Apply(TakeSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
@@ -902,6 +902,24 @@ void ValidateTake(const std::shared_ptr<Array>& values,
   auto taken = out.make_array();
   ValidateOutput(taken);
   ASSERT_EQ(indices->length(), taken->length());
+
+  // Taking from chunked values gives the same result, including with few
+  // enough indices for the chunks to be taken from without concatenating them
+  const int64_t chunk_length = values->length() / 3;
+  auto chunked_values = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, chunk_length), values->Slice(chunk_length, 0),
+                  values->Slice(chunk_length, chunk_length),
+                  values->Slice(2 * chunk_length)});
+  for (const auto& some_indices :
+       {indices, indices->Slice(0, std::min<int64_t>(indices->length(),
+                                                     values->length() / 16))}) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, Take(values, some_indices));
+    ASSERT_OK_AND_ASSIGN(Datum chunked_out, Take(chunked_values, some_indices));
+    ValidateOutput(chunked_out);
+    ASSERT_EQ(chunked_out.chunked_array()->num_chunks(), 1);
+    AssertArraysEqual(*expected.make_array(), *chunked_out.chunked_array()->chunk(0),
+                      /*verbose=*/true);
+  }
   switch (indices->type_id()) {
     case Type::INT8:
       ValidateTakeImpl<ValuesType, Int8Type>(values, indices, taken);
@@ -1549,6 +1567,62 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeManyChunks) {
+  // Fixed-width values
+  const std::vector<std::string> int_values = {"[7, null]", "[]", "[8, 9, 10]", "[11]"};
+  this->AssertTake(int32(), int_values, "[5, 0, 2, null, 1, 4]",
+                   {"[11, 7, 8, null, null, 10]"});
+  this->AssertTake(int32(), int_values, "[null, null]", {"[null, null]"});
+  this->AssertTake(int32(), int_values, "[]", {"[]"});
+  this->AssertChunkedTake(int32(), int_values, {"[4, 0]", "[]", "[null, 3]"},
+                          {"[10, 7]", "[]", "[null, 9]"});
+  this->AssertTake(boolean(), {"[true]", "[false, null]", "[true]"}, "[3, 1, 2, 0]",
+                   {"[true, false, null, true]"});
+  this->AssertTake(fixed_size_binary(2), {"[\"ab\"]", "[\"cd\", null]"},
+                   "[2, 1, null, 0]", {"[null, \"cd\", null, \"ab\"]"});
+
+  // Other values
+  const std::vector<std::string> str_values = {"[\"a\", null]", "[]", "[\"b\", \"c\"]",
+                                               "[\"d\"]"};
+  // Unordered
+  this->AssertTake(utf8(), str_values, "[4, 0, 2, null, 1, 3, 0]",
+                   {"[\"d\", \"a\", \"b\", null, null, \"c\", \"a\"]"});
+  // Sorted
+  this->AssertTake(utf8(), str_values, "[null, 0, 0, 1, 3, null, 4]",
+                   {"[null, \"a\", \"a\", null, \"c\", null, \"d\"]"});
+  // All in the same chunk
+  this->AssertTake(utf8(), str_values, "[3, null, 2, 3]",
+                   {"[\"c\", null, \"b\", \"c\"]"});
+  this->AssertTake(utf8(), str_values, "[null]", {"[null]"});
+  this->AssertChunkedTake(utf8(), str_values, {"[4, 1]", "[]", "[2, 0]"},
+                          {"[\"d\", null]", "[]", "[\"b\", \"a\"]"});
+  this->AssertTake(list(int32()), {"[[1], null]", "[[2, 3]]"}, "[2, 1, 0]",
+                   {"[[2, 3], null, [1]]"});
+
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_RAISES(IndexError, this->TakeWithArray(utf8(), str_values, "[0, 5]", &arr));
+  ASSERT_RAISES(IndexError, this->TakeWithArray(int32(), int_values, "[-1]", &arr));
+}
+
+TEST_F(TestTakeKernelWithChunkedArray, TakeEmptyChunkWithoutBuffers) {
+  // An empty chunk may have no values buffer
+  auto check = [](const std::shared_ptr<DataType>& type, const std::string& values,
+                  const std::string& expected) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    auto empty = MakeArray(ArrayData::Make(type, 0, {nullptr, nullptr}, 0));
+    ASSERT_OK(empty->ValidateFull());
+    auto chunked_values = std::make_shared<ChunkedArray>(
+        ArrayVector{empty, ArrayFromJSON(type, values), empty});
+    ASSERT_OK_AND_ASSIGN(Datum actual, Take(chunked_values,
+                                            ArrayFromJSON(int8(), "[1, 0, null, 0]")));
+    ValidateOutput(actual);
+    AssertChunkedEqual(*ChunkedArrayFromJSON(type, {expected}), *actual.chunked_array());
+  };
+  check(int32(), "[7, null]", "[null, 7, null, 7]");
+  check(boolean(), "[true, null]", "[null, true, null, true]");
+  check(fixed_size_binary(2), R"(["ab", null])", R"([null, "ab", null, "ab"])");
+}
+
 class TestTakeKernelWithTable : public TestTakeKernelTyped<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
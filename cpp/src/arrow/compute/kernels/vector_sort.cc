@@ -19,18 +19,28 @@
 #include <cmath>
 #include <limits>
 #include <numeric>
+#include <string>
 #include <type_traits>
 #include <utility>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/array/data.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -94,69 +104,18 @@ struct ResolvedChunk<Array> {
 // An object that resolves an array chunk depending on the index.
 struct ChunkedArrayResolver {
   explicit ChunkedArrayResolver(const std::vector<const Array*>& chunks)
-      : num_chunks_(static_cast<int64_t>(chunks.size())),
-        chunks_(chunks.data()),
-        offsets_(MakeEndOffsets(chunks)),
-        cached_chunk_(0) {}
+      : chunks_(chunks.data()), resolver_(chunks) {}
 
   template <typename ArrayType>
   ResolvedChunk<ArrayType> Resolve(int64_t index) const {
-    // It is common for the algorithms below to make consecutive accesses at
-    // a relatively small distance from each other, hence often falling in
-    // the same chunk.
-    // This is trivial when merging (assuming each side of the merge uses
-    // its own resolver), but also in the inner recursive invocations of
-    // partitioning.
-    const bool cache_hit =
-        (index >= offsets_[cached_chunk_] && index < offsets_[cached_chunk_ + 1]);
-    if (ARROW_PREDICT_TRUE(cache_hit)) {
-      return ResolvedChunk<ArrayType>(
-          checked_cast<const ArrayType*>(chunks_[cached_chunk_]),
-          index - offsets_[cached_chunk_]);
-    } else {
-      return ResolveMissBisect<ArrayType>(index);
-    }
+    const auto loc = resolver_.Resolve(index);
+    return ResolvedChunk<ArrayType>(
+        checked_cast<const ArrayType*>(chunks_[loc.chunk_index]), loc.index_in_chunk);
   }
 
  private:
-  template <typename ArrayType>
-  ResolvedChunk<ArrayType> ResolveMissBisect(int64_t index) const {
-    // Like std::upper_bound(), but hand-written as it can help the compiler.
-    const int64_t* raw_offsets = offsets_.data();
-    // Search [lo, lo + n)
-    int64_t lo = 0, n = num_chunks_;
-    while (n > 1) {
-      int64_t m = n >> 1;
-      int64_t mid = lo + m;
-      if (index >= raw_offsets[mid]) {
-        lo = mid;
-        n -= m;
-      } else {
-        n = m;
-      }
-    }
-    cached_chunk_ = lo;
-    return ResolvedChunk<ArrayType>(checked_cast<const ArrayType*>(chunks_[lo]),
-                                    index - offsets_[lo]);
-  }
-
-  static std::vector<int64_t> MakeEndOffsets(const std::vector<const Array*>& chunks) {
-    std::vector<int64_t> end_offsets(chunks.size() + 1);
-    int64_t offset = 0;
-    end_offsets[0] = 0;
-    std::transform(chunks.begin(), chunks.end(), end_offsets.begin() + 1,
-                   [&](const Array* chunk) {
-                     offset += chunk->length();
-                     return offset;
-                   });
-    return end_offsets;
-  }
-
-  int64_t num_chunks_;
   const Array* const* chunks_;
-  std::vector<int64_t> offsets_;
-
-  mutable int64_t cached_chunk_;
+  ChunkResolver resolver_;
 };
 
 // We could try to reproduce the concrete Array classes' facilities
@@ -1548,6 +1507,380 @@ class MultipleKeyTableSorter : public TypeVisitor {
   Comparator comparator_;
 };
 
+// ----------------------------------------------------------------------
+// Merging sorted runs
+
+// A sort key resolved against several sorted runs, for merging them.
+//
+// The "index" compared by MultipleKeyComparator is a run number, and the
+// compared row is the current head of that run.
+struct MergeSortKey {
+  MergeSortKey(int field_index, const std::shared_ptr<DataType>& type, SortOrder order,
+               const std::vector<int64_t>* heads)
+      : field_index(field_index),
+        type(GetPhysicalType(type)),
+        order(order),
+        heads(heads) {}
+
+  template <typename ArrayType>
+  ResolvedChunk<ArrayType> GetChunk(int64_t run) const {
+    return {checked_cast<const ArrayType*>(arrays[run].get()), (*heads)[run]};
+  }
+
+  // Make the arrays of a run's current batch the ones being compared
+  void SetRunBatch(size_t run, const RecordBatch& batch) {
+    arrays[run] = GetPhysicalArray(*batch.column(field_index), type);
+  }
+
+  int field_index;
+  std::shared_ptr<DataType> type;
+  SortOrder order;
+  // Assume nulls may appear in any run
+  int64_t null_count = 1;
+  // The physical array holding the rows of each run
+  ArrayVector arrays;
+  // The index of the head row of each run in its array
+  const std::vector<int64_t>* heads;
+};
+
+using MergeComparator = MultipleKeyComparator<MergeSortKey>;
+
+// Whether the head of a run is ordered before the head of another run
+struct RunLess {
+  bool operator()(size_t left, size_t right) const {
+    return comparator->Compare(left, right, 0);
+  }
+
+  MergeComparator* comparator;
+};
+
+// A tree of losers for k-way merging of sorted runs.
+//
+// Each internal node holds the loser of the match between its subtrees and
+// the overall winner is held separately, so that replacing the winner only
+// requires replaying the matches on its path to the root: log2(k)
+// comparisons, against about twice as many for a binary heap.  Ties are won
+// by the run with the smaller number, so that merging the runs of a stable
+// sort is stable.
+template <typename Less>
+class LoserTree {
+ public:
+  explicit LoserTree(Less less) : less_(std::move(less)) {}
+
+  // Start merging runs, some of which may be initially empty
+  void Reset(std::vector<bool> exhausted) {
+    num_runs_ = exhausted.size();
+    exhausted_ = std::move(exhausted);
+    tree_.assign(std::max<size_t>(num_runs_, 1), 0);
+    if (num_runs_ > 1) {
+      tree_[0] = Build(1);
+    }
+  }
+
+  bool empty() const { return num_runs_ == 0 || exhausted_[tree_[0]]; }
+
+  // The run whose head is ordered first
+  size_t top() const { return tree_[0]; }
+
+  // Restore the tree after the head of the top run changed
+  void Replay(bool top_exhausted) {
+    size_t winner = tree_[0];
+    exhausted_[winner] = top_exhausted;
+    for (size_t node = (winner + num_runs_) / 2; node > 0; node /= 2) {
+      if (Beats(tree_[node], winner)) {
+        std::swap(tree_[node], winner);
+      }
+    }
+    tree_[0] = winner;
+  }
+
+ private:
+  bool Beats(size_t left, size_t right) {
+    if (exhausted_[left]) return false;
+    if (exhausted_[right]) return true;
+    return left < right ? !less_(right, left) : less_(left, right);
+  }
+
+  // Runs are the leaves num_runs_ ... 2 * num_runs_ - 1 of an implicit
+  // binary tree whose internal nodes are 1 ... num_runs_ - 1.
+  size_t Build(size_t node) {
+    if (node >= num_runs_) {
+      return node - num_runs_;
+    }
+    const size_t left = Build(2 * node);
+    const size_t right = Build(2 * node + 1);
+    if (Beats(left, right)) {
+      tree_[node] = right;
+      return left;
+    }
+    tree_[node] = left;
+    return right;
+  }
+
+  Less less_;
+  size_t num_runs_ = 0;
+  std::vector<bool> exhausted_;
+  std::vector<size_t> tree_;
+};
+
+// ----------------------------------------------------------------------
+// Multiple-key sorting of a batch or a table
+
+// Sort indices [0, batch.num_rows()) according to the given sort keys.
+Status SortRecordBatch(uint64_t* indices_begin, uint64_t* indices_end,
+                       const RecordBatch& batch, const SortOptions& options) {
+  std::iota(indices_begin, indices_end, 0);
+  // Radix sorting is consistently faster except when there is a large number
+  // of sort keys, in which case it can end up degrading catastrophically.
+  // Cut off above 8 sort keys.
+  if (options.sort_keys.size() <= 8) {
+    RadixRecordBatchSorter sorter(indices_begin, indices_end, batch, options);
+    return sorter.Sort();
+  } else {
+    MultipleKeyRecordBatchSorter sorter(indices_begin, indices_end, batch, options);
+    return sorter.Sort();
+  }
+}
+
+// Below this number of rows, sorting a table in parallel isn't worth the merge.
+constexpr int64_t kMinParallelSortLength = 1 << 16;
+
+// Sort a table by sorting each of its record batches independently, in
+// parallel, then merging the sorted batches.
+//
+// Unlike MultipleKeyTableSorter, comparisons never need to resolve chunks.
+class ParallelTableSorter {
+ public:
+  ParallelTableSorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
+                      const Table& table, const SortOptions& options)
+      : ctx_(ctx),
+        indices_begin_(indices_begin),
+        indices_end_(indices_end),
+        table_(table),
+        options_(options) {}
+
+  Status Sort() {
+    for (const auto& sort_key : options_.sort_keys) {
+      if (table_.schema()->GetFieldIndex(sort_key.name) < 0) {
+        return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+      }
+    }
+
+    TableBatchReader reader(table_);
+    RecordBatchVector batches;
+    RETURN_NOT_OK(reader.ReadAll(&batches));
+    const int num_batches = static_cast<int>(batches.size());
+
+    // The sorted indices of all batches, each relative to its batch
+    const int64_t length = indices_end_ - indices_begin_;
+    ARROW_ASSIGN_OR_RAISE(auto sorted_buffer, AllocateBuffer(length * sizeof(uint64_t),
+                                                             ctx_->memory_pool()));
+    auto sorted = reinterpret_cast<uint64_t*>(sorted_buffer->mutable_data());
+    std::vector<int64_t> offsets(num_batches + 1, 0);
+    for (int i = 0; i < num_batches; ++i) {
+      offsets[i + 1] = offsets[i] + batches[i]->num_rows();
+    }
+    DCHECK_EQ(offsets.back(), length);
+
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        ctx_->use_threads(), num_batches, [&](int i) {
+          return SortRecordBatch(sorted + offsets[i], sorted + offsets[i + 1],
+                                 *batches[i], options_);
+        }));
+
+    if (num_batches == 1) {
+      std::copy(sorted, sorted + length, indices_begin_);
+      return Status::OK();
+    }
+    return Merge(batches, sorted, offsets);
+  }
+
+ private:
+  Status Merge(const RecordBatchVector& batches, const uint64_t* sorted,
+               const std::vector<int64_t>& offsets) {
+    const size_t num_batches = batches.size();
+    std::vector<int64_t> heads(num_batches, 0);
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    std::vector<bool> exhausted(num_batches);
+    std::vector<MergeSortKey> sort_keys;
+    for (const auto& sort_key : options_.sort_keys) {
+      const int field_index = table_.schema()->GetFieldIndex(sort_key.name);
+      sort_keys.emplace_back(field_index, table_.schema()->field(field_index)->type(),
+                             sort_key.order, &heads);
+      sort_keys.back().arrays.resize(num_batches);
+      for (size_t i = 0; i < num_batches; ++i) {
+        sort_keys.back().SetRunBatch(i, *batches[i]);
+      }
+    }
+    for (size_t i = 0; i < num_batches; ++i) {
+      exhausted[i] = positions[i] == offsets[i + 1];
+      if (!exhausted[i]) heads[i] = sorted[positions[i]];
+    }
+
+    MergeComparator comparator(sort_keys);
+    LoserTree<RunLess> tree(RunLess{&comparator});
+    tree.Reset(std::move(exhausted));
+    uint64_t* out = indices_begin_;
+    while (!tree.empty()) {
+      const size_t i = tree.top();
+      *out++ = offsets[i] + heads[i];
+      if (++positions[i] == offsets[i + 1]) {
+        tree.Replay(/*top_exhausted=*/true);
+      } else {
+        heads[i] = sorted[positions[i]];
+        tree.Replay(/*top_exhausted=*/false);
+      }
+    }
+    DCHECK_EQ(out, indices_end_);
+    return comparator.status();
+  }
+
+  ExecContext* ctx_;
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  const Table& table_;
+  const SortOptions& options_;
+};
+
+// ----------------------------------------------------------------------
+// Top-K selection
+
+// A sort key resolved against a single array
+struct ArraySortKey {
+  ArraySortKey(const Array& array, SortOrder order)
+      : type(GetPhysicalType(array.type())),
+        array(GetPhysicalArray(array, type)),
+        order(order),
+        null_count(array.null_count()) {}
+
+  template <typename ArrayType>
+  ResolvedChunk<ArrayType> GetChunk(int64_t index) const {
+    return {checked_cast<const ArrayType*>(array.get()), index};
+  }
+
+  std::shared_ptr<DataType> type;
+  std::shared_ptr<Array> array;
+  SortOrder order;
+  int64_t null_count;
+};
+
+// Select the first k rows of chunked sort key columns.
+//
+// The first k rows of each chunk are selected with a bounded binary heap
+// (on the CPU thread pool if allowed), then the selections of all chunks are
+// merged.  This takes O(n log k) time and O(k) memory per chunk.
+class SelectKSorter {
+ public:
+  // `chunks` holds the sort key columns of each chunk
+  SelectKSorter(ExecContext* ctx, int64_t k, std::vector<SortOrder> orders,
+                std::vector<ArrayVector> chunks)
+      : ctx_(ctx), k_(k), orders_(std::move(orders)), chunks_(std::move(chunks)) {}
+
+  Result<Datum> Select() {
+    const int num_chunks = static_cast<int>(chunks_.size());
+    selected_.resize(num_chunks);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        ctx_->use_threads() && num_chunks > 1, num_chunks,
+        [this](int i) { return SelectChunk(i); }));
+
+    std::vector<int64_t> offsets(num_chunks, 0);
+    int64_t num_selected = 0;
+    for (int i = 0; i < num_chunks; ++i) {
+      if (i > 0) {
+        offsets[i] = offsets[i - 1] + chunks_[i - 1][0]->length();
+      }
+      num_selected += static_cast<int64_t>(selected_[i].size());
+    }
+    const int64_t length = std::min(k_, num_selected);
+
+    ARROW_ASSIGN_OR_RAISE(auto indices, AllocateBuffer(length * sizeof(uint64_t),
+                                                       ctx_->memory_pool()));
+    auto out_begin = reinterpret_cast<uint64_t*>(indices->mutable_data());
+    if (num_chunks == 1) {
+      std::copy(selected_[0].begin(), selected_[0].begin() + length, out_begin);
+    } else if (length > 0) {
+      RETURN_NOT_OK(Merge(offsets, out_begin, out_begin + length));
+    }
+    return Datum(std::make_shared<ArrayData>(
+        uint64(), length, BufferVector{nullptr, std::move(indices)}, 0));
+  }
+
+ private:
+  Status SelectChunk(int chunk) {
+    const int64_t length = chunks_[chunk][0]->length();
+    std::vector<ArraySortKey> sort_keys;
+    for (size_t i = 0; i < orders_.size(); ++i) {
+      sort_keys.emplace_back(*chunks_[chunk][i], orders_[i]);
+    }
+    MultipleKeyComparator<ArraySortKey> comparator(sort_keys);
+    auto less = [&comparator](uint64_t left, uint64_t right) {
+      return comparator.Compare(left, right, 0);
+    };
+
+    // A max-heap of the first rows seen so far: its top is the last of them
+    auto& heap = selected_[chunk];
+    heap.resize(static_cast<size_t>(std::min(k_, length)));
+    if (heap.empty()) {
+      return Status::OK();
+    }
+    std::iota(heap.begin(), heap.end(), 0);
+    std::make_heap(heap.begin(), heap.end(), less);
+    for (uint64_t index = heap.size(); index < static_cast<uint64_t>(length); ++index) {
+      if (less(index, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), less);
+        heap.back() = index;
+        std::push_heap(heap.begin(), heap.end(), less);
+      }
+    }
+    std::sort_heap(heap.begin(), heap.end(), less);
+    return comparator.status();
+  }
+
+  Status Merge(const std::vector<int64_t>& offsets, uint64_t* out_begin,
+               uint64_t* out_end) {
+    const size_t num_chunks = chunks_.size();
+    std::vector<int64_t> heads(num_chunks, 0);
+    std::vector<size_t> positions(num_chunks, 0);
+    std::vector<bool> exhausted(num_chunks);
+    std::vector<MergeSortKey> sort_keys;
+    for (size_t i = 0; i < orders_.size(); ++i) {
+      sort_keys.emplace_back(static_cast<int>(i), chunks_[0][i]->type(), orders_[i],
+                             &heads);
+      auto& sort_key = sort_keys.back();
+      for (const auto& chunk : chunks_) {
+        sort_key.arrays.push_back(GetPhysicalArray(*chunk[i], sort_key.type));
+      }
+    }
+    for (size_t i = 0; i < num_chunks; ++i) {
+      exhausted[i] = selected_[i].empty();
+      if (!exhausted[i]) heads[i] = selected_[i][0];
+    }
+
+    MergeComparator comparator(sort_keys);
+    LoserTree<RunLess> tree(RunLess{&comparator});
+    tree.Reset(std::move(exhausted));
+    for (uint64_t* out = out_begin; out != out_end; ++out) {
+      DCHECK(!tree.empty());
+      const size_t i = tree.top();
+      *out = offsets[i] + heads[i];
+      if (++positions[i] == selected_[i].size()) {
+        tree.Replay(/*top_exhausted=*/true);
+      } else {
+        heads[i] = selected_[i][positions[i]];
+        tree.Replay(/*top_exhausted=*/false);
+      }
+    }
+    return comparator.status();
+  }
+
+  ExecContext* ctx_;
+  const int64_t k_;
+  const std::vector<SortOrder> orders_;
+  const std::vector<ArrayVector> chunks_;
+  // The selected indices of each chunk, in order and relative to the chunk
+  std::vector<std::vector<uint64_t>> selected_;
+};
+
 // ----------------------------------------------------------------------
 // Top-level sort functions
 
@@ -1654,18 +1987,7 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out = std::make_shared<ArrayData>(out_type, length, buffers, 0);
     auto out_begin = out->GetMutableValues<uint64_t>(1);
     auto out_end = out_begin + length;
-    std::iota(out_begin, out_end, 0);
-
-    // Radix sorting is consistently faster except when there is a large number
-    // of sort keys, in which case it can end up degrading catastrophically.
-    // Cut off above 8 sort keys.
-    if (n_sort_keys <= 8) {
-      RadixRecordBatchSorter sorter(out_begin, out_end, batch, options);
-      ARROW_RETURN_NOT_OK(sorter.Sort());
-    } else {
-      MultipleKeyRecordBatchSorter sorter(out_begin, out_end, batch, options);
-      ARROW_RETURN_NOT_OK(sorter.Sort());
-    }
+    ARROW_RETURN_NOT_OK(SortRecordBatch(out_begin, out_end, batch, options));
     return Datum(out);
   }
 
@@ -1694,7 +2016,16 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out = std::make_shared<ArrayData>(out_type, length, buffers, 0);
     auto out_begin = out->GetMutableValues<uint64_t>(1);
     auto out_end = out_begin + length;
-    std::iota(out_begin, out_end, 0);
+
+    // If threading is allowed, sort the table's batches in parallel and
+    // merge them.  Not from a CPU pool thread though (e.g. in an exec node),
+    // since it would block waiting on other tasks of the same pool.
+    if (ctx->use_threads() && length >= kMinParallelSortLength &&
+        !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+      ParallelTableSorter sorter(ctx, out_begin, out_end, table, options);
+      ARROW_RETURN_NOT_OK(sorter.Sort());
+      return Datum(out);
+    }
 
     // TODO: We should choose suitable sort implementation
     // automatically. The current TableRadixSorter implementation is
@@ -1704,12 +2035,111 @@ class SortIndicesMetaFunction : public MetaFunction {
     //
     // TableRadixSorter sorter;
     // ARROW_RETURN_NOT_OK(sorter.Sort(ctx, out_begin, out_end, table, options));
+    std::iota(out_begin, out_end, 0);
     MultipleKeyTableSorter sorter(out_begin, out_end, table, options);
     ARROW_RETURN_NOT_OK(sorter.Sort());
     return Datum(out);
   }
 };
 
+const auto kDefaultSelectKOptions = SelectKOptions::Defaults();
+
+const FunctionDoc select_k_unstable_doc(
+    "Return the indices of the first k elements in the given sort order",
+    ("This function computes the indices of the first k elements of the\n"
+     "input array, chunked array, record batch or table, in the order\n"
+     "defined by the sort keys, without sorting the whole input.  Elements\n"
+     "comparing equal may be selected and ordered arbitrarily.  Null values\n"
+     "are considered greater than any other value.  For floating-point types,\n"
+     "NaNs are considered greater than any other non-null value, but smaller\n"
+     "than null values.\n"
+     "\n"
+     "The number of elements `k` must be given in SelectKOptions."),
+    {"input"}, "SelectKOptions");
+
+class SelectKUnstableMetaFunction : public MetaFunction {
+ public:
+  SelectKUnstableMetaFunction()
+      : MetaFunction("select_k_unstable", Arity::Unary(), &select_k_unstable_doc,
+                     &kDefaultSelectKOptions) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& select_k_options = static_cast<const SelectKOptions&>(*options);
+    if (select_k_options.k < 0) {
+      return Status::Invalid("select_k_unstable requires a non-negative k, got ",
+                             select_k_options.k);
+    }
+    switch (args[0].kind()) {
+      case Datum::ARRAY:
+        return SelectK(ChunkedArray(args[0].make_array()), select_k_options, ctx);
+      case Datum::CHUNKED_ARRAY:
+        return SelectK(*args[0].chunked_array(), select_k_options, ctx);
+      case Datum::RECORD_BATCH: {
+        ARROW_ASSIGN_OR_RAISE(auto table,
+                              Table::FromRecordBatches({args[0].record_batch()}));
+        return SelectK(*table, select_k_options, ctx);
+      }
+      case Datum::TABLE:
+        return SelectK(*args[0].table(), select_k_options, ctx);
+      default:
+        break;
+    }
+    return Status::NotImplemented(
+        "Unsupported types for select_k_unstable operation: "
+        "values=",
+        args[0].ToString());
+  }
+
+ private:
+  Result<Datum> SelectK(const ChunkedArray& chunked_array, const SelectKOptions& options,
+                        ExecContext* ctx) const {
+    SortOrder order = SortOrder::Ascending;
+    if (!options.sort_keys.empty()) {
+      order = options.sort_keys[0].order;
+    }
+    std::vector<ArrayVector> chunks;
+    for (const auto& chunk : chunked_array.chunks()) {
+      chunks.push_back({chunk});
+    }
+    SelectKSorter sorter(ctx, options.k, {order}, std::move(chunks));
+    return sorter.Select();
+  }
+
+  Result<Datum> SelectK(const Table& table, const SelectKOptions& options,
+                        ExecContext* ctx) const {
+    if (options.sort_keys.empty()) {
+      return Status::Invalid("Must specify one or more sort keys");
+    }
+    // Split the sort key columns into aligned chunks
+    FieldVector fields;
+    ChunkedArrayVector columns;
+    std::vector<SortOrder> orders;
+    for (const auto& sort_key : options.sort_keys) {
+      const int field_index = table.schema()->GetFieldIndex(sort_key.name);
+      if (field_index < 0) {
+        return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+      }
+      fields.push_back(table.schema()->field(field_index));
+      columns.push_back(table.column(field_index));
+      orders.push_back(sort_key.order);
+    }
+    auto keys_table = Table::Make(schema(std::move(fields)), std::move(columns),
+                                  table.num_rows());
+    TableBatchReader reader(*keys_table);
+    std::vector<ArrayVector> chunks;
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (!batch) break;
+      chunks.push_back(batch->columns());
+    }
+    SelectKSorter sorter(ctx, options.k, std::move(orders), std::move(chunks));
+    return sorter.Select();
+  }
+};
+
 const auto kDefaultArraySortOptions = ArraySortOptions::Defaults();
 
 const FunctionDoc array_sort_indices_doc(
@@ -1738,6 +2168,340 @@ const FunctionDoc partition_nth_indices_doc(
      "The pivot index `N` must be given in PartitionNthOptions."),
     {"array"}, "PartitionNthOptions");
 
+// ----------------------------------------------------------------------
+// External sort
+
+// The number of bytes held by the buffers of an array.  Buffers shared
+// between arrays (or only partially viewed by a slice) are counted in full.
+int64_t TotalBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) size += buffer->size();
+  }
+  for (const auto& child : data.child_data) {
+    size += TotalBufferSize(*child);
+  }
+  if (data.dictionary) size += TotalBufferSize(*data.dictionary);
+  return size;
+}
+
+int64_t TotalBufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += TotalBufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+// Sort a run of batches in memory.
+Result<std::shared_ptr<Table>> SortRun(const std::shared_ptr<Schema>& schema,
+                                       const RecordBatchVector& batches,
+                                       const SortOptions& options, ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema, batches));
+  ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(Datum(table), options, ctx));
+  ARROW_ASSIGN_OR_RAISE(auto sorted, Take(Datum(table), Datum(indices),
+                                          TakeOptions::NoBoundsCheck(), ctx));
+  return sorted.table();
+}
+
+// Sort a run of batches and write it to an IPC file.
+Status SpillRun(const std::shared_ptr<Schema>& schema, const RecordBatchVector& batches,
+                const std::string& path, const ExternalSortOptions& options,
+                ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto sorted, SortRun(schema, batches, options.sort_options, ctx));
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.memory_pool = ctx->memory_pool();
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::FileOutputStream::Open(path));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(sink, schema, write_options));
+  RETURN_NOT_OK(writer->WriteTable(*sorted, options.batch_size));
+  RETURN_NOT_OK(writer->Close());
+  return sink->Close();
+}
+
+// A RecordBatchReader doing a k-way merge of sorted runs spilled to IPC files.
+//
+// Only the current batch of each run is kept in memory.  Runs are numbered
+// in input order, so that the merge is stable.
+class SpilledRunsMerger : public RecordBatchReader {
+ public:
+  SpilledRunsMerger(std::shared_ptr<Schema> schema, const ExternalSortOptions& options,
+                    std::unique_ptr<::arrow::internal::TemporaryDir> spill_dir,
+                    ExecContext* ctx)
+      : schema_(std::move(schema)),
+        batch_size_(options.batch_size),
+        spill_dir_(std::move(spill_dir)),
+        ctx_(ctx),
+        comparator_(sort_keys_),
+        tree_(RunLess{&comparator_}) {
+    for (const auto& sort_key : options.sort_options.sort_keys) {
+      const int field_index = schema_->GetFieldIndex(sort_key.name);
+      DCHECK_GE(field_index, 0);
+      sort_keys_.emplace_back(field_index, schema_->field(field_index)->type(),
+                              sort_key.order, &positions_);
+    }
+  }
+
+  Status Init(const std::vector<std::string>& paths) {
+    auto read_options = ipc::IpcReadOptions::Defaults();
+    read_options.memory_pool = ctx_->memory_pool();
+    runs_.resize(paths.size());
+    positions_.resize(paths.size(), 0);
+    for (auto& sort_key : sort_keys_) {
+      sort_key.arrays.resize(paths.size());
+    }
+    std::vector<bool> exhausted(paths.size());
+    for (size_t run = 0; run < paths.size(); ++run) {
+      ARROW_ASSIGN_OR_RAISE(auto file,
+                            io::ReadableFile::Open(paths[run], ctx_->memory_pool()));
+      ARROW_ASSIGN_OR_RAISE(runs_[run].reader,
+                            ipc::RecordBatchFileReader::Open(file, read_options));
+      ARROW_ASSIGN_OR_RAISE(bool has_batch, LoadNextBatch(run));
+      exhausted[run] = !has_batch;
+    }
+    tree_.Reset(std::move(exhausted));
+    return comparator_.status();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    // Gather the next rows as slices of the runs' current batches
+    struct Slice {
+      std::shared_ptr<RecordBatch> batch;
+      int64_t offset;
+      int64_t length;
+    };
+    std::vector<Slice> slices;
+    int64_t num_rows = 0;
+    while (num_rows < batch_size_ && !tree_.empty()) {
+      const size_t run = tree_.top();
+      auto& batch = runs_[run].batch;
+      const int64_t position = positions_[run];
+      if (!slices.empty() && slices.back().batch == batch &&
+          slices.back().offset + slices.back().length == position) {
+        ++slices.back().length;
+      } else {
+        slices.push_back({batch, position, 1});
+      }
+      ++num_rows;
+
+      bool exhausted = false;
+      if (++positions_[run] == batch->num_rows()) {
+        ARROW_ASSIGN_OR_RAISE(bool has_batch, LoadNextBatch(run));
+        exhausted = !has_batch;
+      }
+      tree_.Replay(exhausted);
+    }
+    RETURN_NOT_OK(comparator_.status());
+
+    if (num_rows == 0) {
+      out->reset();
+      return Status::OK();
+    }
+
+    ArrayVector columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ArrayVector pieces(slices.size());
+      for (size_t j = 0; j < slices.size(); ++j) {
+        pieces[j] = slices[j].batch->column(i)->Slice(slices[j].offset, slices[j].length);
+      }
+      if (pieces.size() == 1) {
+        columns[i] = std::move(pieces[0]);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(pieces, ctx_->memory_pool()));
+      }
+    }
+    *out = RecordBatch::Make(schema_, num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  struct Run {
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    int next_batch = 0;
+    std::shared_ptr<RecordBatch> batch;
+  };
+
+  // Load the next non-empty batch of a run, returning false if the run
+  // is exhausted.
+  Result<bool> LoadNextBatch(size_t run) {
+    auto& state = runs_[run];
+    while (state.next_batch < state.reader->num_record_batches()) {
+      ARROW_ASSIGN_OR_RAISE(state.batch,
+                            state.reader->ReadRecordBatch(state.next_batch++));
+      if (state.batch->num_rows() == 0) continue;
+      positions_[run] = 0;
+      for (auto& sort_key : sort_keys_) {
+        sort_key.SetRunBatch(run, *state.batch);
+      }
+      return true;
+    }
+    state = Run{};
+    for (auto& sort_key : sort_keys_) {
+      sort_key.arrays[run].reset();
+    }
+    return false;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  int64_t batch_size_;
+  std::unique_ptr<::arrow::internal::TemporaryDir> spill_dir_;
+  ExecContext* ctx_;
+
+  std::vector<Run> runs_;
+  // The index of the current row in the current batch of each run
+  std::vector<int64_t> positions_;
+  std::vector<MergeSortKey> sort_keys_;
+  MergeComparator comparator_;
+  LoserTree<RunLess> tree_;
+};
+
+// Accumulates input batches, spilling sorted runs once the memory limit
+// is exceeded.
+class ExternalSorter {
+ public:
+  ExternalSorter(std::shared_ptr<Schema> schema, const ExternalSortOptions& options,
+                 ExecContext* ctx)
+      : schema_(std::move(schema)), options_(options), ctx_(ctx) {}
+
+  Status Consume(std::shared_ptr<RecordBatch> batch) {
+    buffered_bytes_ += TotalBufferSize(*batch);
+    buffered_.push_back(std::move(batch));
+    if (buffered_bytes_ > options_.memory_limit) {
+      return Spill();
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatchReader>> Finish() {
+    if (spill_paths_.empty()) {
+      // Everything fit in memory
+      ARROW_ASSIGN_OR_RAISE(auto sorted,
+                            SortRun(schema_, buffered_, options_.sort_options, ctx_));
+      TableBatchReader reader(*sorted);
+      reader.set_chunksize(options_.batch_size);
+      RecordBatchVector batches;
+      RETURN_NOT_OK(reader.ReadAll(&batches));
+      return RecordBatchReader::Make(std::move(batches), schema_);
+    }
+    RETURN_NOT_OK(Spill());
+
+    // Merge groups of consecutive runs (which keeps the merge stable) until few
+    // enough remain to be merged at once
+    const size_t fan_in = static_cast<size_t>(options_.max_merge_fan_in);
+    while (spill_paths_.size() > fan_in) {
+      std::vector<std::string> merged_paths;
+      for (size_t begin = 0; begin < spill_paths_.size(); begin += fan_in) {
+        const size_t end = std::min(begin + fan_in, spill_paths_.size());
+        if (end - begin == 1) {
+          merged_paths.push_back(spill_paths_[begin]);
+          continue;
+        }
+        merged_paths.push_back(NextSpillPath());
+        RETURN_NOT_OK(
+            MergeRuns({spill_paths_.begin() + begin, spill_paths_.begin() + end},
+                      merged_paths.back()));
+      }
+      spill_paths_ = std::move(merged_paths);
+    }
+
+    auto merger = std::make_shared<SpilledRunsMerger>(schema_, options_,
+                                                      std::move(spill_dir_), ctx_);
+    RETURN_NOT_OK(merger->Init(spill_paths_));
+    return merger;
+  }
+
+ private:
+  std::string NextSpillPath() {
+    return spill_dir_->path().ToString() + "run-" + std::to_string(num_spill_files_++) +
+           ".arrow";
+  }
+
+  // Merge sorted runs into a single one, deleting their files.
+  Status MergeRuns(const std::vector<std::string>& paths, const std::string& out_path) {
+    {
+      SpilledRunsMerger merger(schema_, options_, /*spill_dir=*/nullptr, ctx_);
+      RETURN_NOT_OK(merger.Init(paths));
+      auto write_options = ipc::IpcWriteOptions::Defaults();
+      write_options.memory_pool = ctx_->memory_pool();
+      ARROW_ASSIGN_OR_RAISE(auto sink, io::FileOutputStream::Open(out_path));
+      ARROW_ASSIGN_OR_RAISE(auto writer,
+                            ipc::MakeFileWriter(sink, schema_, write_options));
+      while (true) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(merger.ReadNext(&batch));
+        if (!batch) break;
+        RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+      }
+      RETURN_NOT_OK(writer->Close());
+      RETURN_NOT_OK(sink->Close());
+    }
+    for (const auto& path : paths) {
+      ARROW_ASSIGN_OR_RAISE(auto file_name,
+                            ::arrow::internal::PlatformFilename::FromString(path));
+      RETURN_NOT_OK(::arrow::internal::DeleteFile(file_name));
+    }
+    return Status::OK();
+  }
+
+  // Split the buffered batches into runs of similar size, then sort and
+  // spill them in parallel.
+  Status Spill() {
+    if (buffered_.empty()) {
+      return Status::OK();
+    }
+    if (!spill_dir_) {
+      ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                            ::arrow::internal::TemporaryDir::Make("arrow-sort-"));
+    }
+    // Sinks may run on the CPU thread pool, whose threads must not wait on other
+    // tasks of the pool (as OptionalParallelFor does)
+    auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+    const bool parallel = ctx_->use_threads() && !thread_pool->OwnsThisThread();
+    const int64_t max_runs = parallel ? thread_pool->GetCapacity() : 1;
+    const int64_t num_runs =
+        std::max<int64_t>(1, std::min<int64_t>(max_runs, buffered_.size()));
+    const int64_t run_bytes = BitUtil::CeilDiv(buffered_bytes_, num_runs);
+
+    std::vector<RecordBatchVector> runs(1);
+    int64_t current_run_bytes = 0;
+    for (auto& batch : buffered_) {
+      if (current_run_bytes >= run_bytes) {
+        runs.emplace_back();
+        current_run_bytes = 0;
+      }
+      current_run_bytes += TotalBufferSize(*batch);
+      runs.back().push_back(std::move(batch));
+    }
+    buffered_.clear();
+    buffered_bytes_ = 0;
+
+    std::vector<std::string> paths(runs.size());
+    for (auto& path : paths) {
+      path = NextSpillPath();
+      spill_paths_.push_back(path);
+    }
+    // Runs are already sorted in parallel: sorting each of them on the
+    // thread pool as well could exhaust it.
+    ExecContext run_ctx(ctx_->memory_pool(), ctx_->func_registry());
+    run_ctx.set_use_threads(false);
+    return ::arrow::internal::OptionalParallelFor(
+        parallel, static_cast<int>(runs.size()), [&](int i) {
+          return SpillRun(schema_, runs[i], paths[i], options_, &run_ctx);
+        });
+  }
+
+  std::shared_ptr<Schema> schema_;
+  const ExternalSortOptions& options_;
+  ExecContext* ctx_;
+
+  RecordBatchVector buffered_;
+  int64_t buffered_bytes_ = 0;
+  std::unique_ptr<::arrow::internal::TemporaryDir> spill_dir_;
+  std::vector<std::string> spill_paths_;
+  int num_spill_files_ = 0;
+};
+
 }  // namespace
 
 void RegisterVectorSort(FunctionRegistry* registry) {
@@ -1755,6 +2519,8 @@ void RegisterVectorSort(FunctionRegistry* registry) {
 
   DCHECK_OK(registry->AddFunction(std::make_shared<SortIndicesMetaFunction>()));
 
+  DCHECK_OK(registry->AddFunction(std::make_shared<SelectKUnstableMetaFunction>()));
+
   // partition_nth_indices has a parameter so needs its init function
   auto part_indices = std::make_shared<VectorFunction>(
       "partition_nth_indices", Arity::Unary(), &partition_nth_indices_doc);
@@ -1766,5 +2532,38 @@ void RegisterVectorSort(FunctionRegistry* registry) {
 #undef VISIT_PHYSICAL_TYPES
 
 }  // namespace internal
+
+Result<std::shared_ptr<RecordBatchReader>> ExternalSort(
+    std::shared_ptr<RecordBatchReader> input, const ExternalSortOptions& options,
+    ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  if (options.sort_options.sort_keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  if (options.memory_limit <= 0 || options.batch_size <= 0) {
+    return Status::Invalid("ExternalSort memory limit and batch size must be positive");
+  }
+  if (options.max_merge_fan_in < 2) {
+    return Status::Invalid("ExternalSort merge fan-in must be at least 2");
+  }
+  auto schema = input->schema();
+  for (const auto& sort_key : options.sort_options.sort_keys) {
+    if (schema->GetFieldIndex(sort_key.name) < 0) {
+      return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+    }
+  }
+
+  internal::ExternalSorter sorter(schema, options, ctx);
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(input->ReadNext(&batch));
+    if (batch == nullptr) break;
+    RETURN_NOT_OK(sorter.Consume(std::move(batch)));
+  }
+  return sorter.Finish();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,12 +18,14 @@
 #include "benchmark/benchmark.h"
 
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -205,6 +207,29 @@ static void TableSortIndicesInt64(benchmark::State& state, int64_t min, int64_t
   DatumSortIndicesBenchmark(state, Datum(*table), options);
 }
 
+// Compare the serial table sorter (num_threads == 0) with the parallel
+// per-chunk sort and merge, using the given number of threads.
+static void TableSortIndicesInt64Threads(benchmark::State& state) {
+  TableSortIndicesArgs args(state);
+  const int num_threads = static_cast<int>(state.range(4));
+
+  auto data = MakeBatchOrTableBenchmarkDataInt64(
+      args, args.num_chunks, std::numeric_limits<int64_t>::min(),
+      std::numeric_limits<int64_t>::max());
+  auto table = Table::Make(data.schema, data.columns, args.num_records);
+  SortOptions options(data.sort_keys);
+
+  auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+  const int old_capacity = thread_pool->GetCapacity();
+  ABORT_NOT_OK(thread_pool->SetCapacity(std::max(num_threads, 1)));
+  ExecContext ctx;
+  ctx.set_use_threads(num_threads > 0);
+  for (auto _ : state) {
+    ABORT_NOT_OK(SortIndices(Datum(*table), options, &ctx).status());
+  }
+  ABORT_NOT_OK(thread_pool->SetCapacity(old_capacity));
+}
+
 static void RecordBatchSortIndicesInt64Narrow(benchmark::State& state) {
   RecordBatchSortIndicesInt64(state, -100, 100);
 }
@@ -281,5 +306,16 @@ BENCHMARK(TableSortIndicesInt64Wide)
     })
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(TableSortIndicesInt64Threads)
+    ->ArgsProduct({
+        {1 << 22},      // the number of records
+        {100},          // inverse null proportion
+        {4, 2},         // the number of columns
+        {32},           // the number of chunks
+        {0, 1, 4, 16},  // the number of threads (0: serial sorter)
+    })
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
@@ -24,13 +24,17 @@
 #include "arrow/array/array_decimal.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/future.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -1234,8 +1238,13 @@ TEST_P(TestTableSortIndicesRandom, Sort) {
     TableBatchReader reader(*table);
     reader.set_chunksize((length + num_chunks - 1) / num_chunks);
     ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
-    ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*chunked_table), options));
-    Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
+    for (const bool use_threads : {false, true}) {
+      ExecContext ctx;
+      ctx.set_use_threads(use_threads);
+      ASSERT_OK_AND_ASSIGN(auto offsets,
+                           SortIndices(Datum(*chunked_table), options, &ctx));
+      Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
+    }
   }
 
   // Also validate RecordBatch sorting
@@ -1247,6 +1256,93 @@ TEST_P(TestTableSortIndicesRandom, Sort) {
   Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
 }
 
+TEST_F(TestTableSortIndices, Parallel) {
+  // Large enough to be sorted in parallel when threading is allowed
+  const int64_t length = 1 << 17;
+  random::RandomArrayGenerator rng(0x5487655);
+  auto table_schema = schema({field("a", int32()), field("b", utf8())});
+  auto table = Table::Make(table_schema, {rng.Int32(length, 0, 100, 0.1),
+                                          rng.String(length, 0, 3, 0.1)});
+  TableBatchReader reader(*table);
+  reader.set_chunksize(length / 10);
+  ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
+  SortOptions options({SortKey("a"), SortKey("b", SortOrder::Descending)});
+
+  ExecContext serial_ctx, threaded_ctx;
+  serial_ctx.set_use_threads(false);
+  threaded_ctx.set_use_threads(true);
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       SortIndices(Datum(*chunked_table), options, &serial_ctx));
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       SortIndices(Datum(*chunked_table), options, &threaded_ctx));
+  AssertArraysEqual(*expected, *actual);
+
+  // From tasks occupying every CPU thread, the sort must fall back to the serial
+  // sorter rather than wait on tasks of the same pool
+  auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+  std::vector<Future<std::shared_ptr<Array>>> futures;
+  for (int i = 0; i < thread_pool->GetCapacity(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future, thread_pool->Submit([&] {
+      return SortIndices(Datum(*chunked_table), options, &threaded_ctx);
+    }));
+    futures.push_back(std::move(future));
+  }
+  for (auto& future : futures) {
+    ASSERT_OK_AND_ASSIGN(auto indices, future.result());
+    AssertArraysEqual(*expected, *indices);
+  }
+}
+
+TEST_F(TestTableSortIndices, ParallelRandom) {
+  // Several chunks of random data in every sortable type, large enough for the
+  // per-chunk sort and merge; it must agree with the serial sorter
+  const int64_t length = 3 << 15;
+  const auto seed = 0x61549226;
+  const double null_probability = 0.1;
+  const FieldVector fields = {
+      field("uint8", uint8()),   field("int16", int16()),
+      field("uint32", uint32()), field("int64", int64()),
+      field("float", float32()), field("double", float64()),
+      field("string", utf8()),   field("decimal128", decimal128(18, 3)),
+  };
+  ArrayVector columns = {
+      Random<UInt8Type>(seed).Generate(length, null_probability),
+      Random<Int16Type>(seed).Generate(length, null_probability),
+      Random<UInt32Type>(seed).Generate(length, 0.0),
+      Random<Int64Type>(seed).Generate(length, null_probability),
+      Random<FloatType>(seed).Generate(length, null_probability, null_probability),
+      Random<DoubleType>(seed).Generate(length, 0.0, null_probability),
+      Random<StringType>(seed).Generate(length, null_probability),
+      Random<Decimal128Type>(seed, fields[7]->type()).Generate(length, null_probability),
+  };
+  const auto table = Table::Make(schema(fields), columns, length);
+
+  ExecContext serial_ctx, threaded_ctx;
+  serial_ctx.set_use_threads(false);
+  threaded_ctx.set_use_threads(true);
+  const std::vector<std::vector<SortKey>> sort_keys = {
+      {SortKey("uint8"), SortKey("string", SortOrder::Descending), SortKey("int64")},
+      {SortKey("float", SortOrder::Descending), SortKey("int16")},
+      {SortKey("decimal128"), SortKey("double", SortOrder::Descending),
+       SortKey("uint32")},
+  };
+  for (const int64_t num_chunks : {3, 17}) {
+    TableBatchReader reader(*table);
+    reader.set_chunksize((length + num_chunks - 1) / num_chunks);
+    ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
+    ASSERT_EQ(chunked_table->column(0)->num_chunks(), num_chunks);
+    for (const auto& keys : sort_keys) {
+      SortOptions options(keys);
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           SortIndices(Datum(*chunked_table), options, &serial_ctx));
+      ASSERT_OK_AND_ASSIGN(auto actual,
+                           SortIndices(Datum(*chunked_table), options, &threaded_ctx));
+      ValidateOutput(*actual);
+      AssertArraysEqual(*expected, *actual);
+    }
+  }
+}
+
 static const auto first_sort_keys =
     testing::Values("uint8", "uint16", "uint32", "uint64", "int8", "int16", "int32",
                     "int64", "float", "double", "string", "decimal128");
@@ -1260,5 +1356,181 @@ INSTANTIATE_TEST_SUITE_P(MayNull, TestTableSortIndicesRandom,
 INSTANTIATE_TEST_SUITE_P(AllNull, TestTableSortIndicesRandom,
                          testing::Combine(first_sort_keys, testing::Values(1.0)));
 
+// ----------------------------------------------------------------------
+// Top-K selection tests
+
+template <typename T>
+void AssertSelectK(const std::shared_ptr<T>& input, const SelectKOptions& options,
+                   const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual, SelectKUnstable(Datum(input), options));
+  ValidateOutput(*actual);
+  AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual, /*verbose=*/true);
+}
+
+TEST(TestSelectK, Array) {
+  auto array = ArrayFromJSON(int32(), "[3, null, 7, 1, 5]");
+  AssertSelectK(array, SelectKOptions::TopKDefault(2), "[2, 4]");
+  AssertSelectK(array, SelectKOptions::BottomKDefault(3), "[3, 0, 4]");
+  AssertSelectK(array, SelectKOptions::BottomKDefault(10), "[3, 0, 4, 2, 1]");
+  AssertSelectK(array, SelectKOptions::TopKDefault(0), "[]");
+
+  array = ArrayFromJSON(float64(), "[NaN, 2, null, 1, -1]");
+  AssertSelectK(array, SelectKOptions::BottomKDefault(4), "[4, 3, 1, 0]");
+  AssertSelectK(array, SelectKOptions::TopKDefault(3), "[1, 3, 4]");
+}
+
+TEST(TestSelectK, ChunkedArray) {
+  auto chunked_array = ChunkedArrayFromJSON(int32(), {"[3, null]", "[]", "[7, 1, 5]"});
+  AssertSelectK(chunked_array, SelectKOptions::TopKDefault(2), "[2, 4]");
+  AssertSelectK(chunked_array, SelectKOptions::BottomKDefault(3), "[3, 0, 4]");
+  AssertSelectK(chunked_array, SelectKOptions::BottomKDefault(10), "[3, 0, 4, 2, 1]");
+
+  chunked_array = ChunkedArrayFromJSON(int32(), {});
+  AssertSelectK(chunked_array, SelectKOptions::TopKDefault(2), "[]");
+}
+
+TEST(TestSelectK, RecordBatchAndTable) {
+  auto schema = ::arrow::schema({
+      {field("a", uint8())},
+      {field("b", uint32())},
+  });
+  SelectKOptions options(
+      3, {SortKey("a", SortOrder::Ascending), SortKey("b", SortOrder::Descending)});
+
+  auto batch = RecordBatchFromJSON(schema, R"([{"a": null, "b": 5},
+                                               {"a": 1,    "b": 3},
+                                               {"a": 3,    "b": null},
+                                               {"a": null, "b": null},
+                                               {"a": 2,    "b": 5},
+                                               {"a": 1,    "b": 5}
+                                              ])");
+  AssertSelectK(batch, options, "[5, 1, 4]");
+
+  auto table = TableFromJSON(schema, {R"([{"a": null, "b": 5},
+                                          {"a": 1,    "b": 3},
+                                          {"a": 3,    "b": null}
+                                         ])",
+                                      R"([{"a": null, "b": null},
+                                          {"a": 2,    "b": 5},
+                                          {"a": 1,    "b": 5}
+                                         ])"});
+  AssertSelectK(table, options, "[5, 1, 4]");
+  options.k = 10;
+  AssertSelectK(table, options, "[5, 1, 4, 2, 0, 3]");
+
+  ASSERT_RAISES(Invalid,
+                SelectKUnstable(Datum(table), SelectKOptions(-1, {SortKey("a")})));
+  ASSERT_RAISES(Invalid,
+                SelectKUnstable(Datum(table), SelectKOptions(1, {SortKey("x")})));
+  ASSERT_RAISES(Invalid, SelectKUnstable(Datum(table), SelectKOptions(1)));
+}
+
+TEST(TestSelectK, RandomTable) {
+  random::RandomArrayGenerator rng(0x5e1ec7);
+  const int64_t length = 1000;
+  auto schema = ::arrow::schema({field("a", int16()), field("b", float64())});
+  auto table = Table::Make(schema, {rng.Int16(length, 0, 50, 0.1),
+                                    rng.Float64(length, -1, 1, 0.1)});
+  SortOptions sort_options({SortKey("a", SortOrder::Descending), SortKey("b")});
+  ASSERT_OK_AND_ASSIGN(auto sorted, SortIndices(Datum(table), sort_options));
+
+  for (const int64_t num_chunks : {1, 7}) {
+    TableBatchReader reader(*table);
+    reader.set_chunksize((length + num_chunks - 1) / num_chunks);
+    ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
+    for (const int64_t k : {1, 10, 500}) {
+      ARROW_SCOPED_TRACE("num_chunks = ", num_chunks, ", k = ", k);
+      SelectKOptions options(k, sort_options.sort_keys);
+      ASSERT_OK_AND_ASSIGN(auto selected,
+                           SelectKUnstable(Datum(chunked_table), options));
+      ValidateOutput(*selected);
+      // Rows comparing equal may be selected in any order: compare the sort keys
+      ASSERT_OK_AND_ASSIGN(auto expected, Take(Datum(table), Datum(sorted->Slice(0, k))));
+      ASSERT_OK_AND_ASSIGN(auto actual, Take(Datum(table), Datum(selected)));
+      AssertTablesEqual(*expected.table(), *actual.table(), /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// External sort tests
+
+class TestExternalSort : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    random::RandomArrayGenerator rng(0x2c8a1f3b);
+    schema_ = schema({field("a", int32()), field("b", float64()), field("c", utf8())});
+    for (int i = 0; i < 20; ++i) {
+      // Include some empty batches
+      const int64_t length = (i % 7 == 3) ? 0 : 200 + i * 10;
+      batches_.push_back(RecordBatch::Make(
+          schema_, length,
+          {rng.Int32(length, 0, 20, 0.1), rng.Float64(length, -5, 5, 0.1),
+           rng.String(length, 0, 2, 0.2)}));
+    }
+  }
+
+  void AssertExternalSort(const SortOptions& sort_options) {
+    ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema_, batches_));
+    ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(Datum(table), sort_options));
+    ASSERT_OK_AND_ASSIGN(auto expected, Take(Datum(table), Datum(indices)));
+
+    // From spilling every batch to sorting everything in memory
+    for (int64_t memory_limit : {1, 20000, 1 << 30}) {
+      for (bool use_threads : {false, true}) {
+        // A small fan-in needs several intermediate merge passes
+        for (int max_merge_fan_in : {2, 3, ExternalSortOptions::kDefaultMaxMergeFanIn}) {
+          ARROW_SCOPED_TRACE("memory_limit = ", memory_limit,
+                             ", use_threads = ", use_threads,
+                             ", max_merge_fan_in = ", max_merge_fan_in);
+          ExecContext ctx;
+          ctx.set_use_threads(use_threads);
+          ExternalSortOptions options(sort_options, memory_limit, /*batch_size=*/333,
+                                      max_merge_fan_in);
+          ASSERT_OK_AND_ASSIGN(auto input, RecordBatchReader::Make(batches_, schema_));
+          ASSERT_OK_AND_ASSIGN(auto reader, ExternalSort(input, options, &ctx));
+
+          RecordBatchVector sorted_batches;
+          ASSERT_OK(reader->ReadAll(&sorted_batches));
+          for (const auto& batch : sorted_batches) {
+            ASSERT_LE(batch->num_rows(), options.batch_size);
+          }
+          ASSERT_OK_AND_ASSIGN(auto sorted,
+                               Table::FromRecordBatches(schema_, sorted_batches));
+          ASSERT_OK(sorted->ValidateFull());
+          AssertTablesEqual(*expected.table(), *sorted, /*same_chunk_layout=*/false);
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+};
+
+TEST_F(TestExternalSort, SingleKey) {
+  AssertExternalSort(SortOptions({SortKey("a")}));
+  AssertExternalSort(SortOptions({SortKey("c", SortOrder::Descending)}));
+}
+
+TEST_F(TestExternalSort, MultipleKeys) {
+  AssertExternalSort(SortOptions({SortKey("a"), SortKey("b", SortOrder::Descending)}));
+  AssertExternalSort(
+      SortOptions({SortKey("c", SortOrder::Descending), SortKey("b"), SortKey("a")}));
+}
+
+TEST_F(TestExternalSort, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto input, RecordBatchReader::Make(batches_, schema_));
+  ASSERT_RAISES(Invalid, ExternalSort(input, ExternalSortOptions()));
+  ASSERT_RAISES(Invalid,
+                ExternalSort(input, ExternalSortOptions(SortOptions({SortKey("x")}))));
+  ASSERT_RAISES(Invalid, ExternalSort(input, ExternalSortOptions(
+                                                 SortOptions({SortKey("a")}), 0)));
+  ASSERT_RAISES(Invalid, ExternalSort(input, ExternalSortOptions(
+                                                 SortOptions({SortKey("a")}), 1 << 20,
+                                                 /*batch_size=*/100,
+                                                 /*max_merge_fan_in=*/1)));
+}
+
 }  // namespace compute
 }  // namespace arrow
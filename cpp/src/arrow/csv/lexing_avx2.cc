@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <immintrin.h>
+
+#include "arrow/csv/lexing_internal.h"
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+SpecialCharMasks ClassifySpecialCharsAvx2(const uint8_t* data,
+                                          const SpecialChars& chars) {
+  const __m256i delimiter = _mm256_set1_epi8(chars.delimiter);
+  const __m256i quote = _mm256_set1_epi8(chars.quote_char);
+  const __m256i escape = _mm256_set1_epi8(chars.escape_char);
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+
+  SpecialCharMasks masks{0, 0};
+  for (int i = 0; i < 64; i += 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const __m256i is_escape = _mm256_cmpeq_epi8(v, escape);
+    const __m256i unquoted = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, delimiter), is_escape),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, lf)));
+    const __m256i quoted = _mm256_or_si256(_mm256_cmpeq_epi8(v, quote), is_escape);
+    masks.unquoted |= static_cast<uint64_t>(
+                          static_cast<uint32_t>(_mm256_movemask_epi8(unquoted)))
+                      << i;
+    masks.quoted |= static_cast<uint64_t>(
+                        static_cast<uint32_t>(_mm256_movemask_epi8(quoted)))
+                    << i;
+  }
+  return masks;
+}
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
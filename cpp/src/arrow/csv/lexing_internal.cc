@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/csv/lexing_internal.h"
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
+SpecialCharMasks ClassifySpecialChars(const uint8_t* data, const SpecialChars& chars) {
+  SpecialCharMasks masks{0, 0};
+  for (int i = 0; i < 64; ++i) {
+    const char c = static_cast<char>(data[i]);
+    const bool is_escape = c == chars.escape_char;
+    const bool unquoted = c == chars.delimiter || is_escape || c == '\r' || c == '\n';
+    const bool quoted = c == chars.quote_char || is_escape;
+    masks.unquoted |= static_cast<uint64_t>(unquoted) << i;
+    masks.quoted |= static_cast<uint64_t>(quoted) << i;
+  }
+  return masks;
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+SpecialCharMasks ClassifySpecialCharsSse42(const uint8_t* data,
+                                           const SpecialChars& chars) {
+  const __m128i delimiter = _mm_set1_epi8(chars.delimiter);
+  const __m128i quote = _mm_set1_epi8(chars.quote_char);
+  const __m128i escape = _mm_set1_epi8(chars.escape_char);
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+
+  SpecialCharMasks masks{0, 0};
+  for (int i = 0; i < 64; i += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i is_escape = _mm_cmpeq_epi8(v, escape);
+    const __m128i unquoted =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, delimiter), is_escape),
+                     _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+    const __m128i quoted = _mm_or_si128(_mm_cmpeq_epi8(v, quote), is_escape);
+    masks.unquoted |= static_cast<uint64_t>(_mm_movemask_epi8(unquoted)) << i;
+    masks.quoted |= static_cast<uint64_t>(_mm_movemask_epi8(quoted)) << i;
+  }
+  return masks;
+}
+#endif
+
+namespace {
+
+struct ClassifyDynamicFunction {
+  using FunctionType = ClassifyFunction;
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, ClassifySpecialChars }
+#if defined(ARROW_HAVE_SSE4_2)
+      , { DispatchLevel::SSE4_2, ClassifySpecialCharsSse42 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, ClassifySpecialCharsAvx2 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+ClassifyFunction GetSimdClassifier() {
+  static DynamicDispatch<ClassifyDynamicFunction> dispatch;
+  if (dispatch.func == ClassifySpecialChars) {
+    return nullptr;
+  }
+  return dispatch.func;
+}
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+/// \brief The characters which interrupt the contents of a field
+struct SpecialChars {
+  explicit SpecialChars(const ParseOptions& options)
+      : delimiter(options.delimiter),
+        // Disabled quoting or escaping characters are replaced with the delimiter,
+        // which is special anyway
+        quote_char(options.quoting ? options.quote_char : options.delimiter),
+        escape_char(options.escaping ? options.escape_char : options.delimiter) {}
+
+  char delimiter;
+  char quote_char;
+  char escape_char;
+};
+
+/// \brief Bitmasks of the special characters found in 64 bytes of CSV
+struct SpecialCharMasks {
+  /// Characters interrupting an unquoted field: delimiter, escape, CR and LF
+  uint64_t unquoted;
+  /// Characters interrupting a quoted field: quote and escape
+  uint64_t quoted;
+};
+
+using ClassifyFunction = SpecialCharMasks (*)(const uint8_t* data,
+                                              const SpecialChars& chars);
+
+/// \brief Classify 64 bytes of CSV one character at a time
+ARROW_EXPORT
+SpecialCharMasks ClassifySpecialChars(const uint8_t* data, const SpecialChars& chars);
+
+#if defined(ARROW_HAVE_SSE4_2)
+ARROW_EXPORT
+SpecialCharMasks ClassifySpecialCharsSse42(const uint8_t* data,
+                                           const SpecialChars& chars);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+ARROW_EXPORT
+SpecialCharMasks ClassifySpecialCharsAvx2(const uint8_t* data,
+                                          const SpecialChars& chars);
+#endif
+
+/// \brief Return the fastest SIMD classifier supported by the CPU
+///
+/// Returns nullptr if no SIMD instruction set is available, in which case
+/// scanning one character at a time is faster than classifying blocks.
+ARROW_EXPORT
+ClassifyFunction GetSimdClassifier();
+
+/// \brief Find runs of ordinary field contents in bulk
+///
+/// The data is classified 64 bytes at a time and the resulting bitmasks
+/// are reused by successive lookups, so that finding the end of a run only
+/// costs a shift and a bit scan.  The last bytes of the data, which don't make
+/// up a whole block, are not classified; the caller must examine them one
+/// character at a time.
+class SpecialCharScanner {
+ public:
+  SpecialCharScanner(ClassifyFunction classify, const ParseOptions& options)
+      : classify_(classify), chars_(options) {}
+
+  /// \brief Start scanning new data, ending at `data_end`
+  void Reset(const char* data_end) {
+    data_end_ = data_end;
+    // A sentinel block, so that lookups at the end of data return immediately
+    block_ = data_end;
+    masks_ = {~uint64_t(0), ~uint64_t(0)};
+  }
+
+  /// \brief Skip the ordinary characters of an unquoted field starting at `data`
+  ///
+  /// The returned pointer is either the first delimiter, escape, CR or LF
+  /// character, or the start of the unclassified last bytes.
+  const char* NextUnquoted(const char* data) { return Next<false>(data); }
+
+  /// \brief Skip the ordinary characters of a quoted field starting at `data`
+  ///
+  /// The returned pointer is either the first quote or escape character, or the
+  /// start of the unclassified last bytes.
+  const char* NextQuoted(const char* data) { return Next<true>(data); }
+
+ private:
+  static constexpr int64_t kBlockSize = 64;
+
+  template <bool Quoted>
+  const char* Next(const char* data) {
+    while (true) {
+      const int64_t offset = data - block_;
+      if (offset >= 0 && offset < kBlockSize) {
+        const uint64_t mask = (Quoted ? masks_.quoted : masks_.unquoted) >> offset;
+        if (mask != 0) {
+          return data + BitUtil::CountTrailingZeros(mask);
+        }
+        data = block_ + kBlockSize;
+      }
+      if (ARROW_PREDICT_FALSE(data_end_ - data < kBlockSize)) {
+        return data;
+      }
+      block_ = data;
+      masks_ = classify_(reinterpret_cast<const uint8_t*>(block_), chars_);
+    }
+  }
+
+  ClassifyFunction classify_;
+  SpecialChars chars_;
+  const char* data_end_ = NULLPTR;
+  const char* block_ = NULLPTR;
+  SpecialCharMasks masks_ = {0, 0};
+};
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
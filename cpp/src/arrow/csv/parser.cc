@@ -19,12 +19,15 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -32,6 +35,7 @@ namespace csv {
 
 using detail::DataBatch;
 using detail::ParsedValueDesc;
+using detail::SpecialCharScanner;
 
 namespace {
 
@@ -57,11 +61,13 @@ Status MismatchingColumns(int32_t expected, int32_t actual, int64_t row_num,
 
 inline bool IsControlChar(uint8_t c) { return c < ' '; }
 
-template <bool Quoting, bool Escaping>
+template <bool Quoting, bool Escaping, bool Vectorized>
 class SpecializedOptions {
  public:
   static constexpr bool quoting = Quoting;
   static constexpr bool escaping = Escaping;
+  // Whether to skip ordinary field characters in bulk using a SpecialCharScanner
+  static constexpr bool vectorized = Vectorized;
 };
 
 // A helper class allocating the buffer for parsed values and writing into it
@@ -86,6 +92,22 @@ class PresizedDataWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push `length` characters from `data`.  Short runs are copied as a fixed-size
+  // block if `data_end` allows, which is faster than a variable-size copy.
+  // (the parsed data is never larger than the input, so writing as many
+  // characters as remain in the input is always within capacity)
+  void PushFieldChars(const char* data, int64_t length, const char* data_end) {
+    constexpr int64_t kShortRun = 16;
+    if (length <= kShortRun && data_end - data >= kShortRun) {
+      DCHECK_LE(parsed_size_ + kShortRun, parsed_capacity_);
+      std::memcpy(parsed_ + parsed_size_, data, kShortRun);
+    } else {
+      DCHECK_LE(parsed_size_ + length, parsed_capacity_);
+      std::memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(length));
+    }
+    parsed_size_ += length;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -188,7 +210,9 @@ class BlockParserImpl {
         options_(options),
         first_row_(first_row),
         max_num_rows_(max_num_rows),
-        batch_(num_cols) {}
+        batch_(num_cols),
+        classify_(detail::GetSimdClassifier()),
+        scanner_(classify_, options_) {}
 
   const DataBatch& parsed_batch() const { return batch_; }
 
@@ -242,6 +266,11 @@ class BlockParserImpl {
 
   InField:
     // Inside a non-quoted part of a field
+    if (SpecializedOptions::vectorized) {
+      const char* run_end = scanner_.NextUnquoted(data);
+      parsed_writer->PushFieldChars(data, run_end - data, data_end);
+      data = run_end;
+    }
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       goto AbortLine;
     }
@@ -274,6 +303,11 @@ class BlockParserImpl {
 
   InQuotedField:
     // Inside a quoted part of a field
+    if (SpecializedOptions::vectorized) {
+      const char* run_end = scanner_.NextQuoted(data);
+      parsed_writer->PushFieldChars(data, run_end - data, data_end);
+      data = run_end;
+    }
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       goto AbortLine;
     }
@@ -411,6 +445,9 @@ class BlockParserImpl {
       const char* data = view.data();
       const char* data_end = view.data() + view.length();
       bool finished_parsing = false;
+      if (SpecializedOptions::vectorized) {
+        scanner_.Reset(data_end);
+      }
 
       if (batch_.num_cols_ == -1) {
         // Can't presize values when the number of columns is not known, first parse
@@ -485,26 +522,66 @@ class BlockParserImpl {
     return Status::OK();
   }
 
-  Status Parse(const std::vector<util::string_view>& data, bool is_final,
-               uint32_t* out_size) {
+  template <bool Vectorized>
+  Status ParseWithOptions(const std::vector<util::string_view>& data, bool is_final,
+                          uint32_t* out_size) {
     if (options_.quoting) {
       if (options_.escaping) {
-        return ParseSpecialized<SpecializedOptions<true, true>>(data, is_final, out_size);
+        return ParseSpecialized<SpecializedOptions<true, true, Vectorized>>(
+            data, is_final, out_size);
       } else {
-        return ParseSpecialized<SpecializedOptions<true, false>>(data, is_final,
-                                                                 out_size);
+        return ParseSpecialized<SpecializedOptions<true, false, Vectorized>>(
+            data, is_final, out_size);
       }
     } else {
       if (options_.escaping) {
-        return ParseSpecialized<SpecializedOptions<false, true>>(data, is_final,
-                                                                 out_size);
+        return ParseSpecialized<SpecializedOptions<false, true, Vectorized>>(
+            data, is_final, out_size);
       } else {
-        return ParseSpecialized<SpecializedOptions<false, false>>(data, is_final,
-                                                                  out_size);
+        return ParseSpecialized<SpecializedOptions<false, false, Vectorized>>(
+            data, is_final, out_size);
       }
     }
   }
 
+  // Whether skipping runs of ordinary characters in bulk is worthwhile, which
+  // isn't the case if fields are very short.  This is estimated by classifying
+  // a sample from the start of the data.
+  bool ShouldVectorize(const std::vector<util::string_view>& data) const {
+    constexpr int64_t kBlockSize = 64;
+    constexpr int64_t kSampleBlocks = 4;
+    // At most one special character every 8 bytes, on average
+    constexpr int64_t kMaxSpecialChars = kSampleBlocks * kBlockSize / 8;
+
+    if (classify_ == nullptr || data.empty()) {
+      return false;
+    }
+    const detail::SpecialChars chars(options_);
+    const auto sample = data[0];
+    const int64_t num_blocks =
+        std::min(kSampleBlocks, static_cast<int64_t>(sample.size()) / kBlockSize);
+    if (num_blocks == 0) {
+      // Too short to benefit anyway
+      return false;
+    }
+    int64_t num_special_chars = 0;
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      const auto masks = classify_(
+          reinterpret_cast<const uint8_t*>(sample.data()) + i * kBlockSize, chars);
+      num_special_chars += BitUtil::PopCount(masks.unquoted | masks.quoted);
+    }
+    return num_special_chars * kSampleBlocks <= kMaxSpecialChars * num_blocks;
+  }
+
+  Status Parse(const std::vector<util::string_view>& data, bool is_final,
+               uint32_t* out_size) {
+    if (ShouldVectorize(data)) {
+      return ParseWithOptions<true>(data, is_final, out_size);
+    } else {
+      return ParseWithOptions<false>(data, is_final, out_size);
+    }
+  }
+
  protected:
   MemoryPool* pool_;
   const ParseOptions options_;
@@ -516,6 +593,9 @@ class BlockParserImpl {
   int32_t values_size_;
   // Parsed data batch
   DataBatch batch_;
+  // SIMD classifier, if supported by the CPU
+  const detail::ClassifyFunction classify_;
+  SpecialCharScanner scanner_;
 };
 
 BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int64_t first_row,
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,6 +24,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/test_common.h"
@@ -596,6 +598,63 @@ TEST(BlockParser, Escaping) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields straddling the 64-byte blocks classified by the vectorized parser
+  const std::string a(70, 'a'), b(130, 'b');
+  {
+    auto csv = MakeCSVData({a + "," + b + "\n", b + ",x\r\n", "," + a + "\n"});
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a, b, ""}, {b, "x", a}});
+  }
+  {
+    auto csv = MakeCSVData({"\"" + a + ",\n\"\"" + b + "\"," + b + "\n"});
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + ",\n\"" + b}, {b}}, {{true}, {false}} /* quoted */);
+  }
+  {
+    auto options = ParseOptions::Defaults();
+    options.escaping = true;
+    auto csv = MakeCSVData(
+        {a + "\\," + b + ",\"" + b + "\\\"" + a + "\",w\n", b + "\\\\,y,z\n"});
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + "," + b, b + "\\"}, {b + "\"" + a, "y"}, {"w", "z"}});
+  }
+  {
+    // Truncated last row
+    auto csv = a + "," + b + "\n" + b + "," + a;
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParsePartial(parser, csv, static_cast<uint32_t>(a.size() + b.size() + 2));
+    AssertColumnsEq(parser, {{a}, {b}});
+  }
+}
+
+TEST(BlockParser, SimdClassifier) {
+  auto classify = detail::GetSimdClassifier();
+  if (classify == nullptr) {
+    GTEST_SKIP() << "No SIMD classifier available";
+  }
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  const detail::SpecialChars chars(options);
+
+  const char alphabet[] = ",\"\\\r\nab\x80\xff";
+  std::default_random_engine engine(42);
+  std::uniform_int_distribution<int> char_dist(0, sizeof(alphabet) - 2);
+  uint8_t data[64];
+  for (int i = 0; i < 100; ++i) {
+    for (auto& c : data) {
+      c = static_cast<uint8_t>(alphabet[char_dist(engine)]);
+    }
+    auto expected = detail::ClassifySpecialChars(data, chars);
+    auto actual = classify(data, chars);
+    ASSERT_EQ(actual.unquoted, expected.unquoted);
+    ASSERT_EQ(actual.quoted, expected.quoted);
+  }
+}
+
 // Generate test data with the given number of columns.
 std::string MakeLotsOfCsvColumns(int32_t num_columns) {
   std::string values, header;
@@ -25,5 +25,6 @@
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/file_csv.h"
 #include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/file_json.h"
 #include "arrow/dataset/file_parquet.h"
 #include "arrow/dataset/scanner.h"
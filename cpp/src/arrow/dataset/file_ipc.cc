@@ -25,15 +25,19 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
+using internal::MemoryRegion;
 
 namespace dataset {
 
@@ -43,10 +47,35 @@ static inline ipc::IpcReadOptions default_read_options() {
   return options;
 }
 
+// If use_memory_map is true and the source is on the local filesystem, open it
+// as a memory-mapped file and set *mapping to the mapped region.
+static inline Result<std::shared_ptr<io::RandomAccessFile>> OpenInput(
+    const FileSource& source, bool use_memory_map, MemoryRegion* mapping) {
+  const auto& filesystem = source.filesystem();
+  if (!use_memory_map || filesystem == nullptr ||
+      filesystem->type_name() != "local") {
+    return source.Open();
+  }
+  auto local_options = checked_cast<const fs::LocalFileSystem&>(*filesystem).options();
+  local_options.use_mmap = true;
+  fs::LocalFileSystem mapped_filesystem(local_options, filesystem->io_context());
+  ARROW_ASSIGN_OR_RAISE(auto input, mapped_filesystem.OpenInputFile(source.path()));
+
+  if (mapping != nullptr) {
+    // The whole file is mapped, and reading it is zero-copy
+    ARROW_ASSIGN_OR_RAISE(auto size, input->GetSize());
+    ARROW_ASSIGN_OR_RAISE(auto contents, input->ReadAt(0, size));
+    *mapping = {const_cast<uint8_t*>(contents->data()),
+                static_cast<size_t>(contents->size())};
+  }
+  return input;
+}
+
 static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
     const FileSource& source,
-    const ipc::IpcReadOptions& options = default_read_options()) {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    const ipc::IpcReadOptions& options = default_read_options(),
+    bool use_memory_map = false, MemoryRegion* mapping = NULLPTR) {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, use_memory_map, mapping));
 
   std::shared_ptr<ipc::RecordBatchFileReader> reader;
 
@@ -61,8 +90,9 @@ static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
 
 static inline Future<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReaderAsync(
     const FileSource& source,
-    const ipc::IpcReadOptions& options = default_read_options()) {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    const ipc::IpcReadOptions& options = default_read_options(),
+    bool use_memory_map = false) {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, use_memory_map, NULLPTR));
   auto path = source.path();
   return ipc::RecordBatchFileReader::OpenAsync(std::move(input), options)
       .Then([](const std::shared_ptr<ipc::RecordBatchFileReader>& reader)
@@ -74,6 +104,42 @@ static inline Future<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReaderAsyn
             });
 }
 
+// Collect the buffers of an array which lie within the mapping
+static void CollectMemoryRegions(const ArrayData& data, const MemoryRegion& mapping,
+                                 std::vector<MemoryRegion>* regions) {
+  const auto mapping_begin = reinterpret_cast<uintptr_t>(mapping.addr);
+  const auto mapping_end = mapping_begin + mapping.size;
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr || !buffer->is_cpu() || buffer->size() == 0) continue;
+    const auto begin = reinterpret_cast<uintptr_t>(buffer->data());
+    if (begin >= mapping_begin && begin + buffer->size() <= mapping_end) {
+      regions->push_back({const_cast<uint8_t*>(buffer->data()),
+                          static_cast<size_t>(buffer->size())});
+    }
+  }
+  for (const auto& child : data.child_data) {
+    CollectMemoryRegions(*child, mapping, regions);
+  }
+  if (data.dictionary != nullptr) {
+    CollectMemoryRegions(*data.dictionary, mapping, regions);
+  }
+}
+
+// Advise the OS that the buffers of a batch read from a memory-mapped file will be
+// accessed soon.  Since batches only hold the scanned columns, unused columns are
+// left alone.  Buffers which don't point into the mapping, such as decompressed
+// ones, are skipped since they are already in memory.  MADV_SEQUENTIAL isn't
+// used: over the whole mapping it would read ahead into unscanned columns, and
+// per buffer it would split the mapping into a VMA for each of them.
+static inline Status AdviseWillNeed(const RecordBatch& batch,
+                                    const MemoryRegion& mapping) {
+  std::vector<MemoryRegion> regions;
+  for (const auto& column : batch.column_data()) {
+    CollectMemoryRegions(*column, mapping, &regions);
+  }
+  return ::arrow::internal::MemoryAdviseWillNeed(regions);
+}
+
 static inline Result<std::vector<int>> GetIncludedFields(
     const Schema& schema, const std::vector<std::string>& materialized_fields) {
   std::vector<int> included_fields;
@@ -120,23 +186,46 @@ class IpcScanTask : public ScanTask {
       static Result<RecordBatchIterator> Make(const FileSource& source,
                                               const FileFormat& format,
                                               const ScanOptions& scan_options) {
-        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+        ARROW_ASSIGN_OR_RAISE(
+            auto ipc_scan_options,
+            GetFragmentScanOptions<IpcFragmentScanOptions>(
+                kIpcTypeName, &scan_options, format.default_fragment_scan_options));
+        const bool use_memory_map = ipc_scan_options->use_memory_map;
+        ARROW_ASSIGN_OR_RAISE(
+            auto reader, OpenReader(source, default_read_options(), use_memory_map));
         ARROW_ASSIGN_OR_RAISE(auto options,
                               GetReadOptions(*reader->schema(), format, scan_options));
-        ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
-        return RecordBatchIterator(Impl{std::move(reader), 0});
+        MemoryRegion mapping{nullptr, 0};
+        ARROW_ASSIGN_OR_RAISE(reader,
+                              OpenReader(source, options, use_memory_map, &mapping));
+        return RecordBatchIterator(Impl{std::move(reader), mapping, 0, nullptr});
       }
 
       Result<std::shared_ptr<RecordBatch>> Next() {
-        if (i_ == reader_->num_record_batches()) {
-          return nullptr;
+        std::shared_ptr<RecordBatch> batch = std::move(next_);
+        if (batch == nullptr) {
+          if (i_ == reader_->num_record_batches()) {
+            return nullptr;
+          }
+          ARROW_ASSIGN_OR_RAISE(batch, reader_->ReadRecordBatch(i_++));
         }
 
-        return reader_->ReadRecordBatch(i_++);
+        if (mapping_.size > 0 && i_ < reader_->num_record_batches()) {
+          // Reading a batch from a mapped file doesn't touch its buffers, so read
+          // the next one now and have its buffers paged in while this one is
+          // consumed
+          ARROW_ASSIGN_OR_RAISE(next_, reader_->ReadRecordBatch(i_++));
+          RETURN_NOT_OK(AdviseWillNeed(*next_, mapping_));
+        }
+        return batch;
       }
 
       std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+      // The mapped file, if memory-mapped
+      MemoryRegion mapping_;
       int i_;
+      // The batch after the current one, read ahead if memory-mapped
+      std::shared_ptr<RecordBatch> next_;
     };
 
     return Impl::Make(source_,
@@ -196,23 +285,23 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<FileFragment>& file) const {
   auto self = shared_from_this();
   auto source = file->source();
-  auto open_reader = OpenReaderAsync(source);
-  auto reopen_reader = [self, options,
-                        source](std::shared_ptr<ipc::RecordBatchFileReader> reader)
+  ARROW_ASSIGN_OR_RAISE(
+      auto ipc_scan_options,
+      GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
+                                                     default_fragment_scan_options));
+  const bool use_memory_map = ipc_scan_options->use_memory_map;
+  auto open_reader = OpenReaderAsync(source, default_read_options(), use_memory_map);
+  auto mapping = std::make_shared<MemoryRegion>(MemoryRegion{nullptr, 0});
+  auto reopen_reader = [self, options, source, use_memory_map, mapping](
+                           std::shared_ptr<ipc::RecordBatchFileReader> reader)
       -> Future<std::shared_ptr<ipc::RecordBatchFileReader>> {
     ARROW_ASSIGN_OR_RAISE(auto options,
                           GetReadOptions(*reader->schema(), *self, *options));
-    return OpenReader(source, options);
+    return OpenReader(source, options, use_memory_map, mapping.get());
   };
   auto readahead_level = options->batch_readahead;
-  auto default_fragment_scan_options = this->default_fragment_scan_options;
   auto open_generator = [=](const std::shared_ptr<ipc::RecordBatchFileReader>& reader)
       -> Result<RecordBatchGenerator> {
-    ARROW_ASSIGN_OR_RAISE(
-        auto ipc_scan_options,
-        GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
-                                                       default_fragment_scan_options));
-
     RecordBatchGenerator generator;
     if (ipc_scan_options->cache_options) {
       // Transferring helps performance when coalescing
@@ -224,6 +313,16 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
                                            /*coalesce=*/false, options->io_context));
     }
+    if (mapping->size > 0) {
+      // Advise as batches are read ahead by the readahead generator below,
+      // rather than when they are consumed
+      generator = MakeMappedGenerator<std::shared_ptr<RecordBatch>>(
+          std::move(generator), [mapping](const std::shared_ptr<RecordBatch>& batch)
+                                    -> Result<std::shared_ptr<RecordBatch>> {
+            RETURN_NOT_OK(AdviseWillNeed(*batch, *mapping));
+            return batch;
+          });
+    }
     return MakeReadaheadGenerator(std::move(generator), readahead_level);
   };
   return MakeFromFuture(open_reader.Then(reopen_reader).Then(open_generator));
@@ -83,6 +83,10 @@ class ARROW_DS_EXPORT IpcFragmentScanOptions : public FragmentScanOptions {
   /// If present, the async scanner will enable I/O coalescing.
   /// This is ignored by the sync scanner.
   std::shared_ptr<io::CacheOptions> cache_options;
+  /// If true, fragments on the local filesystem are memory-mapped: record
+  /// batches of uncompressed files are then zero-copy slices of the mapping,
+  /// and the OS is advised to read ahead the buffers of the scanned columns.
+  bool use_memory_map = false;
 };
 
 class ARROW_DS_EXPORT IpcFileWriteOptions : public FileWriteOptions {
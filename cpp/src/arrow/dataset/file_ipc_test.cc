@@ -27,6 +27,7 @@
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
@@ -34,6 +35,7 @@
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
@@ -168,6 +170,39 @@ TEST_P(TestIpcFileFormatScan, FragmentScanOptions) {
   ASSERT_OK_AND_ASSIGN(auto batches, scan_task->Execute());
   ASSERT_RAISES(Invalid, batches.Next());
 }
+TEST_P(TestIpcFileFormatScan, MemoryMap) {
+  auto f64 = field("f64", float64());
+  auto i32 = field("i32", int32());
+  SetSchema({f64, i32});
+  Project({"f64"});
+  auto reader = GetRecordBatchReader(opts_->dataset_schema);
+  ASSERT_OK_AND_ASSIGN(auto buffer, IpcFormatHelper::Write(reader.get()));
+
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, arrow::internal::TemporaryDir::Make("ipc-mmap-"));
+  auto filesystem = std::make_shared<fs::LocalFileSystem>();
+  const auto path = temp_dir->path().ToString() + "data.arrow";
+  ASSERT_OK_AND_ASSIGN(auto stream, filesystem->OpenOutputStream(path));
+  ASSERT_OK(stream->Write(buffer));
+  ASSERT_OK(stream->Close());
+
+  auto fragment_scan_options = std::make_shared<IpcFragmentScanOptions>();
+  fragment_scan_options->use_memory_map = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+  auto fragment = MakeFragment(FileSource(path, filesystem));
+
+  // Batches are zero-copy slices of the mapped file
+  const int64_t bytes_allocated = default_memory_pool()->bytes_allocated();
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  int64_t row_count = 0;
+  for (auto maybe_batch : PhysicalBatches(fragment)) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertSchemaEqual(*batch->schema(), *schema({f64}), /*check_metadata=*/false);
+    row_count += batch->num_rows();
+    batches.push_back(std::move(batch));
+  }
+  ASSERT_EQ(row_count, expected_rows());
+  ASSERT_EQ(default_memory_pool()->bytes_allocated(), bytes_allocated);
+}
 INSTANTIATE_TEST_SUITE_P(TestScan, TestIpcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
@@ -0,0 +1,209 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/result.h"
+#include "arrow/type.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+using internal::Executor;
+using RecordBatchGenerator = std::function<Future<std::shared_ptr<RecordBatch>>()>;
+
+static inline Result<json::ParseOptions> GetParseOptions(
+    json::ParseOptions parse_options, const ScanOptions* scan_options,
+    const std::shared_ptr<FileFragment>& fragment) {
+  if (!scan_options || !fragment) return parse_options;
+
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema, fragment->ReadPhysicalSchema());
+  auto materialized = scan_options->MaterializedFields();
+  std::unordered_set<std::string> materialized_fields(materialized.begin(),
+                                                      materialized.end());
+  FieldVector fields;
+  for (const auto& field : scan_options->dataset_schema->fields()) {
+    if (materialized_fields.find(field->name()) == materialized_fields.end()) continue;
+    // Ignore virtual columns.
+    if (physical_schema->GetFieldByName(field->name()) == nullptr) continue;
+    // Only read the requested fields, with the declared types
+    fields.push_back(field);
+  }
+  parse_options.explicit_schema = schema(std::move(fields));
+  parse_options.unexpected_field_behavior = json::UnexpectedFieldBehavior::Ignore;
+  return parse_options;
+}
+
+static inline Result<json::ReadOptions> GetReadOptions(
+    const JsonFileFormat& format, const std::shared_ptr<ScanOptions>& scan_options) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto json_scan_options,
+      GetFragmentScanOptions<JsonFragmentScanOptions>(
+          kJsonTypeName, scan_options.get(), format.default_fragment_scan_options));
+  return json_scan_options->read_options;
+}
+
+static inline Future<std::shared_ptr<json::StreamingReader>> OpenReaderAsync(
+    const FileSource& source, const JsonFileFormat& format,
+    const std::shared_ptr<ScanOptions>& scan_options,
+    const std::shared_ptr<FileFragment>& fragment, Executor* cpu_executor) {
+  ARROW_ASSIGN_OR_RAISE(auto read_options, GetReadOptions(format, scan_options));
+  ARROW_ASSIGN_OR_RAISE(auto input, source.OpenCompressed());
+
+  // Reading the physical schema may require inspecting the fragment, which blocks,
+  // so we run the whole thing on the I/O thread pool.
+  auto format_parse_options = format.parse_options;
+  auto reader_fut = DeferNotOk(input->io_context().executor()->Submit(
+      [=]() -> Future<std::shared_ptr<json::StreamingReader>> {
+        ARROW_ASSIGN_OR_RAISE(
+            auto parse_options,
+            GetParseOptions(format_parse_options, scan_options.get(), fragment));
+        return json::StreamingReader::MakeAsync(io::default_io_context(),
+                                                std::move(input), cpu_executor,
+                                                read_options, parse_options);
+      }));
+  return reader_fut.Then(
+      // Adds the filename to the error
+      [](const std::shared_ptr<json::StreamingReader>& maybe_reader)
+          -> Result<std::shared_ptr<json::StreamingReader>> { return maybe_reader; },
+      [source](const Status& err) -> Result<std::shared_ptr<json::StreamingReader>> {
+        return err.WithMessage("Could not open JSON input source '", source.path(),
+                               "': ", err);
+      });
+}
+
+static inline Result<std::shared_ptr<json::StreamingReader>> OpenReader(
+    const FileSource& source, const JsonFileFormat& format) {
+  auto open_reader_fut =
+      OpenReaderAsync(source, format, /*scan_options=*/nullptr, /*fragment=*/nullptr,
+                      internal::GetCpuThreadPool());
+  return open_reader_fut.result();
+}
+
+static RecordBatchGenerator GeneratorFromReader(
+    const Future<std::shared_ptr<json::StreamingReader>>& reader) {
+  auto gen_fut = reader.Then(
+      [](const std::shared_ptr<json::StreamingReader>& reader) -> RecordBatchGenerator {
+        return [reader]() { return reader->ReadNextAsync(); };
+      });
+  return MakeFromFuture(std::move(gen_fut));
+}
+
+/// \brief A ScanTask backed by a JSON file.
+class JsonScanTask : public ScanTask {
+ public:
+  JsonScanTask(std::shared_ptr<const JsonFileFormat> format,
+               std::shared_ptr<ScanOptions> options,
+               std::shared_ptr<FileFragment> fragment)
+      : ScanTask(std::move(options), fragment),
+        format_(std::move(format)),
+        fragment_(std::move(fragment)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    auto reader_fut = OpenReaderAsync(fragment_->source(), *format_, options(), fragment_,
+                                      internal::GetCpuThreadPool());
+    auto reader_gen = GeneratorFromReader(std::move(reader_fut));
+    return MakeGeneratorIterator(std::move(reader_gen));
+  }
+
+  Future<RecordBatchVector> SafeExecute(internal::Executor* executor) override {
+    auto reader_fut =
+        OpenReaderAsync(fragment_->source(), *format_, options(), fragment_, executor);
+    auto reader_gen = GeneratorFromReader(std::move(reader_fut));
+    return CollectAsyncGenerator(reader_gen);
+  }
+
+  Future<> SafeVisit(
+      internal::Executor* executor,
+      std::function<Status(std::shared_ptr<RecordBatch>)> visitor) override {
+    auto reader_fut =
+        OpenReaderAsync(fragment_->source(), *format_, options(), fragment_, executor);
+    auto reader_gen = GeneratorFromReader(std::move(reader_fut));
+    return VisitAsyncGenerator(reader_gen, visitor);
+  }
+
+ private:
+  std::shared_ptr<const JsonFileFormat> format_;
+  std::shared_ptr<FileFragment> fragment_;
+};
+
+bool JsonFileFormat::Equals(const FileFormat& format) const {
+  if (type_name() != format.type_name()) return false;
+
+  const auto& other_parse_options =
+      checked_cast<const JsonFileFormat&>(format).parse_options;
+
+  if (parse_options.explicit_schema == nullptr ||
+      other_parse_options.explicit_schema == nullptr) {
+    if (parse_options.explicit_schema != other_parse_options.explicit_schema) {
+      return false;
+    }
+  } else if (!parse_options.explicit_schema->Equals(
+                 *other_parse_options.explicit_schema)) {
+    return false;
+  }
+
+  return parse_options.newlines_in_values == other_parse_options.newlines_in_values &&
+         parse_options.unexpected_field_behavior ==
+             other_parse_options.unexpected_field_behavior &&
+         parse_options.use_structural_index == other_parse_options.use_structural_index;
+}
+
+Result<bool> JsonFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenReader(source, *this).ok();
+}
+
+Result<std::shared_ptr<Schema>> JsonFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, *this));
+  return reader->schema();
+}
+
+Result<ScanTaskIterator> JsonFileFormat::ScanFile(
+    const std::shared_ptr<ScanOptions>& options,
+    const std::shared_ptr<FileFragment>& fragment) const {
+  auto this_ = checked_pointer_cast<const JsonFileFormat>(shared_from_this());
+  auto task = std::make_shared<JsonScanTask>(std::move(this_), options, fragment);
+
+  return MakeVectorIterator<std::shared_ptr<ScanTask>>({std::move(task)});
+}
+
+Result<RecordBatchGenerator> JsonFileFormat::ScanBatchesAsync(
+    const std::shared_ptr<ScanOptions>& scan_options,
+    const std::shared_ptr<FileFragment>& file) const {
+  auto reader_fut = OpenReaderAsync(file->source(), *this, scan_options, file,
+                                    internal::GetCpuThreadPool());
+  return GeneratorFromReader(std::move(reader_fut));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace dataset {
+
+class JsonFormatHelper {
+ public:
+  using FormatType = JsonFileFormat;
+  static Result<std::shared_ptr<Buffer>> Write(RecordBatchReader* reader) {
+    std::string json;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) break;
+      for (int64_t row = 0; row < batch->num_rows(); ++row) {
+        json += "{";
+        for (int i = 0; i < batch->num_columns(); ++i) {
+          ARROW_ASSIGN_OR_RAISE(auto scalar, batch->column(i)->GetScalar(row));
+          if (i > 0) json += ",";
+          json += "\"" + batch->schema()->field(i)->name() + "\":";
+          json += scalar->is_valid ? scalar->ToString() : "null";
+        }
+        json += "}\n";
+      }
+    }
+    return Buffer::FromString(std::move(json));
+  }
+
+  static std::shared_ptr<JsonFileFormat> MakeFormat() {
+    return std::make_shared<JsonFileFormat>();
+  }
+};
+
+class TestJsonFileFormat : public FileFormatFixtureMixin<JsonFormatHelper> {
+ public:
+  std::unique_ptr<FileSource> GetFileSource(std::string json) {
+    return internal::make_unique<FileSource>(Buffer::FromString(std::move(json)));
+  }
+
+  RecordBatchIterator Batches(ScanTaskIterator scan_task_it) {
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  RecordBatchIterator Batches(Fragment* fragment) {
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_));
+    return Batches(std::move(scan_task_it));
+  }
+};
+
+TEST_F(TestJsonFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource(R"({"f64": 1.0}
+{}
+{"f64": null}
+{"f64": 2})");
+  SetSchema({field("f64", float64())});
+  auto fragment = MakeFragment(*source);
+
+  int64_t row_count = 0;
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 4);
+}
+
+TEST_F(TestJsonFileFormat, ScanRecordBatchReaderWithVirtualColumn) {
+  auto source = GetFileSource(R"({"f64": 1.0}
+{"f64": 2.5})");
+  // NB: dataset_schema includes a column not present in the file
+  SetSchema({field("f64", float64()), field("virtual", int32())});
+  auto fragment = MakeFragment(*source);
+
+  ASSERT_OK_AND_ASSIGN(auto physical_schema, fragment->ReadPhysicalSchema());
+  AssertSchemaEqual(Schema({field("f64", float64())}), *physical_schema);
+
+  int64_t row_count = 0;
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertSchemaEqual(*batch->schema(), *physical_schema);
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 2);
+}
+
+TEST_F(TestJsonFileFormat, ScanProjectedWithDeclaredTypes) {
+  auto source = GetFileSource(R"({"i": 1, "s": "foo", "unused": true}
+{"i": 2, "s": null, "unused": false})");
+  // The inferred type of "i" is int64, but the declared one is used
+  SetSchema({field("i", float32()), field("s", utf8()), field("unused", boolean())});
+  Project({"i", "s"});
+  auto fragment = MakeFragment(*source);
+
+  int64_t row_count = 0;
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertSchemaEqual(Schema({field("i", float32()), field("s", utf8())}),
+                      *batch->schema());
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 2);
+}
+
+TEST_F(TestJsonFileFormat, ScanManyBlocksInOrder) {
+  int64_t count = 1 << 12;
+  std::string json;
+  for (int64_t i = 0; i < count; ++i) {
+    json += "{\"i\": " + std::to_string(i) + "}\n";
+  }
+  auto source = GetFileSource(json);
+  SetSchema({field("i", int64())});
+  auto fragment_scan_options = std::make_shared<JsonFragmentScanOptions>();
+  fragment_scan_options->read_options.block_size = 1 << 10;
+  fragment_scan_options->read_options.use_threads = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+  auto fragment = MakeFragment(*source);
+
+  ASSERT_OK_AND_ASSIGN(auto batch_gen, format_->ScanBatchesAsync(opts_, fragment));
+  auto batches_fut = CollectAsyncGenerator(std::move(batch_gen));
+  ASSERT_OK_AND_ASSIGN(auto batches, batches_fut.result());
+  ASSERT_GT(batches.size(), static_cast<size_t>(1));
+
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    const auto& column = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < column.length(); ++i) {
+      ASSERT_EQ(column.Value(i), expected);
+      ++expected;
+    }
+  }
+  ASSERT_EQ(expected, count);
+}
+
+TEST_F(TestJsonFileFormat, InspectFailureWithRelevantError) {
+  TestInspectFailureWithRelevantError(StatusCode::Invalid, "JSON");
+}
+
+TEST_F(TestJsonFileFormat, Inspect) {
+  TestInspect();
+  auto source = GetFileSource(R"({"f64": 1.0, "str": "foo"}
+{"f64": null})");
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source.get()));
+  EXPECT_EQ(*actual, Schema({field("f64", float64()), field("str", utf8())}));
+}
+
+TEST_F(TestJsonFileFormat, IsSupported) {
+  bool supported;
+
+  auto source = GetFileSource("");
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  ASSERT_EQ(supported, false);
+
+  source = GetFileSource("f64,str\n1.0,foo\n");
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  ASSERT_EQ(supported, false);
+
+  source = GetFileSource(R"({"f64": 1.0})");
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  EXPECT_EQ(supported, true);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -24,10 +24,13 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
@@ -37,7 +40,9 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -55,7 +60,8 @@ using parquet::arrow::StatisticsAsScalars;
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
-  ParquetScanTask(int row_group, std::vector<int> column_projection,
+  ParquetScanTask(int row_group, util::optional<parquet::RowRanges> row_ranges,
+                  std::vector<int> column_projection,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<std::once_flag> pre_buffer_once,
                   std::vector<int> pre_buffer_row_groups, arrow::io::IOContext io_context,
@@ -64,6 +70,7 @@ class ParquetScanTask : public ScanTask {
                   std::shared_ptr<Fragment> fragment)
       : ScanTask(std::move(options), std::move(fragment)),
         row_group_(row_group),
+        row_ranges_(std::move(row_ranges)),
         column_projection_(std::move(column_projection)),
         reader_(std::move(reader)),
         pre_buffer_once_(std::move(pre_buffer_once)),
@@ -89,6 +96,17 @@ class ParquetScanTask : public ScanTask {
       std::unique_ptr<RecordBatchReader> record_batch_reader;
     } NextBatch;
 
+    if (row_ranges_) {
+      // Only the pages overlapping the selected rows are read
+      std::shared_ptr<Table> table;
+      RETURN_NOT_OK(
+          reader_->ReadRowGroup(row_group_, column_projection_, *row_ranges_, &table));
+      auto table_reader = std::make_shared<TableBatchReader>(*table);
+      table_reader->set_chunksize(options_->batch_size);
+      return MakeFunctionIterator(
+          [table, table_reader]() { return table_reader->Next(); });
+    }
+
     RETURN_NOT_OK(EnsurePreBuffered());
     NextBatch.file_reader = reader_;
     RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
@@ -118,6 +136,8 @@ class ParquetScanTask : public ScanTask {
 
  private:
   int row_group_;
+  // The rows to read if not the whole row group
+  util::optional<parquet::RowRanges> row_ranges_;
   std::vector<int> column_projection_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
   // Pre-buffering state. pre_buffer_once will be nullptr if no pre-buffering is
@@ -164,6 +184,34 @@ static Result<std::shared_ptr<SchemaManifest>> GetSchemaManifest(
   return manifest;
 }
 
+// Express the bounds of a field's values given by min/max statistics
+static util::optional<compute::Expression> StatisticsAsExpression(
+    const std::shared_ptr<Field>& field, const parquet::Statistics& statistics) {
+  std::shared_ptr<Scalar> min, max;
+  if (!StatisticsAsScalars(statistics, &min, &max).ok()) {
+    return util::nullopt;
+  }
+
+  auto field_expr = compute::field_ref(field->name());
+  auto maybe_min = min->CastTo(field->type());
+  auto maybe_max = max->CastTo(field->type());
+  if (maybe_min.ok() && maybe_max.ok()) {
+    auto col_min = maybe_min.MoveValueUnsafe();
+    auto col_max = maybe_max.MoveValueUnsafe();
+    if (col_min->Equals(col_max)) {
+      return compute::equal(std::move(field_expr), compute::literal(std::move(col_min)));
+    }
+
+    auto lower_bound =
+        compute::greater_equal(field_expr, compute::literal(std::move(col_min)));
+    auto upper_bound =
+        compute::less_equal(std::move(field_expr), compute::literal(std::move(col_max)));
+    return compute::and_(std::move(lower_bound), std::move(upper_bound));
+  }
+
+  return util::nullopt;
+}
+
 static util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
     const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
   // For the remaining of this function, failure to extract/parse statistics
@@ -182,36 +230,162 @@ static util::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
     return util::nullopt;
   }
 
-  const auto& field = schema_field.field;
-  auto field_expr = compute::field_ref(field->name());
-
   // Optimize for corner case where all values are nulls
   if (statistics->num_values() == 0 && statistics->null_count() > 0) {
-    return is_null(std::move(field_expr));
+    return is_null(compute::field_ref(schema_field.field->name()));
   }
 
-  std::shared_ptr<Scalar> min, max;
-  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
-    return util::nullopt;
+  return StatisticsAsExpression(schema_field.field, *statistics);
+}
+
+/// \brief A conjunction member of a predicate which is only satisfied by rows
+/// whose value in a leaf column is one of `values`, such as `x == 3` or
+/// `is_in(x, [1, 2])`.
+struct EqualityProbe {
+  int column_index;
+  ScalarVector values;
+};
+
+static void CollectConjunctionMembers(const compute::Expression& expr,
+                                      std::vector<compute::Expression>* members) {
+  auto call = expr.call();
+  if (call && call->function_name == "and_kleene") {
+    for (const auto& argument : call->arguments) {
+      CollectConjunctionMembers(argument, members);
+    }
+  } else {
+    members->push_back(expr);
   }
+}
 
-  auto maybe_min = min->CastTo(field->type());
-  auto maybe_max = max->CastTo(field->type());
-  if (maybe_min.ok() && maybe_max.ok()) {
-    auto col_min = maybe_min.MoveValueUnsafe();
-    auto col_max = maybe_max.MoveValueUnsafe();
-    if (col_min->Equals(col_max)) {
-      return compute::equal(std::move(field_expr), compute::literal(std::move(col_min)));
+static util::optional<EqualityProbe> ExpressionAsEqualityProbe(
+    const compute::Expression& expr, const Schema& physical_schema,
+    const SchemaManifest& manifest) {
+  auto call = expr.call();
+  if (!call || call->arguments.empty()) return util::nullopt;
+
+  const FieldRef* ref = call->arguments[0].field_ref();
+  ScalarVector values;
+  if (call->function_name == "equal") {
+    const Datum* lit = call->arguments[1].literal();
+    if (ref == nullptr) {
+      // equal(literal, field)
+      ref = call->arguments[1].field_ref();
+      lit = call->arguments[0].literal();
+    }
+    if (ref == nullptr || lit == nullptr || !lit->is_scalar()) return util::nullopt;
+    values.push_back(lit->scalar());
+  } else if (call->function_name == "is_in" && call->options) {
+    const auto& options = checked_cast<const compute::SetLookupOptions&>(*call->options);
+    if (ref == nullptr) return util::nullopt;
+    ArrayVector chunks;
+    if (options.value_set.is_array()) {
+      chunks.push_back(options.value_set.make_array());
+    } else if (options.value_set.kind() == Datum::CHUNKED_ARRAY) {
+      chunks = options.value_set.chunked_array()->chunks();
+    } else {
+      return util::nullopt;
+    }
+    for (const auto& chunk : chunks) {
+      // A null in the value set matches null rows, which Bloom filters don't track
+      if (chunk->null_count() > 0 && !options.skip_nulls) return util::nullopt;
+      for (int64_t i = 0; i < chunk->length(); ++i) {
+        if (chunk->IsNull(i)) continue;
+        auto maybe_value = chunk->GetScalar(i);
+        if (!maybe_value.ok()) return util::nullopt;
+        values.push_back(maybe_value.MoveValueUnsafe());
+      }
     }
+  } else {
+    return util::nullopt;
+  }
 
-    auto lower_bound =
-        compute::greater_equal(field_expr, compute::literal(std::move(col_min)));
-    auto upper_bound =
-        compute::less_equal(std::move(field_expr), compute::literal(std::move(col_max)));
-    return compute::and_(std::move(lower_bound), std::move(upper_bound));
+  auto maybe_match = ref->FindOneOrNone(physical_schema);
+  if (!maybe_match.ok() || maybe_match->empty()) return util::nullopt;
+  const SchemaField& schema_field = manifest.schema_fields[(*maybe_match)[0]];
+  if (!schema_field.is_leaf()) return util::nullopt;
+
+  // Compare the values as they would be stored in the column
+  for (auto& value : values) {
+    if (!value->is_valid) return util::nullopt;
+    auto maybe_value = value->CastTo(schema_field.field->type());
+    if (!maybe_value.ok()) return util::nullopt;
+    value = maybe_value.MoveValueUnsafe();
   }
+  return EqualityProbe{schema_field.column_index, std::move(values)};
+}
 
-  return util::nullopt;
+template <typename ScalarType>
+static int64_t IntegerScalarValue(const Scalar& scalar) {
+  return static_cast<int64_t>(checked_cast<const ScalarType&>(scalar).value);
+}
+
+/// \brief Hash a scalar the way the Parquet writer hashes the column's values,
+/// or return nullopt if it is not known how the value is stored.
+static util::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                                parquet::Type::type physical_type,
+                                                const Scalar& value) {
+  util::optional<int64_t> integer;
+  switch (value.type->id()) {
+    case Type::INT8:
+      integer = IntegerScalarValue<Int8Scalar>(value);
+      break;
+    case Type::INT16:
+      integer = IntegerScalarValue<Int16Scalar>(value);
+      break;
+    case Type::INT32:
+      integer = IntegerScalarValue<Int32Scalar>(value);
+      break;
+    case Type::INT64:
+      integer = IntegerScalarValue<Int64Scalar>(value);
+      break;
+    case Type::UINT8:
+      integer = IntegerScalarValue<UInt8Scalar>(value);
+      break;
+    case Type::UINT16:
+      integer = IntegerScalarValue<UInt16Scalar>(value);
+      break;
+    case Type::UINT32:
+      integer = IntegerScalarValue<UInt32Scalar>(value);
+      break;
+    case Type::UINT64:
+      integer = IntegerScalarValue<UInt64Scalar>(value);
+      break;
+    case Type::DATE32:
+      integer = IntegerScalarValue<Date32Scalar>(value);
+      break;
+    case Type::FLOAT: {
+      const float v = checked_cast<const FloatScalar&>(value).value;
+      // -0.0 and 0.0 compare equal but hash differently
+      if (physical_type != parquet::Type::FLOAT || v == 0) return util::nullopt;
+      return bloom_filter.Hash(v);
+    }
+    case Type::DOUBLE: {
+      const double v = checked_cast<const DoubleScalar&>(value).value;
+      if (physical_type != parquet::Type::DOUBLE || v == 0) return util::nullopt;
+      return bloom_filter.Hash(v);
+    }
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY: {
+      if (physical_type != parquet::Type::BYTE_ARRAY) return util::nullopt;
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      parquet::ByteArray byte_array(static_cast<uint32_t>(buffer.size()), buffer.data());
+      return bloom_filter.Hash(&byte_array);
+    }
+    default:
+      return util::nullopt;
+  }
+
+  switch (physical_type) {
+    case parquet::Type::INT32:
+      return bloom_filter.Hash(static_cast<int32_t>(*integer));
+    case parquet::Type::INT64:
+      return bloom_filter.Hash(*integer);
+    default:
+      return util::nullopt;
+  }
 }
 
 static void AddColumnIndices(const SchemaField& schema_field,
@@ -321,6 +495,10 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   if (options) {
     arrow_properties.set_batch_size(options->batch_size);
   }
+  arrow_properties.set_io_context(
+      parquet_scan_options->arrow_reader_properties->io_context());
+  arrow_properties.set_cache_options(
+      parquet_scan_options->arrow_reader_properties->cache_options());
 
   if (options && !options->use_threads) {
     arrow_properties.set_use_threads(
@@ -410,8 +588,28 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     if (row_groups.empty()) MakeEmpty();
   }
 
+  // Narrow each row group down to the pages which may satisfy the filter.  Row
+  // groups which are only partially read are not pre-buffered.
+  std::vector<int> selected_row_groups, pre_buffer_row_groups;
+  std::vector<util::optional<parquet::RowRanges>> row_ranges;
+  for (int row_group : row_groups) {
+    ARROW_ASSIGN_OR_RAISE(auto ranges,
+                          parquet_fragment->FilterPages(options->filter, row_group,
+                                                        reader->parquet_reader()));
+    if (ranges.empty()) continue;
+    selected_row_groups.push_back(row_group);
+    const int64_t num_rows =
+        parquet_fragment->metadata()->RowGroup(row_group)->num_rows();
+    if (ranges.size() == 1 && ranges[0].length == num_rows) {
+      row_ranges.emplace_back();
+      pre_buffer_row_groups.push_back(row_group);
+    } else {
+      row_ranges.emplace_back(std::move(ranges));
+    }
+  }
+
   auto column_projection = InferColumnProjection(*reader, *options);
-  ScanTaskVector tasks(row_groups.size());
+  ScanTaskVector tasks(selected_row_groups.size());
 
   ARROW_ASSIGN_OR_RAISE(
       auto parquet_scan_options,
@@ -422,9 +620,10 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     pre_buffer_once = std::make_shared<std::once_flag>();
   }
 
-  for (size_t i = 0; i < row_groups.size(); ++i) {
+  for (size_t i = 0; i < selected_row_groups.size(); ++i) {
     tasks[i] = std::make_shared<ParquetScanTask>(
-        row_groups[i], column_projection, reader, pre_buffer_once, row_groups,
+        selected_row_groups[i], std::move(row_ranges[i]), column_projection, reader,
+        pre_buffer_once, pre_buffer_row_groups,
         parquet_scan_options->arrow_reader_properties->io_context(),
         parquet_scan_options->arrow_reader_properties->cache_options(), options,
         fragment);
@@ -666,7 +865,7 @@ inline void FoldingAnd(compute::Expression* l, compute::Expression r) {
 Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(
     compute::Expression predicate) {
   std::vector<int> row_groups;
-  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(std::move(predicate)));
+  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(predicate));
 
   auto lock = physical_schema_mutex_.Lock();
   DCHECK(expressions.empty() || (expressions.size() == row_groups_->size()));
@@ -675,7 +874,105 @@ Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(
       row_groups.push_back(row_groups_->at(i));
     }
   }
-  return row_groups;
+  // Copy the metadata while it is guarded, the Bloom filters are read unlocked
+  auto physical_schema = physical_schema_;
+  auto metadata = metadata_;
+  auto manifest = manifest_;
+  lock.Unlock();
+
+  return FilterRowGroupsByBloomFilter(predicate, std::move(row_groups), *physical_schema,
+                                      std::move(metadata), *manifest);
+}
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsByBloomFilter(
+    const compute::Expression& predicate, std::vector<int> row_groups,
+    const Schema& physical_schema, std::shared_ptr<parquet::FileMetaData> metadata,
+    const parquet::arrow::SchemaManifest& manifest) {
+  if (row_groups.empty()) return row_groups;
+
+  std::vector<compute::Expression> members;
+  CollectConjunctionMembers(predicate, &members);
+  std::vector<EqualityProbe> probes;
+  for (const auto& member : members) {
+    if (auto probe = ExpressionAsEqualityProbe(member, physical_schema, manifest)) {
+      probes.push_back(std::move(*probe));
+    }
+  }
+  if (probes.empty()) return row_groups;
+
+  // Bloom filters aren't part of the footer, so only open the file if one of
+  // the probed column chunks has one
+  bool has_bloom_filter = false;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (int row_group : row_groups) {
+    auto row_group_metadata = metadata->RowGroup(row_group);
+    for (const auto& probe : probes) {
+      has_bloom_filter |=
+          row_group_metadata->ColumnChunk(probe.column_index)->has_bloom_filter();
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  if (!has_bloom_filter) return row_groups;
+
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBloomFilterReader(std::move(metadata)));
+
+  std::vector<int> selected;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (int row_group : row_groups) {
+    auto row_group_reader = reader->RowGroup(row_group);
+    bool satisfiable = true;
+    for (const auto& probe : probes) {
+      auto column_chunk = row_group_reader->metadata()->ColumnChunk(probe.column_index);
+      // Encrypted Bloom filters aren't supported
+      if (!column_chunk->has_bloom_filter() || column_chunk->crypto_metadata()) continue;
+      auto bloom_filter = row_group_reader->GetColumnBloomFilter(probe.column_index);
+
+      const auto physical_type = column_chunk->type();
+      bool maybe_contained = false;
+      for (const auto& value : probe.values) {
+        auto hash = BloomFilterHash(*bloom_filter, physical_type, *value);
+        if (!hash || bloom_filter->FindHash(*hash)) {
+          maybe_contained = true;
+          break;
+        }
+      }
+      if (!maybe_contained) {
+        satisfiable = false;
+        break;
+      }
+    }
+    if (satisfiable) selected.push_back(row_group);
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selected;
+}
+
+Result<std::shared_ptr<parquet::ParquetFileReader>>
+ParquetFileFragment::GetBloomFilterReader(
+    std::shared_ptr<parquet::FileMetaData> metadata) {
+  {
+    auto lock = physical_schema_mutex_.Lock();
+    if (bloom_filter_reader_ != nullptr) return bloom_filter_reader_;
+  }
+
+  // Open the source unlocked, like ReadPhysicalSchema
+  ARROW_ASSIGN_OR_RAISE(auto parquet_scan_options,
+                        GetFragmentScanOptions<ParquetFragmentScanOptions>(
+                            kParquetTypeName, nullptr,
+                            parquet_format_.default_fragment_scan_options));
+  ARROW_ASSIGN_OR_RAISE(auto input, source_.Open());
+  std::shared_ptr<parquet::ParquetFileReader> reader;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  reader = parquet::ParquetFileReader::Open(
+      std::move(input), MakeReaderProperties(parquet_format_, parquet_scan_options.get()),
+      std::move(metadata));
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  auto lock = physical_schema_mutex_.Lock();
+  if (bloom_filter_reader_ == nullptr) {
+    bloom_filter_reader_ = std::move(reader);
+  }
+  return bloom_filter_reader_;
 }
 
 Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
@@ -722,6 +1019,86 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   return row_groups;
 }
 
+Result<parquet::RowRanges> ParquetFileFragment::FilterPages(
+    compute::Expression predicate, int row_group, parquet::ParquetFileReader* reader) {
+  auto lock = physical_schema_mutex_.Lock();
+  DCHECK_NE(metadata_, nullptr);
+  // Copy the metadata while it is guarded, the page indexes are read unlocked
+  auto physical_schema = physical_schema_;
+  auto metadata = metadata_;
+  auto manifest = manifest_;
+  lock.Unlock();
+
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (!predicate.IsSatisfiable()) {
+    return parquet::RowRanges{};
+  }
+
+  const int64_t num_rows = metadata->RowGroup(row_group)->num_rows();
+  parquet::RowRanges selected = {{0, num_rows}};
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto row_group_reader = reader->RowGroup(row_group);
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema));
+    if (match.empty()) continue;
+
+    const SchemaField& schema_field = manifest->schema_fields[match[0]];
+    if (!schema_field.is_leaf()) continue;
+    const int column_index = schema_field.column_index;
+    auto column_chunk = row_group_reader->metadata()->ColumnChunk(column_index);
+    if (!column_chunk->has_column_index() || !column_chunk->has_offset_index() ||
+        column_chunk->crypto_metadata()) {
+      continue;
+    }
+
+    auto page_stats = row_group_reader->GetColumnIndex(column_index);
+    auto offset_index = row_group_reader->GetOffsetIndex(column_index);
+    const auto& locations = offset_index->page_locations();
+    const auto& null_pages = page_stats->null_pages();
+    if (locations.size() != null_pages.size()) continue;
+
+    const parquet::ColumnDescriptor* descr = metadata->schema()->Column(column_index);
+    parquet::RowRanges pages;
+    for (size_t page = 0; page < locations.size(); ++page) {
+      compute::Expression guarantee = compute::literal(true);
+      if (null_pages[page]) {
+        guarantee = is_null(compute::field_ref(schema_field.field->name()));
+      } else {
+        const int64_t null_count =
+            page_stats->has_null_counts() ? page_stats->null_counts()[page] : 0;
+        auto statistics = parquet::Statistics::Make(
+            descr, page_stats->encoded_min_values()[page],
+            page_stats->encoded_max_values()[page], /*num_values=*/0, null_count,
+            /*distinct_count=*/0, /*has_min_max=*/true,
+            /*has_null_count=*/page_stats->has_null_counts(),
+            /*has_distinct_count=*/false);
+        if (auto minmax = StatisticsAsExpression(schema_field.field, *statistics)) {
+          guarantee = std::move(*minmax);
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(guarantee, guarantee.Bind(*physical_schema));
+      ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                            SimplifyWithGuarantee(predicate, guarantee));
+      if (!page_predicate.IsSatisfiable()) continue;
+
+      const int64_t first_row = locations[page].first_row_index;
+      const int64_t end_row = page + 1 < locations.size()
+                                  ? locations[page + 1].first_row_index
+                                  : num_rows;
+      if (!pages.empty() && pages.back().offset + pages.back().length == first_row) {
+        pages.back().length += end_row - first_row;
+      } else {
+        pages.push_back({first_row, end_row - first_row});
+      }
+    }
+    selected = parquet::IntersectRowRanges(selected, pages);
+    if (selected.empty()) break;
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selected;
+}
+
 Result<util::optional<int64_t>> ParquetFileFragment::TryCountRows(
     compute::Expression predicate) {
   DCHECK_NE(metadata_, nullptr);
@@ -47,6 +47,8 @@ class ArrowReaderProperties;
 class WriterProperties;
 class ArrowWriterProperties;
 
+struct RowRange;
+
 namespace arrow {
 class FileReader;
 class FileWriter;
@@ -183,8 +185,25 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
 
   /// Return a filtered subset of row group indices.
   Result<std::vector<int>> FilterRowGroups(compute::Expression predicate);
+  /// Exclude the row groups whose Bloom filters show that no row can satisfy
+  /// the predicate's equality conditions.  The metadata is passed in since it
+  /// is guarded by physical_schema_mutex_.
+  Result<std::vector<int>> FilterRowGroupsByBloomFilter(
+      const compute::Expression& predicate, std::vector<int> row_groups,
+      const Schema& physical_schema, std::shared_ptr<parquet::FileMetaData> metadata,
+      const parquet::arrow::SchemaManifest& manifest);
+  /// Return the reader which Bloom filters are read through, opening it on
+  /// first use.
+  Result<std::shared_ptr<parquet::ParquetFileReader>> GetBloomFilterReader(
+      std::shared_ptr<parquet::FileMetaData> metadata);
   /// Simplify the predicate against the statistics of each row group.
   Result<std::vector<compute::Expression>> TestRowGroups(compute::Expression predicate);
+  /// Return the rows of a row group which may satisfy the predicate according to
+  /// the page indexes of the columns it references.  Columns without page
+  /// indexes don't exclude any row.
+  Result<std::vector<parquet::RowRange>> FilterPages(compute::Expression predicate,
+                                                     int row_group,
+                                                     parquet::ParquetFileReader* reader);
   /// Try to count rows matching the predicate using metadata. Expects
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
@@ -200,6 +219,8 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   std::vector<bool> statistics_expressions_complete_;
   std::shared_ptr<parquet::FileMetaData> metadata_;
   std::shared_ptr<parquet::arrow::SchemaManifest> manifest_;
+  /// Kept open so that repeated filtering doesn't reopen the source.
+  std::shared_ptr<parquet::ParquetFileReader> bloom_filter_reader_;
 
   friend class ParquetFileFormat;
   friend class ParquetDatasetFactory;
@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_primitive.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/dataset/test_util.h"
@@ -222,6 +223,97 @@ TEST_F(TestParquetFileFormat, WriteRecordBatchReaderCustomOptions) {
 
 TEST_F(TestParquetFileFormat, CountRows) { TestCountRows(); }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // The statistics of every row group include 5, so only Bloom filters can
+  // exclude row groups for equality predicates
+  auto table = TableFromJSON(schema({field("x", int64()), field("y", utf8())}),
+                             {R"([{"x": 1, "y": "a"}, {"x": 10, "y": "d"}])",
+                              R"([{"x": 2, "y": "b"}, {"x": 9, "y": "e"}])",
+                              R"([{"x": 3, "y": "c"}, {"x": 8, "y": "f"}])"});
+  auto properties = WriterProperties::Builder().enable_bloom_filter("x")->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/2,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+  auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+
+  auto selected_row_groups = [&](compute::Expression filter) {
+    SetFilter(filter);
+    std::vector<int> row_groups;
+    EXPECT_OK_AND_ASSIGN(auto fragments,
+                         parquet_fragment->SplitByRowGroup(opts_->filter));
+    for (const auto& fragment : fragments) {
+      auto row_group_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+      row_groups.push_back(row_group_fragment->row_groups()[0]);
+    }
+    return row_groups;
+  };
+
+  EXPECT_EQ(selected_row_groups(equal(field_ref("x"), literal<int64_t>(5))),
+            std::vector<int>{});
+  EXPECT_EQ(selected_row_groups(equal(field_ref("x"), literal<int64_t>(9))),
+            std::vector<int>{1});
+  EXPECT_EQ(selected_row_groups(call("is_in", {field_ref("x")},
+                                     compute::SetLookupOptions{
+                                         ArrayFromJSON(int64(), "[2, 8]")})),
+            (std::vector<int>{1, 2}));
+  EXPECT_EQ(selected_row_groups(and_(equal(field_ref("x"), literal<int64_t>(10)),
+                                     equal(field_ref("y"), literal("d")))),
+            std::vector<int>{0});
+  // "y" has no Bloom filter and its statistics include "b"
+  EXPECT_EQ(selected_row_groups(equal(field_ref("y"), literal("b"))),
+            (std::vector<int>{0, 1}));
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownPageIndex) {
+  // A single row group of sorted values, written in pages of 10 rows
+  Int64Builder builder;
+  ASSERT_OK(builder.AppendValues(internal::Iota<int64_t>(100)));
+  ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+  auto table = Table::Make(schema({field("x", int64())}), {values});
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->write_batch_size(10)
+                        ->data_pagesize(1)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/100,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  // ScanFile doesn't apply the filter itself, so whole pages are returned
+  auto num_scanned_rows = [&](compute::Expression filter) {
+    SetFilter(filter);
+    int64_t num_rows = 0;
+    EXPECT_OK_AND_ASSIGN(auto scan_tasks, format_->ScanFile(opts_, fragment));
+    for (auto maybe_task : scan_tasks) {
+      EXPECT_OK_AND_ASSIGN(auto task, maybe_task);
+      EXPECT_OK_AND_ASSIGN(auto batches, task->Execute());
+      for (auto maybe_batch : batches) {
+        EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+        num_rows += batch->num_rows();
+      }
+    }
+    return num_rows;
+  };
+
+  EXPECT_EQ(num_scanned_rows(literal(true)), 100);
+  EXPECT_EQ(num_scanned_rows(equal(field_ref("x"), literal<int64_t>(95))), 10);
+  EXPECT_EQ(num_scanned_rows(and_(greater_equal(field_ref("x"), literal<int64_t>(38)),
+                                  less(field_ref("x"), literal<int64_t>(45)))),
+            20);
+  EXPECT_EQ(num_scanned_rows(or_(less(field_ref("x"), literal<int64_t>(5)),
+                                 greater(field_ref("x"), literal<int64_t>(90)))),
+            20);
+  EXPECT_EQ(num_scanned_rows(equal(field_ref("x"), literal<int64_t>(1000))), 0);
+}
+
 TEST_F(TestParquetFileFormat, CountRowsPredicatePushdown) {
   constexpr int64_t kNumRowGroups = 16;
   constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
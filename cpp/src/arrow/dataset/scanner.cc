@@ -27,11 +27,14 @@
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/task_group.h"
@@ -1119,5 +1122,123 @@ Result<int64_t> SyncScanner::CountRows() {
   return count;
 }
 
+namespace {
+
+class ScanNode : public compute::ExecNode {
+ public:
+  ScanNode(compute::ExecPlan* plan, std::string label, std::shared_ptr<Scanner> scanner,
+           BatchDescr output_descr)
+      : ExecNode(plan, std::move(label), {}, {}, std::move(output_descr),
+                 /*num_outputs=*/1),
+        scanner_(std::move(scanner)) {}
+
+  const char* kind_name() override { return "ScanNode"; }
+
+  void InputReceived(ExecNode* input, int seq_num, compute::ExecBatch batch) override {}
+
+  void ErrorReceived(ExecNode* input, Status error) override {}
+
+  void InputFinished(ExecNode* input, int seq_stop) override {}
+
+  Status StartProducing() override {
+    ARROW_ASSIGN_OR_RAISE(auto generator, scanner_->ScanBatchesUnorderedAsync());
+    generator = MakeReadaheadGenerator(std::move(generator),
+                                       std::max(1, scanner_->options()->batch_readahead));
+
+    auto plan = this->plan()->shared_from_this();
+    Loop([plan, this, generator] { return ScanOne(generator); })
+        .AddCallback([plan, this](const Result<int>& seq_stop) {
+          if (!seq_stop.ok()) {
+            outputs_[0]->ErrorReceived(this, seq_stop.status());
+            return;
+          }
+          outputs_[0]->InputFinished(this, *seq_stop);
+        });
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (resumed_.is_finished()) {
+      resumed_ = Future<>::Make();
+    }
+  }
+
+  void ResumeProducing(ExecNode* output) override { MarkResumed(); }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    MarkResumed();
+  }
+
+ private:
+  // Request and emit the next batch, unless production is paused or stopped.
+  // Yields the number of emitted batches once the scan is exhausted.
+  Future<ControlFlow<int>> ScanOne(const EnumeratedRecordBatchGenerator& generator) {
+    Future<> resumed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) return Break(num_batches_);
+      resumed = resumed_;
+    }
+
+    return resumed.Then([generator] { return generator(); })
+        .Then([this](const EnumeratedRecordBatch& batch) -> ControlFlow<int> {
+          int seq_num;
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopped_ || IsIterationEnd(batch)) return Break(num_batches_);
+            seq_num = num_batches_++;
+          }
+          outputs_[0]->InputReceived(this, seq_num,
+                                     compute::ExecBatch(*batch.record_batch.value));
+          return Continue();
+        });
+  }
+
+  void MarkResumed() {
+    Future<> resumed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      resumed = resumed_;
+    }
+    if (!resumed.is_finished()) {
+      resumed.MarkFinished();
+    }
+  }
+
+  const std::shared_ptr<Scanner> scanner_;
+
+  std::mutex mutex_;
+  Future<> resumed_ = Future<>::MakeFinished();
+  int num_batches_ = 0;
+  bool stopped_ = false;
+};
+
+}  // namespace
+
+Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan, std::string label,
+                                        std::shared_ptr<Scanner> scanner) {
+  const auto& options = *scanner->options();
+  if (!options.use_async) {
+    return Status::NotImplemented("Scan nodes require an asynchronous scanner");
+  }
+
+  compute::ExecNode::BatchDescr output_descr;
+  for (const auto& field : options.projected_schema->fields()) {
+    output_descr.push_back(ValueDescr::Array(field->type()));
+  }
+  return plan->EmplaceNode<ScanNode>(plan, std::move(label), std::move(scanner),
+                                     std::move(output_descr));
+}
+
 }  // namespace dataset
 }  // namespace arrow
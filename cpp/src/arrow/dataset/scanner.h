@@ -25,6 +25,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/expression.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/projector.h"
@@ -426,5 +427,17 @@ ARROW_DS_EXPORT Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
     std::vector<std::shared_ptr<RecordBatch>> batches,
     std::shared_ptr<ScanOptions> options);
 
+/// \brief Make an ExecPlan source node which emits the batches of a scan.
+///
+/// Batches are pulled from Scanner::ScanBatchesUnorderedAsync, keeping up to
+/// ScanOptions::batch_readahead batches requested ahead of the downstream nodes, and
+/// are emitted as soon as they are ready rather than in dataset order.  The scan's
+/// filter and projection are applied; output columns are those of
+/// ScanOptions::projected_schema.  The scanner must be asynchronous (see
+/// ScanOptions::use_async).
+ARROW_DS_EXPORT
+Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan, std::string label,
+                                        std::shared_ptr<Scanner> scanner);
+
 }  // namespace dataset
 }  // namespace arrow
@@ -25,6 +25,8 @@
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/test_util.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
@@ -225,6 +227,31 @@ TEST_P(TestScanner, MaterializeMissingColumn) {
   AssertScanBatchesEqualRepetitionsOf(scanner, batch_with_f64);
 }
 
+TEST_P(TestScanner, ScanNode) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
+  auto scanner = MakeScanner(batch);
+
+  ASSERT_OK_AND_ASSIGN(auto plan, compute::ExecPlan::Make());
+  if (!GetParam().use_async) {
+    ASSERT_RAISES(NotImplemented, MakeScanNode(plan.get(), "scan", scanner));
+    return;
+  }
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), "scan", scanner));
+  auto sink = compute::MakeRecordBatchCollectNode(plan.get(), "sink", schema_);
+  sink->AddInput(scan);
+  ASSERT_OK(plan->Validate());
+  ASSERT_OK(plan->StartProducing());
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(sink->generator()));
+  // Batches may be scanned in any order, but they are all identical
+  ASSERT_EQ(batches.size(),
+            static_cast<size_t>(GetParam().num_child_datasets * GetParam().num_batches));
+  for (const auto& scanned : batches) {
+    AssertBatchesEqual(*batch, *scanned);
+  }
+}
+
 TEST_P(TestScanner, ToTable) {
   SetSchema({field("i32", int32()), field("f64", float64())});
   auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
@@ -57,6 +57,9 @@ class InMemoryDataset;
 class CsvFileFormat;
 struct CsvFragmentScanOptions;
 
+class JsonFileFormat;
+struct JsonFragmentScanOptions;
+
 class IpcFileFormat;
 class IpcFileWriter;
 class IpcFileWriteOptions;
@@ -236,7 +236,8 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
 }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap;
+  return use_mmap == other.use_mmap && use_io_uring == other.use_io_uring &&
+         use_direct_io == other.use_direct_io;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -394,6 +395,10 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
     const io::IOContext& io_context) {
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
+  } else if (options.use_io_uring && io::IoUringReadableFile::IsSupported()) {
+    return io::IoUringReadableFile::Open(path, io_context.pool());
+  } else if (options.use_direct_io) {
+    return io::ReadableFile::OpenDirect(path, io_context.pool());
   } else {
     return io::ReadableFile::Open(path, io_context.pool());
   }
@@ -38,6 +38,17 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// Whether OpenInputStream and OpenInputFile return a file performing
+  /// asynchronous reads using io_uring, rather than on the I/O thread pool.
+  /// Ignored if use_mmap is true, or if io_uring is not supported.
+  bool use_io_uring = false;
+
+  /// Whether OpenInputStream and OpenInputFile return a file bypassing the
+  /// page cache, so that large one-shot scans don't evict other data from it
+  /// (see io::ReadableFile::OpenDirect).  Ignored if use_mmap or use_io_uring
+  /// is true.
+  bool use_direct_io = false;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 
@@ -263,7 +263,8 @@ static void CoalescedRead(benchmark::State& st, S3FileSystem* fs,
     io::internal::ReadRangeCache cache(
         file, {},
         io::CacheOptions{/*hole_size_limit=*/8192, /*range_size_limit=*/64 * 1024 * 1024,
-                         /*lazy=*/false});
+                         /*lazy=*/false, /*adaptive=*/false,
+                         /*memory_limit=*/0});
     std::vector<io::ReadRange> ranges;
 
     int64_t offset = 0;
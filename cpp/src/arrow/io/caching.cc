@@ -19,6 +19,9 @@
 #include <atomic>
 #include <cmath>
 #include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -28,6 +31,7 @@
 #include "arrow/result.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stopwatch.h"
 
 namespace arrow {
 namespace io {
@@ -35,15 +39,38 @@ namespace io {
 CacheOptions CacheOptions::Defaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
                       internal::ReadRangeCache::kDefaultRangeSizeLimit,
-                      /*lazy=*/false};
+                      /*lazy=*/false, /*adaptive=*/false, /*memory_limit=*/0};
 }
 
 CacheOptions CacheOptions::LazyDefaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
                       internal::ReadRangeCache::kDefaultRangeSizeLimit,
-                      /*lazy=*/true};
+                      /*lazy=*/true, /*adaptive=*/false, /*memory_limit=*/0};
 }
 
+namespace {
+
+// See MakeFromNetworkMetrics() below for the rationale
+void ComputeCoalescingLimits(double time_to_first_byte_sec,
+                             double transfer_bandwidth_bytes_per_sec,
+                             double ideal_bandwidth_utilization_frac,
+                             int64_t max_ideal_request_size_bytes,
+                             int64_t* hole_size_limit, int64_t* range_size_limit) {
+  // hole_size_limit = TTFB * BW
+  *hole_size_limit = static_cast<int64_t>(
+      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+
+  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
+  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
+  *range_size_limit =
+      std::min(max_ideal_request_size_bytes,
+               static_cast<int64_t>(
+                   std::round(*hole_size_limit * ideal_bandwidth_utilization_frac /
+                              (1 - ideal_bandwidth_utilization_frac))));
+}
+
+}  // namespace
+
 CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_millis,
                                                   int64_t transfer_bandwidth_mib_per_sec,
                                                   double ideal_bandwidth_utilization_frac,
@@ -112,28 +139,132 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       transfer_bandwidth_mib_per_sec * 1024 * 1024;
   const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
 
-  // hole_size_limit = TTFB * BW
-  const auto hole_size_limit = static_cast<int64_t>(
-      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+  int64_t hole_size_limit, range_size_limit;
+  ComputeCoalescingLimits(time_to_first_byte_sec,
+                          static_cast<double>(transfer_bandwidth_bytes_per_sec),
+                          ideal_bandwidth_utilization_frac, max_ideal_request_size_bytes,
+                          &hole_size_limit, &range_size_limit);
   DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
-
-  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
-  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
-  const int64_t range_size_limit = std::min(
-      max_ideal_request_size_bytes,
-      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
-                                      (1 - ideal_bandwidth_utilization_frac))));
   DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
 
-  return {hole_size_limit, range_size_limit, false};
+  return {hole_size_limit, range_size_limit, /*lazy=*/false, /*adaptive=*/false,
+          /*memory_limit=*/0};
 }
 
 namespace internal {
 
+namespace {
+
+// Weight of the previous reads relative to a new one
+constexpr double kReadMetricsDecay = 1.0 - 1.0 / 64;
+// Bounds of the estimates, which also guard against measurement noise
+constexpr double kMaxBandwidthBytesPerSec = 64.0 * 1024 * 1024 * 1024;
+constexpr double kMinTimeToFirstByteSec = 1e-6;
+
+}  // namespace
+
+struct ReadMetrics::Impl {
+  mutable std::mutex mutex;
+  int64_t num_reads = 0;
+  // Exponentially weighted sums over the recorded reads
+  double sum_weights = 0;
+  double sum_sizes = 0;
+  double sum_durations = 0;
+  double sum_squared_sizes = 0;
+  double sum_products = 0;
+};
+
+constexpr int64_t ReadMetrics::kMinReads;
+
+ReadMetrics::ReadMetrics() : impl_(new Impl()) {}
+
+ReadMetrics::~ReadMetrics() = default;
+
+std::shared_ptr<ReadMetrics> ReadMetrics::ForFile(const RandomAccessFile& file) {
+  static std::mutex mutex;
+  static std::unordered_map<std::type_index, std::shared_ptr<ReadMetrics>> registry;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& metrics = registry[std::type_index(typeid(file))];
+  if (metrics == nullptr) {
+    metrics = std::make_shared<ReadMetrics>();
+  }
+  return metrics;
+}
+
+void ReadMetrics::Record(int64_t nbytes, double seconds) {
+  if (nbytes <= 0 || seconds < 0) {
+    return;
+  }
+  const auto size = static_cast<double>(nbytes);
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  ++impl_->num_reads;
+  impl_->sum_weights = impl_->sum_weights * kReadMetricsDecay + 1;
+  impl_->sum_sizes = impl_->sum_sizes * kReadMetricsDecay + size;
+  impl_->sum_durations = impl_->sum_durations * kReadMetricsDecay + seconds;
+  impl_->sum_squared_sizes = impl_->sum_squared_sizes * kReadMetricsDecay + size * size;
+  impl_->sum_products = impl_->sum_products * kReadMetricsDecay + size * seconds;
+}
+
+void ReadMetrics::Reset() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->num_reads = 0;
+  impl_->sum_weights = impl_->sum_sizes = impl_->sum_durations = 0;
+  impl_->sum_squared_sizes = impl_->sum_products = 0;
+}
+
+bool ReadMetrics::GetEstimates(double* time_to_first_byte_sec,
+                               double* bandwidth_bytes_per_sec) const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  if (impl_->num_reads < kMinReads) {
+    return false;
+  }
+  const double mean_size = impl_->sum_sizes / impl_->sum_weights;
+  const double mean_duration = impl_->sum_durations / impl_->sum_weights;
+  const double size_variance =
+      impl_->sum_squared_sizes / impl_->sum_weights - mean_size * mean_size;
+  const double covariance =
+      impl_->sum_products / impl_->sum_weights - mean_size * mean_duration;
+  // With (nearly) identical read sizes, latency can't be told apart from bandwidth
+  if (size_variance <= 1e-4 * mean_size * mean_size) {
+    return false;
+  }
+  // Linear regression of durations on sizes: the slope is the transfer time
+  // per byte, the intercept is the time to first byte
+  const double seconds_per_byte =
+      std::max(covariance / size_variance, 1.0 / kMaxBandwidthBytesPerSec);
+  *bandwidth_bytes_per_sec = 1.0 / seconds_per_byte;
+  *time_to_first_byte_sec =
+      std::max(mean_duration - seconds_per_byte * mean_size, kMinTimeToFirstByteSec);
+  return true;
+}
+
+CacheOptions ReadMetrics::Adapt(const CacheOptions& options) const {
+  double time_to_first_byte_sec, bandwidth_bytes_per_sec;
+  if (!GetEstimates(&time_to_first_byte_sec, &bandwidth_bytes_per_sec)) {
+    return options;
+  }
+  CacheOptions adapted = options;
+  ComputeCoalescingLimits(time_to_first_byte_sec, bandwidth_bytes_per_sec,
+                          CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+                          CacheOptions::kDefaultMaxIdealRequestSizeMib * 1024 * 1024,
+                          &adapted.hole_size_limit, &adapted.range_size_limit);
+  // CoalesceReadRanges() requires hole_size_limit < range_size_limit
+  adapted.range_size_limit = std::max<int64_t>(adapted.range_size_limit, 2);
+  adapted.hole_size_limit = std::min(std::max<int64_t>(adapted.hole_size_limit, 1),
+                                     adapted.range_size_limit - 1);
+  return adapted;
+}
+
 struct RangeCacheEntry {
   ReadRange range;
   Future<std::shared_ptr<Buffer>> future;
 
+  // Only used with a memory limit: the number of bytes of the cached ranges
+  // which were not read yet, and whether the future was dropped
+  int64_t unread_bytes = 0;
+  bool released = false;
+
   RangeCacheEntry() = default;
   RangeCacheEntry(const ReadRange& range_, Future<std::shared_ptr<Buffer>> future_)
       : range(range_), future(std::move(future_)) {}
@@ -147,6 +278,8 @@ struct ReadRangeCache::Impl {
   std::shared_ptr<RandomAccessFile> file;
   IOContext ctx;
   CacheOptions options;
+  // Non-null if options.adaptive
+  std::shared_ptr<ReadMetrics> metrics;
 
   // Ordered by offset (so as to find a matching region by binary search)
   std::vector<RangeCacheEntry> entries;
@@ -158,23 +291,60 @@ struct ReadRangeCache::Impl {
     return entry->future;
   }
 
+  // Start reading a range.  With metrics, the read is timed on the IO thread
+  // from when it actually starts, so that time spent waiting for the executor
+  // or for other reads isn't counted as time to first byte.
+  Future<std::shared_ptr<Buffer>> StartRead(const ReadRange& range) {
+    if (metrics == nullptr) {
+      return file->ReadAsync(ctx, range.offset, range.length);
+    }
+    auto read_file = file;
+    auto read_metrics = metrics;
+    return DeferNotOk(internal::SubmitIO(
+        ctx, [read_file, read_metrics, range]() -> Result<std::shared_ptr<Buffer>> {
+          ::arrow::internal::StopWatch watch;
+          watch.Start();
+          ARROW_ASSIGN_OR_RAISE(auto buffer,
+                                read_file->ReadAt(range.offset, range.length));
+          read_metrics->Record(range.length, static_cast<double>(watch.Stop()) * 1e-9);
+          return buffer;
+        }));
+  }
+
+  // Start reading ranges, as a batch if they aren't timed
+  std::vector<Future<std::shared_ptr<Buffer>>> StartReads(
+      const std::vector<ReadRange>& ranges) {
+    if (metrics == nullptr) {
+      return file->ReadManyAsync(ctx, ranges);
+    }
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      futures.push_back(StartRead(range));
+    }
+    return futures;
+  }
+
   // Make cache entries for ranges
   virtual std::vector<RangeCacheEntry> MakeCacheEntries(
       const std::vector<ReadRange>& ranges) {
+    auto futures = StartReads(ranges);
     std::vector<RangeCacheEntry> new_entries;
     new_entries.reserve(ranges.size());
-    for (const auto& range : ranges) {
-      new_entries.emplace_back(range, file->ReadAsync(ctx, range.offset, range.length));
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      new_entries.emplace_back(ranges[i], std::move(futures[i]));
     }
     return new_entries;
   }
 
-  // Add the given ranges to the cache, coalescing them where possible
-  virtual Status Cache(std::vector<ReadRange> ranges) {
-    ranges = internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
-                                          options.range_size_limit);
-    std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(ranges);
-    // Add new entries, themselves ordered by offset
+  std::vector<ReadRange> Coalesce(std::vector<ReadRange> ranges) const {
+    const CacheOptions limits = metrics ? metrics->Adapt(options) : options;
+    return internal::CoalesceReadRanges(std::move(ranges), limits.hole_size_limit,
+                                        limits.range_size_limit);
+  }
+
+  // Add new entries, themselves ordered by offset
+  void AddEntries(std::vector<RangeCacheEntry> new_entries) {
     if (entries.size() > 0) {
       std::vector<RangeCacheEntry> merged(entries.size() + new_entries.size());
       std::merge(entries.begin(), entries.end(), new_entries.begin(), new_entries.end(),
@@ -183,6 +353,25 @@ struct ReadRangeCache::Impl {
     } else {
       entries = std::move(new_entries);
     }
+  }
+
+  // Find the entry containing the given range, or entries.end()
+  std::vector<RangeCacheEntry>::iterator FindEntry(const ReadRange& range) {
+    const auto it = std::lower_bound(
+        entries.begin(), entries.end(), range,
+        [](const RangeCacheEntry& entry, const ReadRange& range) {
+          return entry.range.offset + entry.range.length < range.offset + range.length;
+        });
+    if (it != entries.end() && it->range.Contains(range)) {
+      return it;
+    }
+    return entries.end();
+  }
+
+  // Add the given ranges to the cache, coalescing them where possible
+  virtual Status Cache(std::vector<ReadRange> ranges) {
+    ranges = Coalesce(std::move(ranges));
+    AddEntries(MakeCacheEntries(ranges));
     // Prefetch immediately, regardless of executor availability, if possible
     return file->WillNeed(ranges);
   }
@@ -195,12 +384,8 @@ struct ReadRangeCache::Impl {
       return std::make_shared<Buffer>(&byte, 0);
     }
 
-    const auto it = std::lower_bound(
-        entries.begin(), entries.end(), range,
-        [](const RangeCacheEntry& entry, const ReadRange& range) {
-          return entry.range.offset + entry.range.length < range.offset + range.length;
-        });
-    if (it != entries.end() && it->range.Contains(range)) {
+    const auto it = FindEntry(range);
+    if (it != entries.end()) {
       auto fut = MaybeRead(&*it);
       ARROW_ASSIGN_OR_RAISE(auto buf, fut.result());
       return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
@@ -224,12 +409,8 @@ struct ReadRangeCache::Impl {
     std::vector<Future<>> futures;
     futures.reserve(ranges.size());
     for (auto& range : ranges) {
-      const auto it = std::lower_bound(
-          entries.begin(), entries.end(), range,
-          [](const RangeCacheEntry& entry, const ReadRange& range) {
-            return entry.range.offset + entry.range.length < range.offset + range.length;
-          });
-      if (it != entries.end() && it->range.Contains(range)) {
+      const auto it = FindEntry(range);
+      if (it != entries.end()) {
         futures.push_back(Future<>(MaybeRead(&*it)));
       } else {
         return Status::Invalid("Range was not requested for caching: offset=",
@@ -251,7 +432,7 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
     // Called by superclass Read()/WaitFor() so we have the lock
     if (!entry->future.is_valid()) {
-      entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+      entry->future = StartRead(entry->range);
     }
     return entry->future;
   }
@@ -289,12 +470,167 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   }
 };
 
+// Read ahead of the consumer within a memory budget, and drop entries once all the
+// ranges they cover have been read.
+struct ReadRangeCache::BoundedImpl : public ReadRangeCache::Impl {
+  // Protect against concurrent modification of entries and held_bytes
+  std::mutex entry_mutex;
+  // Total size of the entries being read or held
+  int64_t held_bytes = 0;
+
+  virtual ~BoundedImpl() = default;
+
+  Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
+    // Called with the lock held
+    if (!entry->future.is_valid()) {
+      entry->future = StartRead(entry->range);
+      held_bytes += entry->range.length;
+    }
+    return entry->future;
+  }
+
+  std::vector<RangeCacheEntry> MakeCacheEntries(
+      const std::vector<ReadRange>& ranges) override {
+    std::vector<RangeCacheEntry> new_entries;
+    new_entries.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      // Entries are read by ReadAhead() or, failing that, when requested
+      new_entries.emplace_back(range, Future<std::shared_ptr<Buffer>>());
+    }
+    return new_entries;
+  }
+
+  // Start reading the first entries not read yet, as far as the memory limit
+  // allows.  At least one entry is read if nothing is held, so that progress is
+  // made whatever the limit.  Called with the lock held.
+  void ReadAhead() {
+    if (options.lazy) return;
+    std::vector<RangeCacheEntry*> to_read;
+    std::vector<ReadRange> ranges;
+    int64_t new_held_bytes = held_bytes;
+    for (auto& entry : entries) {
+      if (entry.released || entry.future.is_valid()) continue;
+      if (new_held_bytes > 0 &&
+          new_held_bytes + entry.range.length > options.memory_limit) {
+        break;
+      }
+      new_held_bytes += entry.range.length;
+      to_read.push_back(&entry);
+      ranges.push_back(entry.range);
+    }
+    if (to_read.empty()) return;
+
+    auto futures = StartReads(ranges);
+    for (size_t i = 0; i < to_read.size(); ++i) {
+      to_read[i]->future = std::move(futures[i]);
+    }
+    held_bytes = new_held_bytes;
+  }
+
+  Status Cache(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(Coalesce(ranges));
+    // Count the bytes to be read from each new entry (ranges of zero size are
+    // never read from the cache)
+    for (const auto& range : ranges) {
+      if (range.length == 0) continue;
+      const auto it = std::lower_bound(
+          new_entries.begin(), new_entries.end(), range,
+          [](const RangeCacheEntry& entry, const ReadRange& range) {
+            return entry.range.offset + entry.range.length < range.offset + range.length;
+          });
+      DCHECK(it != new_entries.end() && it->range.Contains(range));
+      it->unread_bytes += range.length;
+    }
+    AddEntries(std::move(new_entries));
+    // Unlike the unbounded cache, don't call WillNeed() on all ranges:
+    // that would prefetch them regardless of the memory limit
+    ReadAhead();
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(ReadRange range) override {
+    if (range.length == 0) {
+      return ReadRangeCache::Impl::Read(range);
+    }
+
+    Future<std::shared_ptr<Buffer>> fut;
+    int64_t entry_offset;
+    {
+      std::unique_lock<std::mutex> guard(entry_mutex);
+      const auto it = FindEntry(range);
+      if (it == entries.end()) {
+        return Status::Invalid("ReadRangeCache did not find matching cache entry");
+      }
+      if (!it->released) {
+        fut = MaybeRead(&*it);
+        entry_offset = it->range.offset;
+      }
+    }
+    if (!fut.is_valid()) {
+      // The entry was dropped already, read the range again
+      return file->ReadAt(range.offset, range.length);
+    }
+
+    // Don't hold the lock while waiting, so that other ranges can be read
+    ARROW_ASSIGN_OR_RAISE(auto buf, fut.result());
+    {
+      std::unique_lock<std::mutex> guard(entry_mutex);
+      // Entries may have been moved around by Cache() in the meantime
+      const auto it = FindEntry(range);
+      DCHECK(it != entries.end());
+      it->unread_bytes -= range.length;
+      if (it->unread_bytes <= 0 && !it->released) {
+        it->released = true;
+        it->future = Future<std::shared_ptr<Buffer>>();
+        held_bytes -= it->range.length;
+        ReadAhead();
+      }
+    }
+    return SliceBuffer(std::move(buf), range.offset - entry_offset, range.length);
+  }
+
+  Future<> Wait() override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    std::vector<Future<>> futures;
+    for (const auto& entry : entries) {
+      if (entry.future.is_valid()) {
+        futures.emplace_back(entry.future);
+      }
+    }
+    return AllComplete(futures);
+  }
+
+  Future<> WaitFor(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    std::vector<Future<>> futures;
+    for (const auto& range : ranges) {
+      if (range.length == 0) continue;
+      const auto it = FindEntry(range);
+      if (it == entries.end()) {
+        return Status::Invalid("Range was not requested for caching: offset=",
+                               range.offset, " length=", range.length);
+      }
+      // Dropped entries will be read again by Read()
+      if (!it->released) {
+        futures.push_back(Future<>(MaybeRead(&*it)));
+      }
+    }
+    return AllComplete(futures);
+  }
+};
+
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, IOContext ctx,
                                CacheOptions options)
-    : impl_(options.lazy ? new LazyImpl() : new Impl()) {
+    : impl_(options.memory_limit > 0
+                ? new BoundedImpl()
+                : options.lazy ? new LazyImpl() : new Impl()) {
   impl_->file = std::move(file);
   impl_->ctx = std::move(ctx);
   impl_->options = options;
+  if (options.adaptive) {
+    impl_->metrics = ReadMetrics::ForFile(*impl_->file);
+  }
 }
 
 ReadRangeCache::~ReadRangeCache() = default;
@@ -43,10 +43,25 @@ struct ARROW_EXPORT CacheOptions {
   int64_t range_size_limit;
   /// \brief A lazy cache does not perform any I/O until requested.
   bool lazy;
+  /// \brief An adaptive cache derives hole_size_limit and range_size_limit
+  ///   from the latency and bandwidth measured on previous reads of the same
+  ///   kind of file (see internal::ReadMetrics).  The configured limits are
+  ///   used until enough reads have been measured.  So that each read can be
+  ///   timed from when it starts, an adaptive cache reads every range with
+  ///   RandomAccessFile::ReadAt() on the IO context's executor, as the default
+  ///   RandomAccessFile::ReadAsync() does.
+  bool adaptive;
+  /// \brief The maximum number of bytes a cache holds at once, or 0 for no limit.
+  ///
+  /// With a limit, ranges are read ahead in offset order only as far as the
+  /// limit allows (not at all for a lazy cache), and a combined range is
+  /// dropped from the cache once all the ranges it covers have been read.
+  int64_t memory_limit;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
-           range_size_limit == other.range_size_limit && lazy == other.lazy;
+           range_size_limit == other.range_size_limit && lazy == other.lazy &&
+           adaptive == other.adaptive && memory_limit == other.memory_limit;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -74,6 +89,50 @@ struct ARROW_EXPORT CacheOptions {
 
 namespace internal {
 
+/// \brief Online estimates of the time-to-first-byte and bandwidth of a
+/// storage system, measured from completed reads.
+///
+/// Read durations are fitted to the model
+/// `duration = time_to_first_byte + nbytes / bandwidth` by least squares,
+/// with exponentially decaying weights so that the estimates follow changes
+/// in the behaviour of the storage.  This class is thread-safe.
+class ARROW_EXPORT ReadMetrics {
+ public:
+  ReadMetrics();
+  ~ReadMetrics();
+
+  /// \brief The metrics shared by all files of the same concrete type
+  ///
+  /// The type of a RandomAccessFile generally identifies the filesystem it was
+  /// opened from (local, S3, HDFS...).
+  static std::shared_ptr<ReadMetrics> ForFile(const RandomAccessFile& file);
+
+  /// \brief Record a completed read of `nbytes` bytes which took `seconds`
+  void Record(int64_t nbytes, double seconds);
+
+  /// \brief Forget all recorded reads
+  void Reset();
+
+  /// \brief Get the current estimates
+  ///
+  /// Return false if not enough reads of different sizes were recorded to
+  /// tell latency apart from bandwidth.
+  bool GetEstimates(double* time_to_first_byte_sec,
+                    double* bandwidth_bytes_per_sec) const;
+
+  /// \brief Return `options` with coalescing limits derived from the current
+  /// estimates as in CacheOptions::MakeFromNetworkMetrics, or `options`
+  /// unchanged if no estimates are available
+  CacheOptions Adapt(const CacheOptions& options) const;
+
+  /// The number of reads required before producing estimates
+  static constexpr int64_t kMinReads = 8;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \brief A read cache designed to hide IO latencies when reading.
 ///
 /// This class takes multiple byte ranges that an application expects to read, and
@@ -118,9 +177,14 @@ class ARROW_EXPORT ReadRangeCache {
   Status Cache(std::vector<ReadRange> ranges);
 
   /// \brief Read a range previously given to Cache().
+  ///
+  /// With a memory limit, reading a range again after its combined range was
+  /// dropped issues a new read from the file.
   Result<std::shared_ptr<Buffer>> Read(ReadRange range);
 
   /// \brief Wait until all ranges added so far have been cached.
+  ///
+  /// With a memory limit, only wait for the ranges currently being read ahead.
   Future<> Wait();
 
   /// \brief Wait until all given ranges have been cached.
@@ -129,6 +193,7 @@ class ARROW_EXPORT ReadRangeCache {
  protected:
   struct Impl;
   struct LazyImpl;
+  struct BoundedImpl;
 
   std::unique_ptr<Impl> impl_;
 };
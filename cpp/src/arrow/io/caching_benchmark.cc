@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/buffer.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/slow.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
+
+namespace arrow {
+namespace io {
+
+namespace {
+
+constexpr int64_t kFileSize = 64 * 1024 * 1024;
+constexpr int64_t kNumRanges = 128;
+
+// A SlowRandomAccessFile whose reads additionally take time proportional to
+// their size, so as to emulate storage with a given latency and bandwidth.
+// Note the bandwidth applies to each read separately, not to the file as a whole.
+class EmulatedStorageFile : public SlowRandomAccessFile {
+ public:
+  EmulatedStorageFile(std::shared_ptr<RandomAccessFile> file,
+                      double time_to_first_byte_sec, double bandwidth_bytes_per_sec)
+      : SlowRandomAccessFile(std::move(file), time_to_first_byte_sec, /*seed=*/42),
+        bandwidth_bytes_per_sec_(bandwidth_bytes_per_sec) {}
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    SleepFor(nbytes / bandwidth_bytes_per_sec_);
+    return SlowRandomAccessFile::ReadAt(position, nbytes, out);
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    SleepFor(nbytes / bandwidth_bytes_per_sec_);
+    return SlowRandomAccessFile::ReadAt(position, nbytes);
+  }
+
+ private:
+  double bandwidth_bytes_per_sec_;
+};
+
+// Small ranges of varying sizes separated by holes, as when reading a few
+// columns out of a file
+std::vector<ReadRange> MakeRanges(int64_t range_size, int64_t hole_size,
+                                  int64_t* total_size) {
+  std::vector<ReadRange> ranges;
+  int64_t offset = 0;
+  *total_size = 0;
+  for (int64_t i = 0; i < kNumRanges; ++i) {
+    const int64_t length = range_size * (1 + i % 4);
+    ranges.push_back({offset, length});
+    offset += length + hole_size;
+    *total_size += length;
+  }
+  return ranges;
+}
+
+void CacheRanges(benchmark::State& state, double time_to_first_byte_sec,
+                 double bandwidth_bytes_per_sec, bool adaptive) {
+  const int64_t range_size = state.range(0);
+  const int64_t hole_size = state.range(1);
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, AllocateBuffer(kFileSize));
+  memset(buffer->mutable_data(), 0, kFileSize);
+  auto file = std::make_shared<EmulatedStorageFile>(
+      std::make_shared<BufferReader>(std::move(buffer)), time_to_first_byte_sec,
+      bandwidth_bytes_per_sec);
+  // Start from scratch, measuring reads as the benchmark goes
+  internal::ReadMetrics::ForFile(*file)->Reset();
+
+  CacheOptions options = CacheOptions::Defaults();
+  options.adaptive = adaptive;
+  int64_t total_size;
+  const auto ranges = MakeRanges(range_size, hole_size, &total_size);
+
+  for (auto _ : state) {
+    internal::ReadRangeCache cache(file, {}, options);
+    ABORT_NOT_OK(cache.Cache(ranges));
+    ABORT_NOT_OK(cache.Wait().status());
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+}
+
+// Local SSD: 0.1 ms latency, 2 GiB/s
+void LocalFixed(benchmark::State& state) {
+  CacheRanges(state, 1e-4, 2048.0 * 1024 * 1024, false);
+}
+void LocalAdaptive(benchmark::State& state) {
+  CacheRanges(state, 1e-4, 2048.0 * 1024 * 1024, true);
+}
+
+// HDFS-like: 2 ms latency, 500 MiB/s
+void HdfsFixed(benchmark::State& state) {
+  CacheRanges(state, 2e-3, 500.0 * 1024 * 1024, false);
+}
+void HdfsAdaptive(benchmark::State& state) {
+  CacheRanges(state, 2e-3, 500.0 * 1024 * 1024, true);
+}
+
+// S3-like: 20 ms latency, 100 MiB/s
+void S3Fixed(benchmark::State& state) {
+  CacheRanges(state, 2e-2, 100.0 * 1024 * 1024, false);
+}
+void S3Adaptive(benchmark::State& state) {
+  CacheRanges(state, 2e-2, 100.0 * 1024 * 1024, true);
+}
+
+void SetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"range_size", "hole_size"});
+  for (const int64_t range_size : {4096, 65536}) {
+    for (const int64_t hole_size : {16384, 131072}) {
+      bench->Args({range_size, hole_size});
+    }
+  }
+  bench->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK(LocalFixed)->Apply(SetArgs);
+BENCHMARK(LocalAdaptive)->Apply(SetArgs);
+BENCHMARK(HdfsFixed)->Apply(SetArgs);
+BENCHMARK(HdfsAdaptive)->Apply(SetArgs);
+BENCHMARK(S3Fixed)->Apply(SetArgs);
+BENCHMARK(S3Adaptive)->Apply(SetArgs);
+
+}  // namespace io
+}  // namespace arrow
@@ -31,16 +31,32 @@
 #include <unistd.h>  // IWYU pragma: keep
 #endif
 
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define ARROW_HAVE_IO_URING
+#endif
+#endif
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -52,9 +68,11 @@
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -236,6 +254,13 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
+// Direct I/O requires file offsets, lengths and memory addresses to be
+// multiples of the logical block size of the underlying device, which is
+// at most 4096 bytes in practice.
+constexpr int64_t kDirectIOAlignment = 4096;
+// Largest read issued at once in direct I/O mode
+constexpr int64_t kDirectIOMaxChunkSize = int64_t(1) << 30;
+
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
@@ -243,7 +268,47 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  // Bypass the page cache if the file system allows it
+  Status EnableDirectIO() {
+#if defined(O_DIRECT)
+    int flags = fcntl(fd_, F_GETFL);
+    if (flags == -1) {
+      return IOErrorFromErrno(errno, "fcntl(fd, F_GETFL) failed");
+    }
+    // EINVAL means that the file system doesn't support direct I/O
+    if (fcntl(fd_, F_SETFL, flags | O_DIRECT) == 0) {
+      direct_io_ = true;
+    } else if (errno != EINVAL) {
+      return IOErrorFromErrno(errno, "fcntl(fd, F_SETFL, O_DIRECT) failed");
+    }
+#endif
+    return Status::OK();
+  }
+
+  bool direct_io() const { return direct_io_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (!direct_io_) {
+      return OSFile::Read(nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadBuffer(nbytes));
+    memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (!direct_io_) {
+      return OSFile::ReadAt(position, nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadBufferAt(position, nbytes));
+    memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    if (direct_io_) {
+      return DirectReadBuffer(nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
@@ -255,6 +320,9 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (direct_io_) {
+      return DirectReadBufferAt(position, nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -270,6 +338,8 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     RETURN_NOT_OK(CheckClosed());
     for (const auto& range : ranges) {
       RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+      // Prefetching would populate the page cache, which direct I/O avoids
+      if (direct_io_) continue;
 #if defined(POSIX_FADV_WILLNEED)
       if (posix_fadvise(fd_, range.offset, range.length, POSIX_FADV_WILLNEED)) {
         return IOErrorFromErrno(errno, "posix_fadvise failed");
@@ -288,7 +358,59 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
  private:
+  Result<std::shared_ptr<Buffer>> DirectReadBuffer(int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPositioned());
+    ARROW_ASSIGN_OR_RAISE(int64_t position, Tell());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadBufferAt(position, nbytes));
+    RETURN_NOT_OK(Seek(position + buffer->size()));
+    return buffer;
+  }
+
+  // Read the aligned blocks spanning the given range into an aligned buffer,
+  // and return a slice of it
+  Result<std::shared_ptr<Buffer>> DirectReadBufferAt(int64_t position, int64_t nbytes) {
+#ifdef _WIN32
+    return Status::NotImplemented("Direct I/O on Windows");
+#else
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    const int64_t start = position - position % kDirectIOAlignment;
+    const int64_t end = BitUtil::RoundUp(position + nbytes, kDirectIOAlignment);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(end - start + kDirectIOAlignment, pool_));
+    const int64_t padding =
+        BitUtil::RoundUp(reinterpret_cast<uintptr_t>(buffer->data()),
+                         kDirectIOAlignment) -
+        reinterpret_cast<uintptr_t>(buffer->data());
+    uint8_t* data = buffer->mutable_data() + padding;
+
+    need_seeking_.store(true);
+    int64_t bytes_read = 0;
+    while (start + bytes_read < end) {
+      const int64_t chunk_size =
+          std::min(kDirectIOMaxChunkSize, end - start - bytes_read);
+      const int64_t ret = static_cast<int64_t>(
+          pread(fd_, data + bytes_read, static_cast<size_t>(chunk_size),
+                static_cast<off_t>(start + bytes_read)));
+      if (ret == -1) {
+        if (errno == EINTR) continue;
+        return IOErrorFromErrno(errno, "Error reading bytes from file");
+      }
+      bytes_read += ret;
+      if (ret < chunk_size) {
+        // EOF
+        break;
+      }
+    }
+    const int64_t offset = position - start;
+    const int64_t length = std::max<int64_t>(0, std::min(bytes_read - offset, nbytes));
+    return SliceBuffer(std::move(buffer), padding + offset, length);
+#endif
+  }
+
   MemoryPool* pool_;
+  bool direct_io_ = false;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -308,6 +430,14 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* poo
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::OpenDirect(const std::string& path,
+                                                               MemoryPool* pool) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path));
+  RETURN_NOT_OK(file->impl_->EnableDirectIO());
+  return file;
+}
+
 Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
@@ -340,6 +470,566 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+bool ReadableFile::direct_io() const { return impl_->direct_io(); }
+
+// ----------------------------------------------------------------------
+// IoUringReadableFile implementation
+
+namespace {
+
+// Tracks the asynchronous reads of a file which have not completed yet, so
+// that the file descriptor isn't closed under the kernel's feet.
+class PendingReads {
+ public:
+  void Add(int64_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    count_ += count;
+  }
+
+  void Done() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--count_ == 0) {
+      cv_.notify_all();
+    }
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return count_ == 0; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int64_t count_ = 0;
+};
+
+#ifdef ARROW_HAVE_IO_URING
+
+struct IoUringRead {
+  int fd;
+  int64_t position;
+  int64_t nbytes;
+  int64_t bytes_read;
+  struct iovec iov;
+  std::shared_ptr<ResizableBuffer> buffer;
+  Future<std::shared_ptr<Buffer>> future;
+  PendingReads* pending;
+};
+
+// A process-wide io_uring instance, with a thread reaping completions.
+//
+// The rings are accessed directly rather than through liburing, as only
+// vectored reads and no-ops are submitted.
+class IoUring {
+ public:
+  static Result<IoUring*> GetInstance() {
+    static auto instance = Make();
+    if (!instance.ok()) {
+      return instance.status();
+    }
+    return instance->get();
+  }
+
+  ~IoUring() {
+    if (reaper_.joinable()) {
+      // Wake up the reaper with a no-op whose user_data is null, unless it
+      // already exited because the ring broke
+      Status st;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (broken_status_.ok()) {
+          io_uring_sqe* sqe = NextSqe();
+          sqe->opcode = IORING_OP_NOP;
+          CommitSqes(1);
+          st = Enter(1);
+        }
+      }
+      if (st.ok()) {
+        reaper_.join();
+      } else {
+        ARROW_LOG(WARNING) << "Failed stopping io_uring reaper: " << st.ToString();
+        reaper_.detach();
+      }
+    }
+    if (sqes_ != nullptr) munmap(sqes_, sqes_size_);
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+    if (sq_ring_ != nullptr) munmap(sq_ring_, sq_ring_size_);
+    if (ring_fd_ >= 0) close(ring_fd_);
+  }
+
+  // Submit reads to the kernel, in batches as large as the rings allow.
+  // Reads which don't fit in the completion queue are queued and submitted by
+  // the reaper as earlier reads complete, so this doesn't block.
+  void Submit(std::vector<std::unique_ptr<IoUringRead>> reads) {
+    std::vector<IoUringRead*> failed;
+    Status st;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto& read : reads) {
+        queued_.push_back(read.release());
+      }
+      if (broken_status_.ok()) {
+        st = SubmitQueued(&failed);
+      } else {
+        st = broken_status_;
+        failed.assign(queued_.begin(), queued_.end());
+        queued_.clear();
+      }
+    }
+    for (IoUringRead* read : failed) {
+      Finish(read, st);
+    }
+  }
+
+ private:
+  IoUring() = default;
+
+  static Result<std::unique_ptr<IoUring>> Make() {
+    std::unique_ptr<IoUring> ring(new IoUring());
+    RETURN_NOT_OK(ring->Init());
+    IoUring* self = ring.get();
+    ring->reaper_ = std::thread([self] { self->ReapCompletions(); });
+    return std::move(ring);
+  }
+
+  Status Init() {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kQueueDepth, &params));
+    if (ring_fd_ < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    sq_entries_ = params.sq_entries;
+    cq_entries_ = params.cq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    ARROW_ASSIGN_OR_RAISE(sq_ring_, MapRing(sq_ring_size_, IORING_OFF_SQ_RING));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(cq_ring_, MapRing(cq_ring_size_, IORING_OFF_CQ_RING));
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    ARROW_ASSIGN_OR_RAISE(void* sqes, MapRing(sqes_size_, IORING_OFF_SQES));
+    sqes_ = reinterpret_cast<io_uring_sqe*>(sqes);
+
+    auto sq_ptr = reinterpret_cast<uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_ptr + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq_ptr + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq_ptr + params.sq_off.array);
+    sq_tail_value_ = *sq_tail_;
+
+    auto cq_ptr = reinterpret_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq_ptr + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_ptr + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq_ptr + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ptr + params.cq_off.cqes);
+    return Status::OK();
+  }
+
+  Result<void*> MapRing(size_t size, off_t offset) {
+    void* ptr =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+             offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "mmap of io_uring ring failed");
+    }
+    return ptr;
+  }
+
+  // The following methods must be called with mutex_ locked
+
+  io_uring_sqe* NextSqe() {
+    const unsigned index = (sq_tail_value_ + pending_sqes_) & sq_mask_;
+    ++pending_sqes_;
+    io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    return sqe;
+  }
+
+  void PushRead(IoUringRead* read) {
+    io_uring_sqe* sqe = NextSqe();
+    read->iov.iov_base = read->buffer->mutable_data() + read->bytes_read;
+    read->iov.iov_len = static_cast<size_t>(read->nbytes - read->bytes_read);
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = read->fd;
+    sqe->off = static_cast<uint64_t>(read->position + read->bytes_read);
+    sqe->addr = reinterpret_cast<uint64_t>(&read->iov);
+    sqe->len = 1;
+    sqe->user_data = reinterpret_cast<uint64_t>(read);
+  }
+
+  // Make the SQEs filled by NextSqe() visible to the kernel
+  void CommitSqes(unsigned count) {
+    DCHECK_EQ(count, pending_sqes_);
+    sq_tail_value_ += count;
+    pending_sqes_ = 0;
+    __atomic_store_n(sq_tail_, sq_tail_value_, __ATOMIC_RELEASE);
+  }
+
+  // Submit queued reads while the completion queue has room for them.  On
+  // error, the reads which couldn't be submitted are moved to `failed`.
+  Status SubmitQueued(std::vector<IoUringRead*>* failed) {
+    while (!queued_.empty() && in_flight_reads_.size() < cq_entries_) {
+      const auto batch_size = static_cast<unsigned>(std::min<size_t>(
+          {queued_.size(), cq_entries_ - in_flight_reads_.size(), sq_entries_}));
+      for (unsigned i = 0; i < batch_size; ++i) {
+        PushRead(queued_[i]);
+      }
+      CommitSqes(batch_size);
+      Status st = Enter(batch_size);
+      if (!st.ok()) {
+        // Take back the reads not consumed by the kernel
+        sq_tail_value_ -= unsubmitted_;
+        __atomic_store_n(sq_tail_, sq_tail_value_, __ATOMIC_RELEASE);
+      }
+      // Submitted reads are now owned by the ring
+      for (unsigned i = 0; i < batch_size - unsubmitted_; ++i) {
+        in_flight_reads_.insert(queued_.front());
+        queued_.pop_front();
+      }
+      if (!st.ok()) {
+        failed->insert(failed->end(), queued_.begin(), queued_.end());
+        queued_.clear();
+        return st;
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Enter(unsigned to_submit) {
+    unsubmitted_ = to_submit;
+    while (unsubmitted_ > 0) {
+      const long ret =  // NOLINT runtime/int
+          syscall(__NR_io_uring_enter, ring_fd_, unsubmitted_, 0, 0, nullptr, 0);
+      if (ret < 0) {
+        if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+          std::this_thread::yield();
+          continue;
+        }
+        return IOErrorFromErrno(errno, "io_uring_enter failed");
+      }
+      unsubmitted_ -= static_cast<unsigned>(ret);
+    }
+    return Status::OK();
+  }
+
+  // Complete a read, whether successfully or not, and release it
+  static void Finish(IoUringRead* read, Status st) {
+    std::unique_ptr<IoUringRead> owned(read);
+    if (st.ok() && read->bytes_read < read->nbytes) {
+      st = read->buffer->Resize(read->bytes_read);
+      read->buffer->ZeroPadding();
+    }
+    read->pending->Done();
+    if (st.ok()) {
+      read->future.MarkFinished(std::shared_ptr<Buffer>(std::move(read->buffer)));
+    } else {
+      read->future.MarkFinished(std::move(st));
+    }
+  }
+
+  // Fail all outstanding reads once waiting for completions failed, and make
+  // later submissions fail.  The kernel may still write to the buffers of the
+  // submitted reads, so those are kept alive until the ring is destroyed.
+  void Break(const Status& st) {
+    ARROW_LOG(WARNING) << "io_uring instance is broken: " << st.ToString();
+    std::vector<IoUringRead*> submitted;
+    std::vector<IoUringRead*> queued;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      broken_status_ = st;
+      submitted.assign(in_flight_reads_.begin(), in_flight_reads_.end());
+      in_flight_reads_.clear();
+      queued.assign(queued_.begin(), queued_.end());
+      queued_.clear();
+    }
+    for (IoUringRead* read : submitted) {
+      read->pending->Done();
+      read->future.MarkFinished(st);
+      abandoned_reads_.emplace_back(read);
+    }
+    for (IoUringRead* read : queued) {
+      Finish(read, st);
+    }
+  }
+
+  void ReapCompletions() {
+    std::vector<IoUringRead*> resubmit;
+    std::vector<std::pair<IoUringRead*, Status>> finished;
+    std::vector<IoUringRead*> failed;
+    bool stopping = false;
+    while (!stopping) {
+      const long ret =  // NOLINT runtime/int
+          syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr,
+                  0);
+      if (ret < 0 && errno != EINTR) {
+        Break(IOErrorFromErrno(errno, "io_uring_enter failed"));
+        return;
+      }
+
+      unsigned head = *cq_head_;
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        auto read = reinterpret_cast<IoUringRead*>(cqe.user_data);
+        if (read == nullptr) {
+          stopping = true;
+        } else if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+          resubmit.push_back(read);
+        } else if (cqe.res < 0) {
+          finished.emplace_back(read, IOErrorFromErrno(-cqe.res, "io_uring read failed"));
+        } else {
+          read->bytes_read += cqe.res;
+          if (cqe.res > 0 && read->bytes_read < read->nbytes) {
+            // Short read: ask for the remainder
+            resubmit.push_back(read);
+          } else {
+            // Either the range was fully read or end of file was reached
+            finished.emplace_back(read, Status::OK());
+          }
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+      // Forget the completed reads before releasing them, then submit the
+      // reads to retry ahead of the queued ones
+      Status st;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& read_and_status : finished) {
+          in_flight_reads_.erase(read_and_status.first);
+        }
+        for (auto it = resubmit.rbegin(); it != resubmit.rend(); ++it) {
+          in_flight_reads_.erase(*it);
+          queued_.push_front(*it);
+        }
+        st = SubmitQueued(&failed);
+      }
+      for (auto& read_and_status : finished) {
+        Finish(read_and_status.first, std::move(read_and_status.second));
+      }
+      for (IoUringRead* read : failed) {
+        Finish(read, st);
+      }
+      resubmit.clear();
+      finished.clear();
+      failed.clear();
+    }
+  }
+
+  static constexpr unsigned kQueueDepth = 256;
+
+  int ring_fd_ = -1;
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+
+  unsigned sq_entries_ = 0;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+
+  unsigned cq_entries_ = 0;
+  unsigned cq_mask_ = 0;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+
+  // Protects the submission queue and the fields below
+  std::mutex mutex_;
+  unsigned sq_tail_value_ = 0;
+  unsigned pending_sqes_ = 0;
+  unsigned unsubmitted_ = 0;
+  // Reads owned by the kernel, at most cq_entries_ so that the completion
+  // queue can't overflow
+  std::unordered_set<IoUringRead*> in_flight_reads_;
+  // Reads waiting for room in the completion queue
+  std::deque<IoUringRead*> queued_;
+  // Set once waiting for completions failed
+  Status broken_status_;
+
+  // Only accessed by the reaper, and by the destructor once it exited
+  std::vector<std::unique_ptr<IoUringRead>> abandoned_reads_;
+  std::thread reaper_;
+};
+
+constexpr unsigned IoUring::kQueueDepth;
+
+#endif  // ARROW_HAVE_IO_URING
+
+}  // namespace
+
+class IoUringReadableFile::IoUringReadableFileImpl {
+ public:
+  explicit IoUringReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
+
+  Status Open(const std::string& path) {
+    ARROW_ASSIGN_OR_RAISE(file_, ReadableFile::Open(path, pool_));
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (file_ == nullptr) {
+      return Status::OK();
+    }
+    pending_.Wait();
+    return file_->Close();
+  }
+
+  bool closed() const { return file_ == nullptr || file_->closed(); }
+
+  ReadableFile* file() const { return file_.get(); }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(ranges.size());
+#ifdef ARROW_HAVE_IO_URING
+    Status st = ctx.stop_token().Poll();
+    if (st.ok() && file_->closed()) {
+      st = Status::Invalid("Invalid operation on closed file");
+    }
+    auto maybe_ring = IoUring::GetInstance();
+    if (st.ok()) {
+      st = maybe_ring.status();
+    }
+
+    std::vector<std::unique_ptr<IoUringRead>> reads;
+    for (const auto& range : ranges) {
+      Status range_st = st;
+      if (range_st.ok()) {
+        range_st = internal::ValidateRange(range.offset, range.length);
+      }
+      std::unique_ptr<ResizableBuffer> buffer;
+      if (range_st.ok()) {
+        auto maybe_buffer = AllocateResizableBuffer(range.length, pool_);
+        range_st = maybe_buffer.status();
+        if (range_st.ok()) buffer = std::move(maybe_buffer).ValueUnsafe();
+      }
+      if (!range_st.ok()) {
+        futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(range_st));
+        continue;
+      }
+      if (range.length == 0) {
+        futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(
+            std::shared_ptr<Buffer>(std::move(buffer))));
+        continue;
+      }
+      std::unique_ptr<IoUringRead> read(new IoUringRead{
+          file_->file_descriptor(), range.offset, range.length, /*bytes_read=*/0, {},
+          std::move(buffer), Future<std::shared_ptr<Buffer>>::Make(), &pending_});
+      futures.push_back(read->future);
+      reads.push_back(std::move(read));
+    }
+    if (!reads.empty()) {
+      pending_.Add(static_cast<int64_t>(reads.size()));
+      (*maybe_ring)->Submit(std::move(reads));
+    }
+
+    // Don't run continuations on the reaper thread
+    if (ctx.executor() != nullptr) {
+      for (auto& future : futures) {
+        future = ctx.executor()->Transfer(std::move(future));
+      }
+    }
+#else
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(
+          Status::NotImplemented("io_uring is not supported on this platform")));
+    }
+#endif
+    return futures;
+  }
+
+ private:
+  MemoryPool* pool_;
+  std::shared_ptr<ReadableFile> file_;
+  PendingReads pending_;
+};
+
+IoUringReadableFile::IoUringReadableFile(MemoryPool* pool)
+    : impl_(new IoUringReadableFileImpl(pool)) {}
+
+IoUringReadableFile::~IoUringReadableFile() { internal::CloseFromDestructor(this); }
+
+bool IoUringReadableFile::IsSupported() {
+#ifdef ARROW_HAVE_IO_URING
+  return IoUring::GetInstance().ok();
+#else
+  return false;
+#endif
+}
+
+Result<std::shared_ptr<IoUringReadableFile>> IoUringReadableFile::Open(
+    const std::string& path, MemoryPool* pool) {
+#ifdef ARROW_HAVE_IO_URING
+  RETURN_NOT_OK(IoUring::GetInstance().status());
+  auto file = std::shared_ptr<IoUringReadableFile>(new IoUringReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path));
+  return file;
+#else
+  return Status::NotImplemented("io_uring is not supported on this platform");
+#endif
+}
+
+Status IoUringReadableFile::DoClose() { return impl_->Close(); }
+
+bool IoUringReadableFile::closed() const { return impl_->closed(); }
+
+int IoUringReadableFile::file_descriptor() const {
+  return impl_->file()->file_descriptor();
+}
+
+Status IoUringReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return impl_->file()->WillNeed(ranges);
+}
+
+Future<std::shared_ptr<Buffer>> IoUringReadableFile::ReadAsync(const IOContext& ctx,
+                                                               int64_t position,
+                                                               int64_t nbytes) {
+  return impl_->ReadManyAsync(ctx, {{position, nbytes}})[0];
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUringReadableFile::ReadManyAsync(
+    const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+  return impl_->ReadManyAsync(ctx, ranges);
+}
+
+Result<int64_t> IoUringReadableFile::DoTell() const { return impl_->file()->Tell(); }
+
+Result<int64_t> IoUringReadableFile::DoRead(int64_t nbytes, void* out) {
+  return impl_->file()->Read(nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> IoUringReadableFile::DoRead(int64_t nbytes) {
+  return impl_->file()->Read(nbytes);
+}
+
+Result<int64_t> IoUringReadableFile::DoReadAt(int64_t position, int64_t nbytes,
+                                              void* out) {
+  return impl_->file()->ReadAt(position, nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> IoUringReadableFile::DoReadAt(int64_t position,
+                                                              int64_t nbytes) {
+  return impl_->file()->ReadAt(position, nbytes);
+}
+
+Result<int64_t> IoUringReadableFile::DoGetSize() { return impl_->file()->GetSize(); }
+
+Status IoUringReadableFile::DoSeek(int64_t pos) { return impl_->file()->Seek(pos); }
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -107,10 +107,28 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       int fd, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading, bypassing the operating system's
+  /// page cache (O_DIRECT)
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return ReadableFile instance
+  ///
+  /// Reads are widened to 4096-byte boundaries into aligned buffers allocated
+  /// from `pool`, and ReadAt() returns a slice of such a buffer.  Small reads
+  /// should therefore be coalesced, for example with io::internal::ReadRangeCache.
+  ///
+  /// If the platform or file system doesn't support direct I/O, the file is
+  /// opened as with Open().
+  static Result<std::shared_ptr<ReadableFile>> OpenDirect(
+      const std::string& path, MemoryPool* pool = default_memory_pool());
+
   bool closed() const override;
 
   int file_descriptor() const;
 
+  /// \brief Whether reads bypass the page cache
+  bool direct_io() const;
+
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
  private:
@@ -136,6 +154,65 @@ class ARROW_EXPORT ReadableFile
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief An operating system file open in read-only mode, whose asynchronous
+/// reads are performed using the Linux io_uring interface.
+///
+/// Synchronous reads behave as with ReadableFile.  ReadAsync() and ReadManyAsync()
+/// queue the reads on a io_uring instance shared by the whole process, instead of
+/// blocking an I/O thread for the duration of each read.  A background thread
+/// reaps completed reads and finishes the corresponding Futures on the executor
+/// of the given IOContext.
+///
+/// Only available on Linux kernels supporting io_uring; see IsSupported().
+class ARROW_EXPORT IoUringReadableFile
+    : public internal::RandomAccessFileConcurrencyWrapper<IoUringReadableFile> {
+ public:
+  ~IoUringReadableFile() override;
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return IoUringReadableFile instance
+  ///
+  /// Returns NotImplemented if io_uring is not available.
+  static Result<std::shared_ptr<IoUringReadableFile>> Open(
+      const std::string& path, MemoryPool* pool = default_memory_pool());
+
+  /// \brief Whether io_uring can be used on this platform and kernel
+  static bool IsSupported();
+
+  bool closed() const override;
+
+  int file_descriptor() const;
+
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  /// \brief Read several ranges asynchronously, submitting them to the kernel
+  /// with a single system call
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges) override;
+
+ private:
+  friend RandomAccessFileConcurrencyWrapper<IoUringReadableFile>;
+
+  explicit IoUringReadableFile(MemoryPool* pool);
+
+  Status DoClose();
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+  Result<int64_t> DoGetSize();
+  Status DoSeek(int64_t position);
+
+  class ARROW_NO_EXPORT IoUringReadableFileImpl;
+  std::unique_ptr<IoUringReadableFileImpl> impl_;
+};
+
 /// \brief A file interface that uses memory-mapped files for memory interactions
 ///
 /// This implementation supports zero-copy reads. The same class is used
@@ -18,6 +18,7 @@
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/windows_compatibility.h"
@@ -28,8 +29,10 @@
 #include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <random>
 #include <thread>
 #include <valarray>
+#include <vector>
 
 #ifdef _WIN32
 
@@ -287,6 +290,68 @@ static void BufferedOutputStreamLargeWritesToPipe(
   BenchmarkStreamingWrites(state, large_sizes, buffered_stream.get(), reader.get());
 }
 
+// Benchmark asynchronous random reads of a local file
+//
+// The file is small enough to stay in the page cache, so this measures the
+// overhead of each asynchronous read: a blocking read on the I/O thread pool
+// for ReadableFile, a submission to io_uring for IoUringReadableFile.
+
+constexpr int64_t kAsyncReadFileSize = 64 * 1024 * 1024;
+constexpr int64_t kAsyncReadBytes = 16 * 1024 * 1024;
+
+static std::string MakeAsyncReadFile(internal::TemporaryDir* temp_dir) {
+  const std::string path =
+      temp_dir->path().Join("async-read-benchmark").ValueOrDie().ToString();
+  auto stream = *io::FileOutputStream::Open(path);
+  const std::string chunk(1024 * 1024, 'x');
+  for (int64_t i = 0; i < kAsyncReadFileSize; i += chunk.size()) {
+    ABORT_NOT_OK(stream->Write(chunk.data(), chunk.size()));
+  }
+  ABORT_NOT_OK(stream->Close());
+  return path;
+}
+
+static void BenchmarkReadManyAsync(benchmark::State& state,  // NOLINT non-const reference
+                                   io::RandomAccessFile* file) {
+  const int64_t read_size = state.range(0);
+  const int64_t num_reads = kAsyncReadBytes / read_size;
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> offsets(0, kAsyncReadFileSize - read_size);
+  std::vector<io::ReadRange> ranges;
+  for (int64_t i = 0; i < num_reads; ++i) {
+    ranges.push_back({offsets(gen), read_size});
+  }
+
+  for (auto _ : state) {
+    auto futures = file->ReadManyAsync(io::default_io_context(), ranges);
+    for (const auto& future : futures) {
+      ABORT_NOT_OK(future.status());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * num_reads * read_size);
+  state.SetItemsProcessed(state.iterations() * num_reads);
+}
+
+static void ReadableFileReadManyAsync(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto temp_dir = *internal::TemporaryDir::Make("file-benchmark-");
+  auto file = *io::ReadableFile::Open(MakeAsyncReadFile(temp_dir.get()));
+
+  BenchmarkReadManyAsync(state, file.get());
+}
+
+static void IoUringReadableFileReadManyAsync(
+    benchmark::State& state) {  // NOLINT non-const reference
+  if (!io::IoUringReadableFile::IsSupported()) {
+    state.SkipWithError("io_uring not supported");
+    return;
+  }
+  auto temp_dir = *internal::TemporaryDir::Make("file-benchmark-");
+  auto file = *io::IoUringReadableFile::Open(MakeAsyncReadFile(temp_dir.get()));
+
+  BenchmarkReadManyAsync(state, file.get());
+}
+
 // We use real time as we don't want to count CPU time spent in the
 // BackgroundReader thread
 
@@ -298,4 +363,13 @@ BENCHMARK(BufferedOutputStreamSmallWritesToNull)->UseRealTime();
 BENCHMARK(BufferedOutputStreamSmallWritesToPipe)->UseRealTime();
 BENCHMARK(BufferedOutputStreamLargeWritesToPipe)->UseRealTime();
 
+BENCHMARK(ReadableFileReadManyAsync)
+    ->RangeMultiplier(16)
+    ->Range(4096, 1 << 20)
+    ->UseRealTime();
+BENCHMARK(IoUringReadableFileReadManyAsync)
+    ->RangeMultiplier(16)
+    ->Range(4096, 1 << 20)
+    ->UseRealTime();
+
 }  // namespace arrow
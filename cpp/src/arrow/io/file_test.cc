@@ -408,6 +408,49 @@ TEST_F(TestReadableFile, WillNeed) {
   ASSERT_RAISES(Invalid, file_->WillNeed({{-1, -1}}));
 }
 
+TEST_F(TestReadableFile, DirectIO) {
+  // Not a multiple of the block size
+  std::string data;
+  for (int i = 0; i < 10000; ++i) {
+    data += static_cast<char>('a' + i % 26);
+  }
+  {
+    std::ofstream stream(path_.c_str());
+    stream << data;
+  }
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::OpenDirect(path_));
+  ASSERT_OK_AND_EQ(10000, file_->GetSize());
+
+  for (const auto& range : std::vector<ReadRange>{
+           {0, 10}, {4095, 2}, {4096, 4096}, {1000, 7000}, {9990, 100}, {12000, 10}}) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(range.offset, range.length));
+    AssertBufferEqual(*buffer, data.substr(std::min<size_t>(range.offset, data.size()),
+                                           range.length));
+    if (file_->direct_io()) {
+      // Slice of an aligned buffer
+      ASSERT_NE(buffer->parent(), nullptr);
+    }
+  }
+
+  std::string out(20, '\0');
+  ASSERT_OK_AND_EQ(20, file_->ReadAt(5000, 20, &out[0]));
+  ASSERT_EQ(out, data.substr(5000, 20));
+
+  ASSERT_OK(file_->Seek(9000));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->Read(600));
+  AssertBufferEqual(*buffer, data.substr(9000, 600));
+  ASSERT_OK_AND_EQ(9600, file_->Tell());
+  out.resize(1000);
+  ASSERT_OK_AND_EQ(400, file_->Read(1000, &out[0]));
+
+  auto fut = file_->ReadAsync({}, 3, 5000);
+  ASSERT_OK_AND_ASSIGN(buffer, fut.result());
+  AssertBufferEqual(*buffer, data.substr(3, 5000));
+
+  ASSERT_OK(file_->WillNeed({{0, 100}}));
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1));
+}
+
 TEST_F(TestReadableFile, NonexistentFile) {
   std::string path = "0xDEADBEEF.txt";
   auto maybe_file = ReadableFile::Open(path);
@@ -493,6 +536,106 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+// ----------------------------------------------------------------------
+// IoUringReadableFile tests
+
+class TestIoUringReadableFile : public FileTestFixture {
+ public:
+  void SetUp() override {
+    if (!IoUringReadableFile::IsSupported()) {
+      GTEST_SKIP() << "io_uring not supported";
+    }
+    FileTestFixture::SetUp();
+  }
+
+  void MakeTestFile(const std::string& data = "testdata") {
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data;
+  }
+
+  void OpenFile() { ASSERT_OK_AND_ASSIGN(file_, IoUringReadableFile::Open(path_)); }
+
+ protected:
+  std::shared_ptr<IoUringReadableFile> file_;
+};
+
+TEST_F(TestIoUringReadableFile, DestructorClosesFile) {
+  MakeTestFile();
+
+  int fd;
+  {
+    ASSERT_OK_AND_ASSIGN(auto file, IoUringReadableFile::Open(path_));
+    fd = file->file_descriptor();
+  }
+  ASSERT_TRUE(FileIsClosed(fd));
+}
+
+TEST_F(TestIoUringReadableFile, ReadAt) {
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK_AND_EQ(8, file_->GetSize());
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(1, 3));
+  AssertBufferEqual(*buffer, "est");
+  ASSERT_OK(file_->Seek(4));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(10));
+  AssertBufferEqual(*buffer, "data");
+}
+
+TEST_F(TestIoUringReadableFile, ReadAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto fut1 = file_->ReadAsync({}, 1, 10);
+  auto fut2 = file_->ReadAsync({}, 0, 4);
+  auto fut3 = file_->ReadAsync({}, 3, 0);
+  auto fut4 = file_->ReadAsync({}, 20, 5);
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, fut3.result());
+  ASSERT_OK_AND_ASSIGN(auto buf4, fut4.result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+  AssertBufferEqual(*buf3, "");
+  AssertBufferEqual(*buf4, "");
+
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, -1, 1).status());
+}
+
+TEST_F(TestIoUringReadableFile, ReadManyAsync) {
+  // More reads than the ring can hold at once
+  constexpr int64_t kNumReads = 2000;
+  std::string data;
+  for (int64_t i = 0; i < kNumReads; ++i) {
+    data += static_cast<char>('a' + i % 26);
+  }
+  MakeTestFile(data);
+  OpenFile();
+
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < kNumReads; ++i) {
+    ranges.push_back({i, 3});
+  }
+  auto futures = file_->ReadManyAsync({}, ranges);
+  ASSERT_EQ(futures.size(), ranges.size());
+  for (int64_t i = 0; i < kNumReads; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, futures[i].result());
+    AssertBufferEqual(*buffer, data.substr(i, 3));
+  }
+  // Closing waits for outstanding reads
+  futures = file_->ReadManyAsync({}, ranges);
+  ASSERT_OK(file_->Close());
+  for (auto& future : futures) {
+    ASSERT_OK(future.status());
+  }
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, 0, 1).status());
+}
+
+TEST_F(TestIoUringReadableFile, NonexistentFile) {
+  ASSERT_RAISES(IOError, IoUringReadableFile::Open("0xDEADBEEF.txt"));
+}
+
 // ----------------------------------------------------------------------
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
@@ -845,13 +846,101 @@ TEST(RangeReadCache, Lazy) {
   ASSERT_EQ(3, file->read_count());
 }
 
+TEST(RangeReadCache, MemoryLimit) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.memory_limit = 8;
+
+  auto file = std::make_shared<CountingBufferReader>(Buffer(data));
+  internal::ReadRangeCache cache(file, {}, options);
+  // Coalesced into {1, 4}, {8, 6} and {15, 7}
+  ASSERT_OK(cache.Cache(
+      {{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 0}, {10, 4}, {14, 0}, {15, 4}}));
+
+  // Only read ahead as far as the limit allows
+  ASSERT_FINISHES_OK(cache.Wait());
+  ASSERT_EQ(1, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_EQ(1, file->read_count());
+  // {1, 4} is fully consumed: it is dropped and the next range is read
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_EQ(2, file->read_count());
+  // Dropped ranges can still be read, directly from the file
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_FINISHES_OK(cache.WaitFor({{1, 2}}));
+  ASSERT_EQ(2, file->read_count());
+
+  // Ranges beyond the read-ahead window are read on demand
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  ASSERT_EQ(3, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({10, 4}));
+  AssertBufferEqual(*buf, "klmn");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({14, 0}));
+  AssertBufferEqual(*buf, "");
+  ASSERT_EQ(3, file->read_count());
+
+  // Non-cached ranges
+  ASSERT_RAISES(Invalid, cache.Read({20, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({0, 3}));
+  ASSERT_FINISHES_AND_RAISES(Invalid, cache.WaitFor({{25, 2}}));
+  ASSERT_FINISHES_OK(cache.Wait());
+
+  // A lazy cache doesn't read ahead at all
+  options.lazy = true;
+  file = std::make_shared<CountingBufferReader>(Buffer(data));
+  internal::ReadRangeCache lazy_cache(file, {}, options);
+  ASSERT_OK(lazy_cache.Cache({{1, 2}, {3, 2}, {8, 2}, {10, 4}}));
+  ASSERT_EQ(0, file->read_count());
+  ASSERT_FINISHES_OK(lazy_cache.WaitFor({{10, 4}}));
+  ASSERT_EQ(1, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, lazy_cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_EQ(2, file->read_count());
+}
+
+TEST(RangeReadCache, MemoryLimitConcurrency) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer(data));
+  std::vector<ReadRange> ranges{{1, 2},  {3, 2},  {8, 2},  {20, 2},
+                                {25, 0}, {10, 4}, {14, 0}, {15, 4}};
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.memory_limit = 1;
+
+  internal::ReadRangeCache cache(file, {}, options);
+  ASSERT_OK(cache.Cache(ranges));
+  ASSERT_OK(arrow::internal::ParallelFor(
+      static_cast<int>(ranges.size()), [&](int index) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto buf, cache.Read(ranges[index]));
+        if (buf->ToString() != data.substr(ranges[index].offset, ranges[index].length)) {
+          return Status::Invalid("Unexpected data");
+        }
+        return Status::OK();
+      }));
+  ASSERT_FINISHES_OK(cache.Wait());
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
     const CacheOptions expected = {
         static_cast<int64_t>(std::round(expected_hole_size_limit_MiB * 1024 * 1024)),
         static_cast<int64_t>(std::round(expected_range_size_limit_MiB * 1024 * 1024)),
-        /*lazy=*/false};
+        /*lazy=*/false, /*adaptive=*/false, /*memory_limit=*/0};
     ASSERT_EQ(actual, expected);
   };
 
@@ -869,6 +958,123 @@ TEST(CacheOptions, Basics) {
   check(CacheOptions::MakeFromNetworkMetrics(5, 500, .75, 5), 2.5, 5);
 }
 
+TEST(ReadMetrics, Estimates) {
+  internal::ReadMetrics metrics;
+  double ttfb, bandwidth;
+  // TTFB = 5 ms, BW = 500 MiB/s
+  auto duration = [](int64_t nbytes) { return 0.005 + nbytes / (500.0 * 1024 * 1024); };
+
+  // Not enough reads
+  for (int64_t i = 1; i < internal::ReadMetrics::kMinReads; ++i) {
+    metrics.Record(i * 100000, duration(i * 100000));
+  }
+  ASSERT_FALSE(metrics.GetEstimates(&ttfb, &bandwidth));
+  ASSERT_EQ(metrics.Adapt(CacheOptions::LazyDefaults()), CacheOptions::LazyDefaults());
+
+  for (int64_t i = 0; i < 100; ++i) {
+    const int64_t nbytes = (i % 10 + 1) * 100000;
+    metrics.Record(nbytes, duration(nbytes));
+  }
+  ASSERT_TRUE(metrics.GetEstimates(&ttfb, &bandwidth));
+  ASSERT_NEAR(ttfb, 0.005, 1e-6);
+  ASSERT_NEAR(bandwidth, 500.0 * 1024 * 1024, 1e3);
+
+  // Coalescing limits follow MakeFromNetworkMetrics()
+  auto adapted = metrics.Adapt(CacheOptions::LazyDefaults());
+  auto expected = CacheOptions::MakeFromNetworkMetrics(5, 500);
+  ASSERT_NEAR(adapted.hole_size_limit, expected.hole_size_limit, 10);
+  ASSERT_NEAR(adapted.range_size_limit, expected.range_size_limit, 100);
+  ASSERT_TRUE(adapted.lazy);
+
+  // Latency can't be told apart from bandwidth with identical read sizes
+  metrics.Reset();
+  for (int64_t i = 0; i < 100; ++i) {
+    metrics.Record(100000, duration(100000));
+  }
+  ASSERT_FALSE(metrics.GetEstimates(&ttfb, &bandwidth));
+
+  // Durations which don't depend on the read size: latency-bound storage
+  metrics.Reset();
+  for (int64_t i = 0; i < 100; ++i) {
+    metrics.Record((i % 10 + 1) * 100000, 0.005);
+  }
+  ASSERT_TRUE(metrics.GetEstimates(&ttfb, &bandwidth));
+  ASSERT_NEAR(ttfb, 0.005, 1e-4);
+  adapted = metrics.Adapt(CacheOptions::Defaults());
+  ASSERT_EQ(adapted.range_size_limit, CacheOptions::kDefaultMaxIdealRequestSizeMib << 20);
+  ASSERT_EQ(adapted.hole_size_limit, adapted.range_size_limit - 1);
+}
+
+// Adaptive caches time each read around ReadAt() on the IO executor, so count
+// the ranges read that way
+class ReadAtCountingFile : public SlowRandomAccessFile {
+ public:
+  explicit ReadAtCountingFile(const std::string& data)
+      : SlowRandomAccessFile(std::make_shared<BufferReader>(Buffer::FromString(data)),
+                             /*average_latency=*/0.0) {}
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    read_count_++;
+    return SlowRandomAccessFile::ReadAt(position, nbytes);
+  }
+  int64_t read_count() const { return read_count_; }
+
+ private:
+  std::atomic<int64_t> read_count_{0};
+};
+
+TEST(RangeReadCache, Adaptive) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.adaptive = true;
+
+  auto file = std::make_shared<ReadAtCountingFile>(data);
+  auto metrics = internal::ReadMetrics::ForFile(*file);
+  // Metrics are shared by files of the same type
+  ASSERT_EQ(metrics, internal::ReadMetrics::ForFile(ReadAtCountingFile(data)));
+  ASSERT_NE(metrics, internal::ReadMetrics::ForFile(BufferReader(Buffer(data))));
+  metrics->Reset();
+  {
+    // No measurements yet: the configured limits are used
+    internal::ReadRangeCache cache(file, {}, options);
+    ASSERT_OK(cache.Cache({{1, 2}, {8, 2}, {20, 2}}));
+    ASSERT_FINISHES_OK(cache.Wait());
+    ASSERT_EQ(file->read_count(), 3);
+  }
+  {
+    // Each read is recorded
+    auto other_file = std::make_shared<ReadAtCountingFile>(std::string(100, 'x'));
+    internal::ReadRangeCache cache(other_file, {}, options);
+    std::vector<ReadRange> ranges;
+    for (int64_t i = 0; i < internal::ReadMetrics::kMinReads; ++i) {
+      ranges.push_back({i * 10, 1 + i % 2});
+    }
+    ASSERT_OK(cache.Cache(ranges));
+    ASSERT_FINISHES_OK(cache.Wait());
+    ASSERT_EQ(other_file->read_count(), internal::ReadMetrics::kMinReads);
+    double ttfb, bandwidth;
+    ASSERT_TRUE(metrics->GetEstimates(&ttfb, &bandwidth));
+  }
+  // High latency storage (TTFB = 5 ms, BW = 500 MiB/s)
+  metrics->Reset();
+  for (int64_t i = 0; i < 100; ++i) {
+    const int64_t nbytes = (i % 10 + 1) * 100000;
+    metrics->Record(nbytes, 0.005 + nbytes / (500.0 * 1024 * 1024));
+  }
+  {
+    internal::ReadRangeCache cache(file, {}, options);
+    ASSERT_OK(cache.Cache({{1, 2}, {8, 2}, {20, 2}}));
+    ASSERT_FINISHES_OK(cache.Wait());
+    ASSERT_EQ(file->read_count(), 4);
+    ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({8, 2}));
+    AssertBufferEqual(*buf, "ij");
+  }
+  metrics->Reset();
+}
+
 TEST(IOThreadPool, Capacity) {
   // Simple sanity check
   auto pool = internal::GetIOThreadPool();
@@ -131,6 +131,10 @@ struct ARROW_EXPORT IpcReadOptions {
   ///
   /// If empty (the default), return all deserialized fields.
   /// If non-empty, the values are the indices of fields in the top-level schema.
+  ///
+  /// When reading from an IPC file that doesn't support zero-copy reads,
+  /// RecordBatchFileReader only reads the buffers of the included fields
+  /// (coalescing nearby ones) rather than whole record batch bodies.
   std::vector<int> included_fields;
 
   /// \brief Use global CPU thread pool to parallelize any computational tasks
@@ -149,6 +153,16 @@ struct ARROW_EXPORT IpcReadOptions {
   /// RecordBatchStreamReader and StreamDecoder classes.
   bool ensure_native_endian = true;
 
+  /// \brief Number of record batches to read and decode ahead of consumption
+  ///
+  /// Only used by the generator returned from
+  /// RecordBatchFileReader::GetRecordBatchGenerator().  Each time a batch is
+  /// requested, up to this many following batches are read (through the
+  /// coalescing cache, if enabled) and decoded, including decompression, in
+  /// the background.  If an executor is given, batches are then decompressed
+  /// in parallel with each other instead of buffer by buffer.
+  int batch_readahead = 0;
+
   static IpcReadOptions Defaults();
 };
 
@@ -28,6 +28,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -254,6 +255,29 @@ READ_BENCHMARK(ReadMmapFile, GENERATE_DATA_TEMP_FILE, READ_DATA_MMAP_FILE);
 READ_BENCHMARK(ReadCompressedFile, GENERATE_COMPRESSED_DATA_IN_MEMORY,
                READ_DATA_IN_MEMORY);
 
+static void ReadCompressedFileReadaheadAsync(benchmark::State& state) {
+  GENERATE_COMPRESSED_DATA_IN_MEMORY();
+  auto read_options = ipc::IpcReadOptions::Defaults();
+  read_options.batch_readahead = 4;
+  for (auto _ : state) {
+    READ_DATA_IN_MEMORY();
+    auto reader = *ipc::RecordBatchFileReader::Open(input, read_options);
+    ASSIGN_OR_ABORT(auto generator,
+                    reader->GetRecordBatchGenerator(
+                        /*coalesce=*/true, io::default_io_context(),
+                        io::CacheOptions::LazyDefaults(), internal::GetCpuThreadPool()));
+    const int num_batches = reader->num_record_batches();
+    for (int i = 0; i < num_batches; ++i) {
+      auto batch = *generator().result();
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kBatchSize * kBatches);
+}
+BENCHMARK(ReadCompressedFileReadaheadAsync)
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 13)
+    ->UseRealTime();
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -49,6 +50,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
 
@@ -1633,6 +1635,188 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+// A BufferReader counting the asynchronous reads issued against it
+class ReadAsyncCountingReader : public io::BufferReader {
+ public:
+  using io::BufferReader::BufferReader;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    ++num_reads;
+    return io::BufferReader::ReadAsync(io_context, position, nbytes);
+  }
+
+  std::atomic<int> num_reads{0};
+};
+
+// A file over a buffer tracking the bytes read from it.  Unlike BufferReader, it
+// doesn't advertise zero-copy reads, as for example a remote file.
+class TrackedBufferFile : public io::RandomAccessFile {
+ public:
+  explicit TrackedBufferFile(std::shared_ptr<Buffer> buffer)
+      : reader_(std::move(buffer)) {}
+
+  Status Close() override { return reader_.Close(); }
+  bool closed() const override { return reader_.closed(); }
+  Result<int64_t> Tell() const override { return reader_.Tell(); }
+  Status Seek(int64_t position) override { return reader_.Seek(position); }
+  Result<int64_t> GetSize() override { return reader_.GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, reader_.Read(nbytes, out));
+    total_bytes_read += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, reader_.Read(nbytes));
+    total_bytes_read += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, reader_.ReadAt(position, nbytes, out));
+    total_bytes_read += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, reader_.ReadAt(position, nbytes));
+    total_bytes_read += buffer->size();
+    return buffer;
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext&, int64_t position,
+                                            int64_t nbytes) override {
+    return Future<std::shared_ptr<Buffer>>::MakeFinished(ReadAt(position, nbytes));
+  }
+
+  std::atomic<int64_t> total_bytes_read{0};
+
+ private:
+  io::BufferReader reader_;
+};
+
+TEST(TestIpcFileFormat, ReadIncludedFieldsOnly) {
+  constexpr int kNumBatches = 3;
+  constexpr int64_t kLength = 500;
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < 24; ++i) {
+    std::shared_ptr<DataType> type = int64();
+    if (i == 5) {
+      type = utf8();
+    } else if (i == 12) {
+      type = float64();
+    } else if (i == 13) {
+      type = binary();
+    }
+    fields.push_back(field("f" + std::to_string(i), type));
+    columns.push_back(rg.ArrayOf(type, kLength, /*null_probability=*/0.1));
+  }
+  auto batch = RecordBatch::Make(schema(fields), kLength, columns);
+  const std::vector<int> included_fields = {13, 5, 12};
+  ASSERT_OK_AND_ASSIGN(auto expected, batch->SelectColumns({5, 12, 13}));
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  for (int i = 0; i < kNumBatches; ++i) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+
+  // Bytes read for all record batches, after opening the file
+  auto read_batches = [&](const IpcReadOptions& options) -> int64_t {
+    auto file = std::make_shared<TrackedBufferFile>(helper.buffer_);
+    EXPECT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                          file, helper.footer_offset_, options));
+    const int64_t bytes_before = file->total_bytes_read;
+    for (int i = 0; i < kNumBatches; ++i) {
+      EXPECT_OK_AND_ASSIGN(auto out, reader->ReadRecordBatch(i));
+      AssertBatchesEqual(options.included_fields.empty() ? *batch : *expected, *out);
+    }
+    return file->total_bytes_read - bytes_before;
+  };
+  IpcReadOptions options = IpcReadOptions::Defaults();
+  const int64_t all_fields_bytes = read_batches(options);
+  options.included_fields = included_fields;
+  const int64_t included_fields_bytes = read_batches(options);
+  ASSERT_LT(included_fields_bytes * 3, all_fields_bytes);
+
+  // Same with the generator, with and without coalescing the metadata reads
+  for (const bool coalesce : {false, true}) {
+    auto file = std::make_shared<TrackedBufferFile>(helper.buffer_);
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                          file, helper.footer_offset_, options));
+    const int64_t bytes_before = file->total_bytes_read;
+    ASSERT_OK_AND_ASSIGN(auto generator, reader->GetRecordBatchGenerator(coalesce));
+    for (int i = 0; i < kNumBatches; ++i) {
+      auto next = generator();
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto out, next);
+      AssertBatchesEqual(*expected, *out);
+    }
+    auto end = generator();
+    ASSERT_FINISHES_OK_AND_EQ(nullptr, end);
+    ASSERT_LT((file->total_bytes_read - bytes_before) * 3, all_fields_bytes);
+  }
+}
+
+TEST(TestIpcFileFormat, GeneratorBatchReadahead) {
+  constexpr int kNumBatches = 6;
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  std::vector<std::shared_ptr<util::Codec>> codecs = {nullptr};
+  for (auto codec_type : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (util::Codec::IsAvailable(codec_type)) {
+      ASSERT_OK_AND_ASSIGN(auto codec, util::Codec::Create(codec_type));
+      codecs.push_back(std::move(codec));
+    }
+  }
+  for (const auto& codec : codecs) {
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    write_options.codec = codec;
+    FileWriterHelper helper;
+    ASSERT_OK(helper.Init(batch->schema(), write_options));
+    for (int i = 0; i < kNumBatches; ++i) {
+      ASSERT_OK(helper.WriteBatch(batch));
+    }
+    ASSERT_OK(helper.Finish());
+
+    for (auto executor : {static_cast<::arrow::internal::Executor*>(nullptr),
+                          static_cast<::arrow::internal::Executor*>(
+                              ::arrow::internal::GetCpuThreadPool())}) {
+      auto file = std::make_shared<ReadAsyncCountingReader>(helper.buffer_);
+      IpcReadOptions read_options = IpcReadOptions::Defaults();
+      read_options.batch_readahead = 2;
+      auto fut = RecordBatchFileReader::OpenAsync(file.get(), helper.footer_offset_,
+                                                  read_options);
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto reader, fut);
+      ASSERT_OK_AND_ASSIGN(auto generator,
+                           reader->GetRecordBatchGenerator(
+                               /*coalesce=*/false, io::default_io_context(),
+                               io::CacheOptions::LazyDefaults(), executor));
+
+      const int reads_before = file->num_reads;
+      auto first = generator();
+      // The requested batch and the two following ones are read
+      ASSERT_EQ(reads_before + 3, file->num_reads);
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto out, first);
+      AssertBatchesEqual(*batch, *out);
+      for (int i = 1; i < kNumBatches; ++i) {
+        auto next = generator();
+        ASSERT_LE(file->num_reads, reads_before + kNumBatches);
+        ASSERT_FINISHES_OK_AND_ASSIGN(out, next);
+        AssertBatchesEqual(*batch, *out);
+      }
+      ASSERT_EQ(reads_before + kNumBatches, file->num_reads);
+      auto end = generator();
+      ASSERT_FINISHES_OK_AND_EQ(nullptr, end);
+    }
+  }
+}
+
 // This test uses uninitialized memory
 
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -21,6 +21,7 @@
 #include <climits>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -149,6 +150,17 @@ class ArrayLoader {
         file_(file),
         max_recursion_depth_(options.max_recursion_depth) {}
 
+  /// Only record the body ranges of the buffers to be loaded into
+  /// `read_ranges`, without reading them
+  explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
+                       MetadataVersion metadata_version, const IpcReadOptions& options,
+                       std::vector<io::ReadRange>* read_ranges)
+      : metadata_(metadata),
+        metadata_version_(metadata_version),
+        file_(NULLPTR),
+        read_ranges_(read_ranges),
+        max_recursion_depth_(options.max_recursion_depth) {}
+
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
     if (skip_io_) {
       return Status::OK();
@@ -164,6 +176,10 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
+    if (read_ranges_) {
+      read_ranges_->push_back({offset, length});
+      return Status::OK();
+    }
     return file_->ReadAt(offset, length).Value(out);
   }
 
@@ -387,6 +403,7 @@ class ArrayLoader {
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
   io::RandomAccessFile* file_;
+  std::vector<io::ReadRange>* read_ranges_ = NULLPTR;
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
@@ -1029,13 +1046,18 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
   return FileBlock{block->offset(), block->metaDataLength(), block->bodyLength()};
 }
 
-static Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block,
-                                                             io::RandomAccessFile* file) {
+static Status CheckBlockAligned(const FileBlock& block) {
   if (!BitUtil::IsMultipleOf8(block.offset) ||
       !BitUtil::IsMultipleOf8(block.metadata_length) ||
       !BitUtil::IsMultipleOf8(block.body_length)) {
     return Status::Invalid("Unaligned block in IPC file");
   }
+  return Status::OK();
+}
+
+static Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block,
+                                                             io::RandomAccessFile* file) {
+  RETURN_NOT_OK(CheckBlockAligned(block));
 
   // TODO(wesm): this breaks integration tests, see ARROW-3256
   // DCHECK_EQ((*out)->body_length(), block.body_length);
@@ -1050,11 +1072,7 @@ static Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& bl
 
 static Future<std::shared_ptr<Message>> ReadMessageFromBlockAsync(
     const FileBlock& block, io::RandomAccessFile* file, const io::IOContext& io_context) {
-  if (!BitUtil::IsMultipleOf8(block.offset) ||
-      !BitUtil::IsMultipleOf8(block.metadata_length) ||
-      !BitUtil::IsMultipleOf8(block.body_length)) {
-    return Status::Invalid("Unaligned block in IPC file");
-  }
+  RETURN_NOT_OK(CheckBlockAligned(block));
 
   // TODO(wesm): this breaks integration tests, see ARROW-3256
   // DCHECK_EQ((*out)->body_length(), block.body_length);
@@ -1063,6 +1081,176 @@ static Future<std::shared_ptr<Message>> ReadMessageFromBlockAsync(
                           io_context);
 }
 
+// ----------------------------------------------------------------------
+// Reading only the included fields of record batches from a file
+
+// Whether to read only the buffers of the included fields of record batches
+// rather than whole message bodies
+static bool ReadIncludedFieldsOnly(io::RandomAccessFile* file,
+                                   const std::vector<bool>& inclusion_mask) {
+  // Zero-copy reads (e.g. from memory-mapped files) cost nothing for excluded fields
+  return !file->supports_zero_copy() &&
+         std::find(inclusion_mask.begin(), inclusion_mask.end(), false) !=
+             inclusion_mask.end();
+}
+
+// Get the Message flatbuffer out of the metadata of a file block, that is
+// without the continuation token and the length prefix
+static Result<std::shared_ptr<Buffer>> GetMessageFlatbuffer(
+    const std::shared_ptr<Buffer>& metadata, const FileBlock& block, MemoryPool* pool) {
+  if (metadata->size() < block.metadata_length) {
+    return Status::Invalid("Expected to read ", block.metadata_length,
+                           " metadata bytes but got ", metadata->size());
+  }
+  int64_t prefix_size = sizeof(int32_t);
+  if (metadata->size() < prefix_size) {
+    return Status::Invalid("metadata length is missing. File offset: ", block.offset);
+  }
+  int32_t flatbuffer_size =
+      BitUtil::FromLittleEndian(util::SafeLoadAs<int32_t>(metadata->data()));
+  if (flatbuffer_size == internal::kIpcContinuationToken) {
+    prefix_size += sizeof(int32_t);
+    if (metadata->size() < prefix_size) {
+      return Status::Invalid("metadata length is missing. File offset: ", block.offset);
+    }
+    flatbuffer_size = BitUtil::FromLittleEndian(
+        util::SafeLoadAs<int32_t>(metadata->data() + sizeof(int32_t)));
+  }
+  if (flatbuffer_size <= 0 || prefix_size + flatbuffer_size > metadata->size()) {
+    return Status::Invalid("flatbuffer size ", flatbuffer_size,
+                           " invalid. File offset: ", block.offset,
+                           ", metadata length: ", block.metadata_length);
+  }
+  if (reinterpret_cast<uintptr_t>(metadata->data() + prefix_size) % 8 != 0) {
+    // Avoid potential UBSAN issues from Flatbuffers with unaligned memory
+    return metadata->CopySlice(prefix_size, flatbuffer_size, pool);
+  }
+  return SliceBuffer(metadata, prefix_size, flatbuffer_size);
+}
+
+// Get the body ranges holding the buffers of the included fields of a record
+// batch, in offset order
+static Result<std::vector<io::ReadRange>> GetIncludedFieldsBodyRanges(
+    const Buffer& metadata, const Schema& schema, const std::vector<bool>& inclusion_mask,
+    const IpcReadOptions& options, int64_t body_length) {
+  const flatbuf::Message* message = nullptr;
+  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+  auto batch = message->header_as_RecordBatch();
+  if (batch == nullptr) {
+    return Status::IOError(
+        "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+  }
+
+  std::vector<io::ReadRange> ranges;
+  ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()), options,
+                     &ranges);
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const Field& field = *schema.field(i);
+    if (inclusion_mask[i]) {
+      ArrayData dummy;
+      RETURN_NOT_OK(loader.Load(&field, &dummy));
+    } else {
+      RETURN_NOT_OK(loader.SkipField(&field));
+    }
+  }
+
+  std::sort(ranges.begin(), ranges.end(),
+            [](const io::ReadRange& a, const io::ReadRange& b) {
+              return a.offset < b.offset;
+            });
+  int64_t end = 0;
+  for (const auto& range : ranges) {
+    if (range.offset + range.length > body_length) {
+      return Status::Invalid("Buffer at offset ", range.offset, " of length ",
+                             range.length, " exceeds message body of length ",
+                             body_length);
+    }
+    // Buffers may be repeated but not partially overlap
+    if (range.offset < end && range.offset + range.length > end) {
+      return Status::Invalid("Overlapping buffers at offset ", range.offset,
+                             " in message body");
+    }
+    end = std::max(end, range.offset + range.length);
+  }
+  return ranges;
+}
+
+// A record batch body of which only some ranges were read, through a ReadRangeCache.
+// Only those ranges can be read through ReadAt().
+class IncludedFieldsBodyReader : public io::RandomAccessFile {
+ public:
+  IncludedFieldsBodyReader(std::shared_ptr<io::internal::ReadRangeCache> cache,
+                           int64_t body_offset, int64_t body_length)
+      : cache_(std::move(cache)), body_offset_(body_offset), body_length_(body_length) {}
+
+  Status Close() override {
+    closed_ = true;
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    return Status::NotImplemented("Tell() on a partially read message body");
+  }
+
+  Status Seek(int64_t position) override {
+    return Status::NotImplemented("Seek() on a partially read message body");
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return Status::NotImplemented("Read() on a partially read message body");
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return Status::NotImplemented("Read() on a partially read message body");
+  }
+
+  Result<int64_t> GetSize() override { return body_length_; }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return cache_->Read({body_offset_ + position, nbytes});
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(position, nbytes));
+    std::memcpy(out, buffer->data(), buffer->size());
+    return buffer->size();
+  }
+
+ private:
+  std::shared_ptr<io::internal::ReadRangeCache> cache_;
+  const int64_t body_offset_;
+  const int64_t body_length_;
+  bool closed_ = false;
+};
+
+// Read the buffers of the included fields of the record batch in `block`,
+// coalescing nearby ones, and return the partially read body
+static Future<std::shared_ptr<io::RandomAccessFile>> ReadIncludedFieldsAsync(
+    const Buffer& metadata, const FileBlock& block, const Schema& schema,
+    const std::vector<bool>& inclusion_mask, const IpcReadOptions& options,
+    std::shared_ptr<io::RandomAccessFile> file, const io::IOContext& io_context,
+    const io::CacheOptions& cache_options) {
+  ARROW_ASSIGN_OR_RAISE(auto ranges,
+                        GetIncludedFieldsBodyRanges(metadata, schema, inclusion_mask,
+                                                    options, block.body_length));
+  const int64_t body_offset = block.offset + block.metadata_length;
+  for (auto& range : ranges) {
+    range.offset += body_offset;
+  }
+  auto cache = std::make_shared<io::internal::ReadRangeCache>(std::move(file),
+                                                              io_context, cache_options);
+  RETURN_NOT_OK(cache->Cache(ranges));
+  const int64_t body_length = block.body_length;
+  return cache->WaitFor(std::move(ranges))
+      .Then([cache, body_offset,
+             body_length]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        return std::make_shared<IncludedFieldsBodyReader>(cache, body_offset,
+                                                          body_length);
+      });
+}
+
 static Status ReadOneDictionary(Message* message, const IpcReadContext& context) {
   CHECK_HAS_BODY(*message);
   ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
@@ -1088,30 +1276,45 @@ class ARROW_EXPORT IpcFileRecordBatchGenerator {
   explicit IpcFileRecordBatchGenerator(
       std::shared_ptr<RecordBatchFileReaderImpl> state,
       std::shared_ptr<io::internal::ReadRangeCache> cached_source,
-      const io::IOContext& io_context, arrow::internal::Executor* executor)
+      const io::IOContext& io_context, const io::CacheOptions& cache_options,
+      arrow::internal::Executor* executor)
       : state_(std::move(state)),
         cached_source_(std::move(cached_source)),
         io_context_(io_context),
+        cache_options_(cache_options),
         executor_(executor),
         index_(0) {}
 
   Future<Item> operator()();
   Future<std::shared_ptr<Message>> ReadBlock(const FileBlock& block);
+  // Read the metadata of the message in `block`, returning its flatbuffer
+  Future<std::shared_ptr<Buffer>> ReadBlockMetadata(const FileBlock& block);
 
   static Status ReadDictionaries(
       RecordBatchFileReaderImpl* state,
       std::vector<std::shared_ptr<Message>> dictionary_messages);
   static Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
-      RecordBatchFileReaderImpl* state, Message* message);
+      RecordBatchFileReaderImpl* state, Message* message, bool use_threads);
+  static Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
+      RecordBatchFileReaderImpl* state, const Buffer& metadata,
+      io::RandomAccessFile* body, bool use_threads);
 
  private:
+  // Read and decode the i-th record batch
+  Future<Item> ReadRecordBatchAsync(int i);
+  // Same, reading only the buffers of the included fields from the file
+  Future<Item> ReadRecordBatchSubsetAsync(int i);
+
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
   std::shared_ptr<io::internal::ReadRangeCache> cached_source_;
   io::IOContext io_context_;
+  io::CacheOptions cache_options_;
   arrow::internal::Executor* executor_;
   int index_;
   // Odd Future type, but this lets us use All() easily
   Future<> read_dictionaries_;
+  // Batches being read and decoded ahead of consumption, in order
+  std::deque<Future<Item>> pending_batches_;
 };
 
 class RecordBatchFileReaderImpl : public RecordBatchFileReader {
@@ -1135,6 +1338,12 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       read_dictionaries_ = true;
     }
 
+    if (ReadIncludedFieldsOnly(file_, field_inclusion_mask_)) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, ReadIncludedFields(GetRecordBatchBlock(i)));
+      ++stats_.num_record_batches;
+      return batch;
+    }
+
     std::chrono::steady_clock::time_point st = std::chrono::steady_clock::now();
     ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
     std::chrono::steady_clock::time_point ed = std::chrono::steady_clock::now();
@@ -1234,6 +1443,9 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
           owned_file_, io_context, cache_options);
       auto num_dictionaries = this->num_dictionaries();
       auto num_record_batches = this->num_record_batches();
+      // The bodies of the record batches are read separately if only their
+      // included fields are to be read
+      const bool metadata_only = ReadIncludedFieldsOnly(file_, field_inclusion_mask_);
       std::vector<io::ReadRange> ranges(num_dictionaries + num_record_batches);
       for (int i = 0; i < num_dictionaries; i++) {
         auto block = FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
@@ -1243,12 +1455,13 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       for (int i = 0; i < num_record_batches; i++) {
         auto block = FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i));
         ranges[num_dictionaries + i].offset = block.offset;
-        ranges[num_dictionaries + i].length = block.metadata_length + block.body_length;
+        ranges[num_dictionaries + i].length =
+            block.metadata_length + (metadata_only ? 0 : block.body_length);
       }
       RETURN_NOT_OK(cached_source->Cache(std::move(ranges)));
     }
     return IpcFileRecordBatchGenerator(std::move(state), std::move(cached_source),
-                                       io_context, executor);
+                                       io_context, cache_options, executor);
   }
 
  private:
@@ -1270,6 +1483,26 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return std::move(message);
   }
 
+  // Read the record batch in `block`, fetching only the buffers of the included
+  // fields from the file
+  Result<std::shared_ptr<RecordBatch>> ReadIncludedFields(const FileBlock& block) {
+    RETURN_NOT_OK(CheckBlockAligned(block));
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    ARROW_ASSIGN_OR_RAISE(auto flatbuffer,
+                          GetMessageFlatbuffer(metadata, block, options_.memory_pool));
+    // Non-owning if the reader doesn't own the file
+    std::shared_ptr<io::RandomAccessFile> file(owned_file_, file_);
+    auto fut = ReadIncludedFieldsAsync(
+        *flatbuffer, block, *schema_, field_inclusion_mask_, options_, std::move(file),
+        io::default_io_context(), io::CacheOptions::Defaults());
+    ARROW_ASSIGN_OR_RAISE(auto body, fut.result());
+    ++stats_.num_messages;
+    IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+    return ReadRecordBatchInternal(*flatbuffer, schema_, field_inclusion_mask_, context,
+                                   body.get());
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
@@ -1449,10 +1682,28 @@ Future<IpcFileRecordBatchGenerator::Item> IpcFileRecordBatchGenerator::operator(
           return ReadDictionaries(state.get(), std::move(messages));
         });
   }
-  if (index_ >= state_->num_record_batches()) {
+  // Keep the requested batch and the next batch_readahead ones in flight, so that
+  // reading and decoding them overlaps with the consumption of this one
+  const int readahead = std::max(state->options_.batch_readahead, 0);
+  while (static_cast<int>(pending_batches_.size()) <= readahead &&
+         index_ < state->num_record_batches()) {
+    pending_batches_.push_back(ReadRecordBatchAsync(index_++));
+  }
+  if (pending_batches_.empty()) {
     return Future<Item>::MakeFinished(IterationTraits<Item>::End());
   }
-  auto block = FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(index_++));
+  auto batch = std::move(pending_batches_.front());
+  pending_batches_.pop_front();
+  return batch;
+}
+
+Future<IpcFileRecordBatchGenerator::Item>
+IpcFileRecordBatchGenerator::ReadRecordBatchAsync(int i) {
+  auto state = state_;
+  if (ReadIncludedFieldsOnly(state->file_, state->field_inclusion_mask_)) {
+    return ReadRecordBatchSubsetAsync(i);
+  }
+  auto block = FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(i));
   auto read_message = ReadBlock(block);
   auto read_messages = read_dictionaries_.Then([read_message]() { return read_message; });
   // Force transfer. This may be wasteful in some cases, but ensures we get off the
@@ -1460,17 +1711,71 @@ Future<IpcFileRecordBatchGenerator::Item> IpcFileRecordBatchGenerator::operator(
   // synchronously in the case that the message read has already finished.
   if (executor_) {
     auto executor = executor_;
+    // When several batches are decoded at once on the executor, decompress each of
+    // them serially: waiting for nested tasks from executor threads could starve
+    // the thread pool
+    const bool use_threads =
+        state->options_.use_threads && state->options_.batch_readahead <= 0;
     return read_messages.Then(
         [=](const std::shared_ptr<Message>& message) -> Future<Item> {
-          return DeferNotOk(executor->Submit(
-              [=]() { return ReadRecordBatch(state.get(), message.get()); }));
+          return DeferNotOk(executor->Submit([=]() {
+            return ReadRecordBatch(state.get(), message.get(), use_threads);
+          }));
         });
   }
   return read_messages.Then([=](const std::shared_ptr<Message>& message) -> Result<Item> {
-    return ReadRecordBatch(state.get(), message.get());
+    return ReadRecordBatch(state.get(), message.get(), state->options_.use_threads);
   });
 }
 
+Future<IpcFileRecordBatchGenerator::Item>
+IpcFileRecordBatchGenerator::ReadRecordBatchSubsetAsync(int i) {
+  auto state = state_;
+  auto block = FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(i));
+  RETURN_NOT_OK(CheckBlockAligned(block));
+  auto read_metadata = ReadBlockMetadata(block);
+  // Non-owning, but keeps the reader (which may own the file) alive
+  std::shared_ptr<io::RandomAccessFile> file(state, state->file_);
+  auto io_context = io_context_;
+  auto cache_options = cache_options_;
+  auto executor = executor_;
+  const bool use_threads = state->options_.use_threads &&
+                           (!executor || state->options_.batch_readahead <= 0);
+  return read_dictionaries_.Then([read_metadata]() { return read_metadata; })
+      .Then([=](const std::shared_ptr<Buffer>& metadata) {
+        return ReadIncludedFieldsAsync(*metadata, block, *state->schema_,
+                                       state->field_inclusion_mask_, state->options_,
+                                       file, io_context, cache_options)
+            .Then([=](const std::shared_ptr<io::RandomAccessFile>& body) -> Future<Item> {
+              auto read_batch = [=]() {
+                return ReadRecordBatch(state.get(), *metadata, body.get(), use_threads);
+              };
+              if (executor) {
+                return DeferNotOk(executor->Submit(std::move(read_batch)));
+              }
+              return Future<Item>::MakeFinished(read_batch());
+            });
+      });
+}
+
+Future<std::shared_ptr<Buffer>> IpcFileRecordBatchGenerator::ReadBlockMetadata(
+    const FileBlock& block) {
+  io::ReadRange range{block.offset, block.metadata_length};
+  auto pool = state_->options_.memory_pool;
+  if (cached_source_) {
+    auto cached_source = cached_source_;
+    return cached_source->WaitFor({range}).Then(
+        [cached_source, range, block, pool]() -> Result<std::shared_ptr<Buffer>> {
+          ARROW_ASSIGN_OR_RAISE(auto metadata, cached_source->Read(range));
+          return GetMessageFlatbuffer(metadata, block, pool);
+        });
+  }
+  return state_->file_->ReadAsync(io_context_, range.offset, range.length)
+      .Then([block, pool](const std::shared_ptr<Buffer>& metadata) {
+        return GetMessageFlatbuffer(metadata, block, pool);
+      });
+}
+
 Future<std::shared_ptr<Message>> IpcFileRecordBatchGenerator::ReadBlock(
     const FileBlock& block) {
   if (cached_source_) {
@@ -1499,12 +1804,20 @@ Status IpcFileRecordBatchGenerator::ReadDictionaries(
 }
 
 Result<std::shared_ptr<RecordBatch>> IpcFileRecordBatchGenerator::ReadRecordBatch(
-    RecordBatchFileReaderImpl* state, Message* message) {
+    RecordBatchFileReaderImpl* state, Message* message, bool use_threads) {
   CHECK_HAS_BODY(*message);
   ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-  IpcReadContext context(&state->dictionary_memo_, state->options_, state->swap_endian_);
-  return ReadRecordBatchInternal(*message->metadata(), state->schema_,
-                                 state->field_inclusion_mask_, context, reader.get());
+  return ReadRecordBatch(state, *message->metadata(), reader.get(), use_threads);
+}
+
+Result<std::shared_ptr<RecordBatch>> IpcFileRecordBatchGenerator::ReadRecordBatch(
+    RecordBatchFileReaderImpl* state, const Buffer& metadata,
+    io::RandomAccessFile* body, bool use_threads) {
+  IpcReadOptions options = state->options_;
+  options.use_threads = use_threads;
+  IpcReadContext context(&state->dictionary_memo_, options, state->swap_endian_);
+  return ReadRecordBatchInternal(metadata, state->schema_, state->field_inclusion_mask_,
+                                 context, body);
 }
 
 Status Listener::OnEOS() { return Status::OK(); }
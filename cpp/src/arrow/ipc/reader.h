@@ -205,6 +205,9 @@ class ARROW_EXPORT RecordBatchFileReader
   /// \param[in] executor Optionally, an executor to use for decoding record
   ///     batches. This is generally only a benefit for very wide and/or
   ///     compressed batches.
+  ///
+  /// See IpcReadOptions::batch_readahead to read and decode batches ahead of
+  /// consumption.
   virtual Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
       const bool coalesce = false,
       const io::IOContext& io_context = io::default_io_context(),
@@ -53,6 +53,13 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Whether to parse with the structural index parser instead of RapidJSON
+  ///
+  /// The structural index parser first locates all structural characters of
+  /// a block using SIMD instructions (if available), then walks them without
+  /// examining the bytes in between.  It is typically faster on large blocks.
+  bool use_structural_index = false;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
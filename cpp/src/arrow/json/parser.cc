@@ -31,6 +31,7 @@
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/json/structural_index.h"
 #include "arrow/type.h"
 #include "arrow/util/bitset_stack.h"
 #include "arrow/util/checked_cast.h"
@@ -641,10 +642,11 @@ class HandlerBase : public BlockParser,
   /// @}
 
   /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  Status Initialize(const ParseOptions& options) {
+    use_structural_index_ = options.use_structural_index;
     auto type = struct_({});
-    if (s) {
-      type = struct_(s->fields());
+    if (options.explicit_schema) {
+      type = struct_(options.explicit_schema->fields());
     }
     return builder_set_.MakeBuilder(*type, 0, &builder_);
   }
@@ -706,11 +708,30 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (use_structural_index_ && json->size() <= std::numeric_limits<uint32_t>::max()) {
+      return DoParseStructural(handler, json->data(), json->size());
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
   }
 
+  template <typename Handler>
+  Status DoParseStructural(Handler& handler, const uint8_t* data, int64_t size) {
+    // Skip a byte order mark, as rj::EncodedInputStream does
+    if (size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF) {
+      data += 3;
+      size -= 3;
+    }
+    const auto size32 = static_cast<uint32_t>(size);
+    // The only error is the block ending inside a string, which is reported in
+    // the row it occurs in once the preceding rows are parsed
+    const Status indexed = FindStructuralIndices(data, size32, &structural_indices_);
+    StructuralReader<Handler> reader(data, size32, structural_indices_,
+                                     /*ends_in_string=*/!indexed.ok());
+    return reader.Parse(&handler, &num_rows_);
+  }
+
   /// \defgroup handlerbase-append-methods append non-nested values
   ///
   /// @{
@@ -845,6 +866,9 @@ class HandlerBase : public BlockParser,
   // top of this stack == field_index_
   std::vector<int> field_index_stack_;
   StringBuilder scalar_values_builder_;
+  bool use_structural_index_ = false;
+  // reused across calls to Parse() by the structural parser
+  std::vector<uint32_t> structural_indices_;
 };
 
 template <UnexpectedFieldBehavior>
@@ -1088,7 +1112,7 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
@@ -250,5 +250,75 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+class BlockParserStructuralIndex : public ::testing::Test {
+ public:
+  ParseOptions Options() {
+    auto options = ParseOptions::Defaults();
+    options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+    options.use_structural_index = true;
+    return options;
+  }
+};
+
+TEST_F(BlockParserStructuralIndex, Basics) {
+  AssertParseColumns(
+      Options(), scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST_F(BlockParserStructuralIndex, Nested) {
+  AssertParseColumns(Options(), nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, {}, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST_F(BlockParserStructuralIndex, Null) {
+  AssertParseColumns(
+      Options(), null_src(),
+      {field("plain", null()), field("list1", list(null())), field("list2", list(null())),
+       field("struct", struct_({field("plain", null())}))},
+      {"[null, null]", "[[], []]", "[[], [null]]",
+       R"([{"plain": null}, {"plain": null}])"});
+}
+
+TEST_F(BlockParserStructuralIndex, Escapes) {
+  AssertParseColumns(
+      Options(),
+      R"({"a": "\"\\\/\b\f\n\r\t", "b\u0041": "\ud83d\ude00"}
+{"a": "\\\"\\", "bA": "x\u00e9y"})",
+      {field("a", utf8()), field("bA", utf8())},
+      {R"(["\"\\/\b\f\n\r\t", "\\\"\\"])",
+       "[\"\xf0\x9f\x98\x80\", \"x\xc3\xa9y\"]"});
+}
+
+TEST_F(BlockParserStructuralIndex, NumbersAndLiterals) {
+  AssertParseColumns(
+      Options(), "\xef\xbb\xbf{\"n\":-0.5e+3,\"b\":true}{\"n\":NaN}\n{\"n\":-Infinity}",
+      {field("n", utf8()), field("b", boolean())},
+      {R"(["-0.5e+3", "NaN", "-Infinity"])", "[true, null, null]"});
+}
+
+TEST_F(BlockParserStructuralIndex, SameErrorsAsRapidJSON) {
+  for (auto src : {"{\"a\":}", "{\"a\" 1}", "{\"a\":1,}", "{\"a\":[1 2]}",
+                   "{\"a\":tru}", "{\"a\":\"\\x\"}", "{\"a\":1}\n{\"a\":2} x",
+                   "{\"a\":1", "{\"a\":\"\\ud800\"}", "{\"a\":1.}", "{\"a\":1e}",
+                   "{\"a\":01}", "{\"a\":nulll}", "{\"a\":[1.5.3]}", "{\"a\":Infinit}",
+                   "{\"a\":1}\n{\"a\":\"b", "{\"a\":\"b\\"}) {
+    ARROW_SCOPED_TRACE("src = ", src);
+    auto options = Options();
+    std::shared_ptr<Array> parsed;
+    Status error = ParseFromString(options, src, &parsed);
+    ASSERT_RAISES(Invalid, error);
+    options.use_structural_index = false;
+    Status expected = ParseFromString(options, src, &parsed);
+    ASSERT_EQ(expected.message(), error.message());
+  }
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -42,11 +42,47 @@ namespace arrow {
 using util::string_view;
 
 using internal::checked_cast;
+using internal::Executor;
 using internal::GetCpuThreadPool;
 using internal::TaskGroup;
 using internal::ThreadPool;
 
 namespace json {
+namespace {
+
+// Parse (partial + completion + whole), which is a sequence of entire JSON objects
+Result<std::shared_ptr<Array>> ParseBlock(const std::shared_ptr<Buffer>& partial,
+                                          const std::shared_ptr<Buffer>& completion,
+                                          const std::shared_ptr<Buffer>& whole,
+                                          const ParseOptions& parse_options,
+                                          MemoryPool* pool) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+}  // namespace
 
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
@@ -131,30 +167,8 @@ class TableReaderImpl : public TableReader,
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
-    }
-
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
+    ARROW_ASSIGN_OR_RAISE(auto parsed,
+                          ParseBlock(partial, completion, whole, parse_options_, pool_));
     builder_->Insert(block_index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -192,6 +206,286 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+/////////////////////////////////////////////////////////////////////////
+// Streaming reader
+
+namespace {
+
+struct ChunkedBlock {
+  // (partial + completion + whole) is a sequence of entire JSON objects
+  std::shared_ptr<Buffer> partial;
+  std::shared_ptr<Buffer> completion;
+  std::shared_ptr<Buffer> whole;
+  int64_t block_index;
+};
+
+}  // namespace
+}  // namespace json
+
+template <>
+struct IterationTraits<json::ChunkedBlock> {
+  static json::ChunkedBlock End() { return json::ChunkedBlock{{}, {}, {}, -1}; }
+  static bool IsEnd(const json::ChunkedBlock& val) { return val.block_index < 0; }
+};
+
+namespace json {
+namespace {
+
+// A transformer turning a stream of buffers into a stream of chunked blocks.
+// Since the last block must be processed with Chunker::ProcessFinal, each buffer
+// is only chunked once the next one (or the end of the stream) is known.
+class BlockChunker {
+ public:
+  explicit BlockChunker(std::unique_ptr<Chunker> chunker)
+      : chunker_(std::move(chunker)), partial_(std::make_shared<Buffer>("")) {}
+
+  static AsyncGenerator<ChunkedBlock> MakeAsync(
+      AsyncGenerator<std::shared_ptr<Buffer>> buffer_generator,
+      std::unique_ptr<Chunker> chunker) {
+    auto block_chunker = std::make_shared<BlockChunker>(std::move(chunker));
+    // Wrap shared pointer in callable
+    Transformer<std::shared_ptr<Buffer>, ChunkedBlock> block_chunker_fn =
+        [block_chunker](std::shared_ptr<Buffer> next) {
+          return (*block_chunker)(std::move(next));
+        };
+    return MakeTransformedGenerator(std::move(buffer_generator), block_chunker_fn);
+  }
+
+  Result<TransformFlow<ChunkedBlock>> operator()(std::shared_ptr<Buffer> next_buffer) {
+    if (buffer_ == nullptr) {
+      if (next_buffer == nullptr) {
+        // EOF
+        return TransformFinish();
+      }
+      // First buffer: wait for the next one before chunking it
+      buffer_ = std::move(next_buffer);
+      return TransformSkip();
+    }
+
+    std::shared_ptr<Buffer> whole, completion, next_partial;
+    if (next_buffer == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, buffer_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, buffer_, &completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+
+    ChunkedBlock block{std::move(partial_), std::move(completion), std::move(whole),
+                       block_index_++};
+    partial_ = std::move(next_partial);
+    buffer_ = std::move(next_buffer);
+    return TransformYield(std::move(block));
+  }
+
+ private:
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<Buffer> partial_, buffer_;
+  int64_t block_index_ = 0;
+};
+
+// Parse and convert a block into a RecordBatch.  If unexpected fields are
+// type-inferred, the batch's schema is that of the block alone.
+Result<std::shared_ptr<RecordBatch>> DecodeBlock(const ChunkedBlock& block,
+                                                 const ParseOptions& parse_options,
+                                                 MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(block.partial, block.completion,
+                                                block.whole, parse_options, pool));
+
+  auto type = parse_options.explicit_schema
+                  ? struct_(parse_options.explicit_schema->fields())
+                  : struct_({});
+  auto promotion_graph =
+      parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+          ? GetPromotionGraph()
+          : nullptr;
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool, promotion_graph,
+                                        type, &builder));
+
+  builder->Insert(0, field("", parsed->type()), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  const auto& converted = checked_cast<const StructArray&>(*converted_chunked->chunk(0));
+
+  std::vector<std::shared_ptr<Array>> columns(converted.num_fields());
+  for (int i = 0; i < converted.num_fields(); ++i) {
+    columns[i] = converted.field(i);
+  }
+  return RecordBatch::Make(schema(converted.type()->fields()), converted.length(),
+                           std::move(columns));
+}
+
+class StreamingReaderImpl : public StreamingReader,
+                            public std::enable_shared_from_this<StreamingReaderImpl> {
+ public:
+  StreamingReaderImpl(io::IOContext io_context, Executor* cpu_executor,
+                      const ReadOptions& read_options, const ParseOptions& parse_options)
+      : io_context_(std::move(io_context)),
+        cpu_executor_(cpu_executor),
+        read_options_(read_options),
+        parse_options_(parse_options) {}
+
+  Future<std::shared_ptr<StreamingReader>> Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+
+    ARROW_ASSIGN_OR_RAISE(auto bg_it, MakeBackgroundGenerator(std::move(istream_it),
+                                                              io_context_.executor()));
+    auto transferred_it = MakeTransferredGenerator(bg_it, cpu_executor_);
+    block_generator_ =
+        BlockChunker::MakeAsync(std::move(transferred_it), MakeChunker(parse_options_));
+
+    auto self = shared_from_this();
+    // Infer schema from first batch
+    return ReadFirstBatch(self).Then(
+        [self](const std::shared_ptr<RecordBatch>& first_batch)
+            -> Result<std::shared_ptr<StreamingReader>> {
+          DCHECK_NE(self->schema_, nullptr);
+          if (first_batch == nullptr) {
+            self->eof_ = true;
+          } else {
+            self->pending_batch_ = first_batch;
+            self->MakeBatchGenerator();
+          }
+          return self;
+        });
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    auto next_fut = ReadNextAsync();
+    auto next_result = next_fut.result();
+    return std::move(next_result).Value(batch);
+  }
+
+  Future<std::shared_ptr<RecordBatch>> ReadNextAsync() override {
+    if (eof_) {
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr);
+    }
+    if (io_context_.stop_token().IsStopRequested()) {
+      eof_ = true;
+      return io_context_.stop_token().Poll();
+    }
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(batch);
+    }
+    auto self = shared_from_this();
+    return batch_generator_().Then(
+        [self](const std::shared_ptr<RecordBatch>& batch)
+            -> Future<std::shared_ptr<RecordBatch>> {
+          if (batch == nullptr) {
+            self->eof_ = true;
+          } else if (batch->num_rows() == 0) {
+            return self->ReadNextAsync();
+          }
+          return Future<std::shared_ptr<RecordBatch>>::MakeFinished(batch);
+        },
+        [self](const Status& err) -> Result<std::shared_ptr<RecordBatch>> {
+          self->eof_ = true;
+          return err;
+        });
+  }
+
+ private:
+  // Decode blocks until one yields rows, inferring the schema as we go
+  Future<std::shared_ptr<RecordBatch>> ReadFirstBatch(
+      std::shared_ptr<StreamingReaderImpl> self) {
+    return block_generator_().Then(
+        [self](const ChunkedBlock& block) -> Future<std::shared_ptr<RecordBatch>> {
+          if (IsIterationEnd(block)) {
+            if (self->schema_ == nullptr) {
+              return Status::Invalid("Empty JSON file");
+            }
+            return Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr);
+          }
+          ARROW_ASSIGN_OR_RAISE(
+              auto batch,
+              DecodeBlock(block, self->parse_options_, self->io_context_.pool()));
+          self->schema_ = batch->schema();
+          if (batch->num_rows() == 0) {
+            return self->ReadFirstBatch(self);
+          }
+          return Future<std::shared_ptr<RecordBatch>>::MakeFinished(std::move(batch));
+        });
+  }
+
+  // Decode the remaining blocks against the inferred schema.  Since blocks don't
+  // depend on each other anymore, they are decoded in parallel if use_threads is
+  // true, up to the capacity of the CPU executor ahead of consumption.
+  void MakeBatchGenerator() {
+    auto parse_options = parse_options_;
+    parse_options.explicit_schema = schema_;
+    if (parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    auto pool = io_context_.pool();
+
+    if (!read_options_.use_threads) {
+      std::function<Result<std::shared_ptr<RecordBatch>>(const ChunkedBlock&)> decode =
+          [parse_options, pool](const ChunkedBlock& block) {
+            return DecodeBlock(block, parse_options, pool);
+          };
+      batch_generator_ = MakeMappedGenerator(std::move(block_generator_), decode);
+      return;
+    }
+
+    // The lambdas must not capture `this`, as the generator is owned by the reader
+    auto cpu_executor = cpu_executor_;
+    std::function<Future<std::shared_ptr<RecordBatch>>(const ChunkedBlock&)> decode =
+        [parse_options, pool, cpu_executor](const ChunkedBlock& block) {
+          return DeferNotOk(cpu_executor->Submit([parse_options, pool, block] {
+            return DecodeBlock(block, parse_options, pool);
+          }));
+        };
+    // The mapped generator pulls blocks serially, so it is safe to read ahead
+    // from it even though chunking isn't async-reentrant
+    auto decoded = MakeMappedGenerator(std::move(block_generator_), decode);
+    batch_generator_ =
+        MakeReadaheadGenerator(std::move(decoded), cpu_executor_->GetCapacity());
+  }
+
+  io::IOContext io_context_;
+  Executor* cpu_executor_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+
+  AsyncGenerator<ChunkedBlock> block_generator_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> batch_generator_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> pending_batch_;
+  bool eof_ = false;
+};
+
+}  // namespace
+
+Future<std::shared_ptr<StreamingReader>> StreamingReader::MakeAsync(
+    io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+    internal::Executor* cpu_executor, const ReadOptions& read_options,
+    const ParseOptions& parse_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(io_context, cpu_executor,
+                                                      read_options, parse_options);
+  return reader->Init(std::move(input));
+}
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto cpu_executor = GetCpuThreadPool();
+  auto reader_fut = MakeAsync(io_context, std::move(input), cpu_executor, read_options,
+                              parse_options);
+  auto reader_result = reader_fut.result();
+  ARROW_ASSIGN_OR_RAISE(auto reader, reader_result);
+  return reader;
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
@@ -19,9 +19,12 @@
 
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -34,9 +37,9 @@ class RecordBatch;
 class Array;
 class DataType;
 
-namespace io {
-class InputStream;
-}  // namespace io
+namespace internal {
+class Executor;
+}  // namespace internal
 
 namespace json {
 
@@ -65,6 +68,42 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file incrementally
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// It is chunked into blocks of `ReadOptions::block_size` bytes, and each block
+/// is parsed and converted into a RecordBatch.  Batches are always returned in
+/// file order.
+///
+/// Caveats:
+/// - If `ReadOptions::use_threads` is true, up to the capacity of the CPU
+///   executor blocks are parsed in parallel ahead of consumption.
+/// - Type inference is done on the first non-empty block and the schema is
+///   frozen afterwards: fields that are not in the inferred schema are ignored
+///   or cause an error (depending on `ParseOptions::unexpected_field_behavior`
+///   being Ignore or not), and values that don't fit the inferred type cause an
+///   error.  To make sure the right data types are inferred, either set
+///   `ReadOptions::block_size` to a large enough value, or use
+///   `ParseOptions::explicit_schema` to set the desired data types explicitly.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  virtual Future<std::shared_ptr<RecordBatch>> ReadNextAsync() = 0;
+
+  /// Create a StreamingReader instance
+  ///
+  /// This involves some I/O as the first batch must be loaded during the creation
+  /// process so it is returned as a future
+  static Future<std::shared_ptr<StreamingReader>> MakeAsync(
+      io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+      internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&);
+
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+      const ReadOptions&, const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
@@ -26,7 +26,9 @@
 #include "arrow/json/reader.h"
 #include "arrow/json/test_common.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace json {
@@ -274,5 +276,113 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    ASSERT_OK(MakeStream(input, &input_));
+    ASSERT_OK_AND_ASSIGN(reader_, StreamingReader::Make(io::default_io_context(), input_,
+                                                        read_options_, parse_options_));
+  }
+
+  std::string RowsOfA(int64_t count) {
+    std::string json;
+    for (int64_t i = 0; i < count; ++i) {
+      json += "{\"a\":" + std::to_string(i) + "}\n";
+    }
+    return json;
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<io::InputStream> input_;
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  read_options_.use_threads = GetParam();
+  ASSERT_OK(MakeStream("", &input_));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(io::default_io_context(), input_,
+                                               read_options_, parse_options_));
+}
+
+TEST_P(StreamingReaderTest, Basics) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  SetUpReader(scalars_only_src());
+
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*schema, *reader_->schema());
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader_->ReadAll(&table));
+  auto expected_table = Table::Make(
+      schema, {
+                  ArrayFromJSON(schema->field(0)->type(), "[3.5, 3.25, 3.125, 0.0]"),
+                  ArrayFromJSON(schema->field(1)->type(), "[false, null, null, true]"),
+                  ArrayFromJSON(schema->field(2)->type(),
+                                "[\"thing\", null, \"\xe5\xbf\x8d\", null]"),
+              });
+  AssertTablesEqual(*expected_table, *table);
+}
+
+TEST_P(StreamingReaderTest, MultipleBlocksInOrder) {
+  int64_t count = 1 << 10;
+  read_options_.block_size = static_cast<int>(count / 2);  // about two dozen blocks
+  SetUpReader(RowsOfA(count));
+
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+
+  int64_t expected = 0;
+  int64_t num_batches = 0;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    auto batch_fut = reader_->ReadNextAsync();
+    ASSERT_FINISHES_OK_AND_ASSIGN(batch, batch_fut);
+    if (batch == nullptr) break;
+    ASSERT_GT(batch->num_rows(), 0);
+    AssertSchemaEqual(*reader_->schema(), *batch->schema());
+    const auto& column = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < column.length(); ++i) {
+      ASSERT_EQ(column.Value(i), expected) << " at index " << i;
+      ++expected;
+    }
+    ++num_batches;
+  }
+  ASSERT_EQ(expected, count);
+  ASSERT_GT(num_batches, 1);
+
+  // Reading past the end keeps returning null
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, SchemaFrozenAfterFirstBlock) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  read_options_.block_size = 64;
+  SetUpReader(RowsOfA(64) + R"({"a": 64, "b": "unexpected"})" + "\n");
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  while ((st = reader_->ReadNext(&batch)).ok() && batch != nullptr) {
+  }
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  // Unexpected fields may also be dropped
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  SetUpReader(RowsOfA(64) + R"({"a": 64, "b": "unexpected"})" + "\n");
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader_->ReadAll(&table));
+  ASSERT_EQ(table->num_rows(), 65);
+  ASSERT_EQ(table->num_columns(), 1);
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/json/structural_index.h"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "arrow/json/structural_index_internal.h"
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace json {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
+namespace {
+
+constexpr uint8_t kQuoteClass = 1;
+constexpr uint8_t kBackslashClass = 2;
+constexpr uint8_t kOpClass = 4;
+constexpr uint8_t kWhitespaceClass = 8;
+
+std::array<uint8_t, 256> MakeCharacterClasses() {
+  std::array<uint8_t, 256> classes{};
+  classes['"'] = kQuoteClass;
+  classes['\\'] = kBackslashClass;
+  for (uint8_t c : {'{', '}', '[', ']', ':', ','}) {
+    classes[c] = kOpClass;
+  }
+  for (uint8_t c : {' ', '\t', '\n', '\r'}) {
+    classes[c] = kWhitespaceClass;
+  }
+  return classes;
+}
+
+struct TableClassifier {
+  static CharacterMasks Classify(const uint8_t* data) {
+    static const std::array<uint8_t, 256> classes = MakeCharacterClasses();
+    CharacterMasks masks{0, 0, 0, 0};
+    for (int i = 0; i < 64; ++i) {
+      const uint64_t c = classes[data[i]];
+      masks.quote |= (c & kQuoteClass) << i;
+      masks.backslash |= ((c & kBackslashClass) >> 1) << i;
+      masks.op |= ((c & kOpClass) >> 2) << i;
+      masks.whitespace |= ((c & kWhitespaceClass) >> 3) << i;
+    }
+    return masks;
+  }
+};
+
+struct FindStructuralIndicesDynamicFunction {
+  using FunctionType = decltype(&FindStructuralIndicesDefault);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, FindStructuralIndicesDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, FindStructuralIndicesAvx2 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+Status FindStructuralIndicesDefault(const uint8_t* data, uint32_t size,
+                                    std::vector<uint32_t>* indices) {
+  return FindStructuralIndicesImpl<TableClassifier>(data, size, indices);
+}
+
+Status FindStructuralIndices(const uint8_t* data, uint32_t size,
+                             std::vector<uint32_t>* indices) {
+  static DynamicDispatch<FindStructuralIndicesDynamicFunction> dispatch;
+  return dispatch.func(data, size, indices);
+}
+
+}  // namespace json
+}  // namespace arrow
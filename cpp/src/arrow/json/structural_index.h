@@ -0,0 +1,468 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/json/parser.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+/// \brief Find the structural characters of a block of JSON
+///
+/// This is the first stage of a two-stage parser in the style of simdjson: the
+/// block is classified 64 bytes at a time into bitmasks (using SIMD instructions
+/// where available), from which escapes and strings are resolved with bitwise
+/// arithmetic alone.  The offsets of the following characters are written to
+/// `indices`:
+/// - the operators `{`, `}`, `[`, `]`, `:` and `,` outside of strings
+/// - the opening quote of every string
+/// - the first character of every other scalar (numbers, `true`, `null`...)
+///
+/// Backslashes escape quotes even outside of strings; such input isn't valid JSON
+/// and is rejected by StructuralReader.  Returns an error if the block ends inside
+/// a string, in which case `indices` is still complete: its last index is the
+/// opening quote of the unterminated string.
+ARROW_EXPORT
+Status FindStructuralIndices(const uint8_t* data, uint32_t size,
+                             std::vector<uint32_t>* indices);
+
+/// \brief Drive a handler over a block of JSON using its structural indices
+///
+/// This is the second stage of the structural parser.  Handler must provide the
+/// subset of the RapidJSON SAX interface used by BlockParser (Null, Bool,
+/// RawNumber, String, StartObject, Key, EndObject, StartArray and EndArray) and
+/// an Error() method returning the Status of a failed callback.  Callbacks are
+/// invoked exactly as RapidJSON does when parsing with kParseIterativeFlag,
+/// kParseNanAndInfFlag, kParseStopWhenDoneFlag and kParseNumbersAsStringsFlag;
+/// in particular strings and keys are unescaped and numbers are passed verbatim.
+/// Syntax errors are reported with RapidJSON's messages, except that numbers
+/// are only checked for syntax: RapidJSON also rejects those whose magnitude
+/// overflows a double.
+///
+/// If FindStructuralIndices() found the block to end inside a string, pass
+/// `ends_in_string` so that the rows preceding the string are parsed and the
+/// error is reported in the row it occurs in.
+template <typename Handler>
+class StructuralReader {
+ public:
+  StructuralReader(const uint8_t* data, uint32_t size,
+                   const std::vector<uint32_t>& indices, bool ends_in_string = false)
+      : data_(reinterpret_cast<const char*>(data)),
+        size_(size),
+        indices_(indices.data()),
+        num_indices_(indices.size()),
+        ends_in_string_(ends_in_string) {}
+
+  /// \brief Parse every top-level value in the block, each of which is a row
+  Status Parse(Handler* handler, int32_t* num_rows) {
+    for (; *num_rows < kMaxParserNumRows; ++*num_rows) {
+      if (pos_ == num_indices_) {
+        // parsed all objects, finish
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ParseValue(handler, *num_rows));
+    }
+    return Status::Invalid("Exceeded maximum rows");
+  }
+
+ private:
+  enum class State { kValue, kMember, kAfterValue };
+
+  struct Container {
+    bool is_object;
+    uint32_t size;
+  };
+
+  Status ParseValue(Handler* handler, int32_t row) {
+    containers_.clear();
+    auto state = State::kValue;
+    while (true) {
+      switch (state) {
+        case State::kValue: {
+          if (ARROW_PREDICT_FALSE(pos_ == num_indices_)) {
+            return SyntaxError("Invalid value.", row);
+          }
+          const char c = rest_ != nullptr ? *rest_ : Current();
+          if (c == '{') {
+            if (ARROW_PREDICT_FALSE(!handler->StartObject())) {
+              return HandlerError(handler);
+            }
+            ++pos_;
+            if (pos_ != num_indices_ && Current() == '}') {
+              ++pos_;
+              if (ARROW_PREDICT_FALSE(!handler->EndObject(0))) {
+                return HandlerError(handler);
+              }
+              state = State::kAfterValue;
+            } else {
+              containers_.push_back({true, 0});
+              state = State::kMember;
+            }
+          } else if (c == '[') {
+            if (ARROW_PREDICT_FALSE(!handler->StartArray())) {
+              return HandlerError(handler);
+            }
+            ++pos_;
+            if (pos_ != num_indices_ && Current() == ']') {
+              ++pos_;
+              if (ARROW_PREDICT_FALSE(!handler->EndArray(0))) {
+                return HandlerError(handler);
+              }
+              state = State::kAfterValue;
+            } else {
+              containers_.push_back({false, 0});
+            }
+          } else if (c == '"') {
+            util::string_view value;
+            RETURN_NOT_OK(ReadString(&value, row));
+            if (ARROW_PREDICT_FALSE(!handler->String(
+                    value.data(), static_cast<uint32_t>(value.size()), true))) {
+              return HandlerError(handler);
+            }
+            state = State::kAfterValue;
+          } else {
+            RETURN_NOT_OK(ReadAtom(handler, row));
+            state = State::kAfterValue;
+          }
+          break;
+        }
+
+        case State::kMember: {
+          if (ARROW_PREDICT_FALSE(pos_ == num_indices_ || Current() != '"')) {
+            return SyntaxError("Missing a name for object member.", row);
+          }
+          util::string_view key;
+          RETURN_NOT_OK(ReadString(&key, row));
+          if (ARROW_PREDICT_FALSE(
+                  !handler->Key(key.data(), static_cast<uint32_t>(key.size()), true))) {
+            return HandlerError(handler);
+          }
+          if (ARROW_PREDICT_FALSE(pos_ == num_indices_ || Current() != ':')) {
+            return SyntaxError("Missing a colon after a name of object member.", row);
+          }
+          ++pos_;
+          state = State::kValue;
+          break;
+        }
+
+        case State::kAfterValue: {
+          if (containers_.empty()) {
+            return Status::OK();
+          }
+          auto& container = containers_.back();
+          ++container.size;
+          const char close = container.is_object ? '}' : ']';
+          if (ARROW_PREDICT_FALSE(pos_ == num_indices_ ||
+                                  (Current() != ',' && Current() != close))) {
+            return MissingCommaError(row);
+          }
+          if (Current() == ',') {
+            ++pos_;
+            state = container.is_object ? State::kMember : State::kValue;
+            break;
+          }
+          ++pos_;
+          const auto size = container.size;
+          const bool is_object = container.is_object;
+          containers_.pop_back();
+          if (ARROW_PREDICT_FALSE(is_object ? !handler->EndObject(size)
+                                            : !handler->EndArray(size))) {
+            return HandlerError(handler);
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  char Current() const { return data_[indices_[pos_]]; }
+
+  // The end of the current token, i.e. the offset of the next structural character
+  // with any whitespace preceding it trimmed
+  uint32_t TokenEnd() const {
+    uint32_t end = pos_ + 1 == num_indices_ ? size_ : indices_[pos_ + 1];
+    while (IsWhitespace(data_[end - 1])) {
+      --end;
+    }
+    return end;
+  }
+
+  static bool IsWhitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  Status ReadString(util::string_view* out, int32_t row) {
+    const uint32_t begin = indices_[pos_] + 1;
+    const bool unterminated = ends_in_string_ && pos_ + 1 == num_indices_;
+    // The closing quote was found by FindStructuralIndices
+    const uint32_t end = unterminated ? size_ : TokenEnd() - 1;
+    DCHECK(unterminated || data_[end] == '"');
+    ++pos_;
+
+    const char* p = data_ + begin;
+    const char* stop = data_ + end;
+    while (p != stop && *p != '\\' && static_cast<uint8_t>(*p) >= 0x20) {
+      ++p;
+    }
+    if (ARROW_PREDICT_TRUE(p == stop && !unterminated)) {
+      *out = util::string_view(data_ + begin, end - begin);
+      return Status::OK();
+    }
+
+    // Slow path: unescape into scratch storage
+    scratch_.assign(data_ + begin, p);
+    while (p != stop) {
+      const char c = *p++;
+      if (ARROW_PREDICT_FALSE(static_cast<uint8_t>(c) < 0x20)) {
+        // RapidJSON reads NUL as the end of its input
+        return SyntaxError(c == '\0' ? "Missing a closing quotation mark in string."
+                                     : "Invalid encoding in string.",
+                           row);
+      }
+      if (c != '\\') {
+        scratch_.push_back(c);
+        continue;
+      }
+      // FindStructuralIndices guarantees an escape isn't the last character of
+      // a terminated string
+      if (ARROW_PREDICT_FALSE(p == stop)) {
+        return SyntaxError("Invalid escape character in string.", row);
+      }
+      switch (*p++) {
+        case '"':
+          scratch_.push_back('"');
+          break;
+        case '\\':
+          scratch_.push_back('\\');
+          break;
+        case '/':
+          scratch_.push_back('/');
+          break;
+        case 'b':
+          scratch_.push_back('\b');
+          break;
+        case 'f':
+          scratch_.push_back('\f');
+          break;
+        case 'n':
+          scratch_.push_back('\n');
+          break;
+        case 'r':
+          scratch_.push_back('\r');
+          break;
+        case 't':
+          scratch_.push_back('\t');
+          break;
+        case 'u': {
+          uint32_t codepoint;
+          RETURN_NOT_OK(ReadHex4(&p, stop, &codepoint, row));
+          if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            // Handle UTF-16 surrogate pair
+            uint32_t low;
+            if (ARROW_PREDICT_FALSE(stop - p < 2 || p[0] != '\\' || p[1] != 'u')) {
+              return SyntaxError("The surrogate pair in string is invalid.", row);
+            }
+            p += 2;
+            RETURN_NOT_OK(ReadHex4(&p, stop, &low, row));
+            if (ARROW_PREDICT_FALSE(low < 0xDC00 || low > 0xDFFF)) {
+              return SyntaxError("The surrogate pair in string is invalid.", row);
+            }
+            codepoint = (((codepoint - 0xD800) << 10) | (low - 0xDC00)) + 0x10000;
+          }
+          AppendUTF8(codepoint);
+          break;
+        }
+        default:
+          return SyntaxError("Invalid escape character in string.", row);
+      }
+    }
+    if (ARROW_PREDICT_FALSE(unterminated)) {
+      return SyntaxError("Missing a closing quotation mark in string.", row);
+    }
+    *out = scratch_;
+    return Status::OK();
+  }
+
+  Status ReadHex4(const char** p, const char* stop, uint32_t* out, int32_t row) {
+    if (ARROW_PREDICT_FALSE(stop - *p < 4)) {
+      return SyntaxError("Incorrect hex digit after \\u escape in string.", row);
+    }
+    uint32_t codepoint = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = *(*p)++;
+      codepoint <<= 4;
+      if (c >= '0' && c <= '9') {
+        codepoint += c - '0';
+      } else if (c >= 'A' && c <= 'F') {
+        codepoint += c - 'A' + 10;
+      } else if (c >= 'a' && c <= 'f') {
+        codepoint += c - 'a' + 10;
+      } else {
+        return SyntaxError("Incorrect hex digit after \\u escape in string.", row);
+      }
+    }
+    *out = codepoint;
+    return Status::OK();
+  }
+
+  void AppendUTF8(uint32_t codepoint) {
+    if (codepoint <= 0x7F) {
+      scratch_.push_back(static_cast<char>(codepoint));
+    } else if (codepoint <= 0x7FF) {
+      scratch_.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+      scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint <= 0xFFFF) {
+      scratch_.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+      scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+      scratch_.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+      scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+      scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+  }
+
+  // Read null, true, false or a number.  Like RapidJSON, the longest valid
+  // prefix of the token is read as the value; the rest of the token follows it.
+  Status ReadAtom(Handler* handler, int32_t row) {
+    const char* begin = rest_ != nullptr ? rest_ : data_ + indices_[pos_];
+    const char* end = data_ + TokenEnd();
+    const char* p = begin;
+
+    bool ok;
+    if (*p == 'n' || *p == 't' || *p == 'f') {
+      const util::string_view literal = *p == 'n' ? "null" : *p == 't' ? "true" : "false";
+      if (util::string_view(p, std::min<size_t>(end - p, literal.size())) != literal) {
+        return SyntaxError("Invalid value.", row);
+      }
+      p += literal.size();
+      ok = *begin == 'n' ? handler->Null() : handler->Bool(*begin == 't');
+    } else {
+      RETURN_NOT_OK(ReadNumber(&p, end, row));
+      ok = handler->RawNumber(begin, static_cast<uint32_t>(p - begin), false);
+    }
+    if (ARROW_PREDICT_FALSE(!ok)) {
+      return HandlerError(handler);
+    }
+
+    if (ARROW_PREDICT_TRUE(p == end)) {
+      rest_ = nullptr;
+      ++pos_;
+      return Status::OK();
+    }
+    if (!containers_.empty()) {
+      return MissingCommaError(row);
+    }
+    // The value was a whole row, the rest of the token is the next one
+    rest_ = p;
+    return Status::OK();
+  }
+
+  // Advance past a number, including NaN and (-)Inf(inity), following
+  // RapidJSON's grammar and errors
+  Status ReadNumber(const char** pos, const char* end, int32_t row) {
+    const char* p = *pos;
+    auto consume = [&](char c) {
+      if (p != end && *p == c) {
+        ++p;
+        return true;
+      }
+      return false;
+    };
+    auto at_digit = [&] { return p != end && IsDigit(*p); };
+
+    consume('-');
+    if (consume('0')) {
+    } else if (at_digit()) {
+      while (at_digit()) ++p;
+    } else if (consume('N')) {
+      if (!(consume('a') && consume('N'))) {
+        return SyntaxError("Invalid value.", row);
+      }
+    } else if (consume('I')) {
+      if (!(consume('n') && consume('f'))) {
+        return SyntaxError("Invalid value.", row);
+      }
+      if (p != end && *p == 'i' &&
+          !(consume('i') && consume('n') && consume('i') && consume('t') &&
+            consume('y'))) {
+        return SyntaxError("Invalid value.", row);
+      }
+    } else {
+      return SyntaxError("Invalid value.", row);
+    }
+
+    if (consume('.')) {
+      if (!at_digit()) {
+        return SyntaxError("Miss fraction part in number.", row);
+      }
+      while (at_digit()) ++p;
+    }
+    if (consume('e') || consume('E')) {
+      if (!consume('+')) consume('-');
+      if (!at_digit()) {
+        return SyntaxError("Miss exponent in number.", row);
+      }
+      while (at_digit()) ++p;
+    }
+    *pos = p;
+    return Status::OK();
+  }
+
+  Status MissingCommaError(int32_t row) {
+    return SyntaxError(containers_.back().is_object
+                           ? "Missing a comma or '}' after an object member."
+                           : "Missing a comma or ']' after an array element.",
+                       row);
+  }
+
+  Status HandlerError(Handler* handler) {
+    RETURN_NOT_OK(handler->Error());
+    return Status::Invalid("JSON parse error: Terminate parsing due to Handler error.");
+  }
+
+  Status SyntaxError(const char* message, int32_t row) {
+    return Status::Invalid("JSON parse error: ", message, " in row ", row);
+  }
+
+  const char* data_;
+  uint32_t size_;
+  const uint32_t* indices_;
+  size_t num_indices_;
+  size_t pos_ = 0;
+  // If not null, the rest of the token at pos_ which is yet to be read
+  const char* rest_ = NULLPTR;
+  bool ends_in_string_;
+  std::vector<Container> containers_;
+  std::string scratch_;
+};
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <immintrin.h>
+
+#include "arrow/json/structural_index_internal.h"
+
+namespace arrow {
+namespace json {
+
+namespace {
+
+struct Avx2Classifier {
+  static uint64_t Mask(__m256i lo, __m256i hi) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(lo)) |
+           static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(hi))) << 32;
+  }
+
+  static __m256i Equals(__m256i v, char c) {
+    return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c));
+  }
+
+  static __m256i IsOp(__m256i v) {
+    // Setting bit 5 maps '[' to '{' and ']' to '}' without affecting ':' and ','
+    // (other characters mapped to '{' or '}' have it set already)
+    const __m256i lowered = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    return _mm256_or_si256(
+        _mm256_or_si256(Equals(lowered, '{'), Equals(lowered, '}')),
+        _mm256_or_si256(Equals(v, ':'), Equals(v, ',')));
+  }
+
+  static __m256i IsWhitespace(__m256i v) {
+    return _mm256_or_si256(_mm256_or_si256(Equals(v, ' '), Equals(v, '\t')),
+                           _mm256_or_si256(Equals(v, '\n'), Equals(v, '\r')));
+  }
+
+  static CharacterMasks Classify(const uint8_t* data) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    return {Mask(Equals(lo, '"'), Equals(hi, '"')),
+            Mask(Equals(lo, '\\'), Equals(hi, '\\')), Mask(IsOp(lo), IsOp(hi)),
+            Mask(IsWhitespace(lo), IsWhitespace(hi))};
+  }
+};
+
+}  // namespace
+
+Status FindStructuralIndicesAvx2(const uint8_t* data, uint32_t size,
+                                 std::vector<uint32_t>* indices) {
+  return FindStructuralIndicesImpl<Avx2Classifier>(data, size, indices);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+/// Bitmasks of the character classes of 64 bytes of JSON
+struct CharacterMasks {
+  uint64_t quote;
+  uint64_t backslash;
+  // {}[]:,
+  uint64_t op;
+  // space, \t, \n and \r
+  uint64_t whitespace;
+};
+
+/// Compute the characters escaped by a backslash, given a mask of backslashes
+///
+/// `prev_escaped` carries whether the first character of the next 64 bytes
+/// is escaped.
+inline uint64_t FindEscaped(uint64_t backslash, uint64_t* prev_escaped) {
+  constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+  // If there was overflow, pretend the first character isn't a backslash
+  backslash &= ~*prev_escaped;
+  const uint64_t follows_escape = backslash << 1 | *prev_escaped;
+  // Sequences of backslashes starting on an odd bit end on an odd bit iff
+  // they have an even length; adding flips the bits after the sequence.
+  const uint64_t odd_sequence_starts = backslash & ~kEvenBits & ~follows_escape;
+  const uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+  *prev_escaped = sequences_starting_on_even_bits < odd_sequence_starts ? 1 : 0;
+  const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+  // Every other backslashed character is escaped
+  return (kEvenBits ^ invert_mask) & follows_escape;
+}
+
+/// Bit i of the result is the parity of bits [0, i] of `mask`
+inline uint64_t PrefixXor(uint64_t mask) {
+  mask ^= mask << 1;
+  mask ^= mask << 2;
+  mask ^= mask << 4;
+  mask ^= mask << 8;
+  mask ^= mask << 16;
+  mask ^= mask << 32;
+  return mask;
+}
+
+/// \brief Find structural indices given a function classifying 64 bytes at a time
+template <typename Classifier>
+Status FindStructuralIndicesImpl(const uint8_t* data, uint32_t size,
+                                 std::vector<uint32_t>* indices) {
+  indices->clear();
+  // Every 64 bytes produce at most 64 indices
+  size_t capacity = static_cast<size_t>(size) / 8 + 64;
+  indices->resize(capacity);
+  size_t num_indices = 0;
+
+  uint64_t prev_escaped = 0;
+  uint64_t prev_in_string = 0;
+  uint64_t prev_scalar = 0;
+  uint8_t tail[64];
+
+  for (uint32_t offset = 0; offset < size; offset += 64) {
+    CharacterMasks masks;
+    if (size - offset >= 64) {
+      masks = Classifier::Classify(data + offset);
+    } else {
+      // Pad the last bytes with whitespace
+      std::memset(tail, ' ', sizeof(tail));
+      std::memcpy(tail, data + offset, size - offset);
+      masks = Classifier::Classify(tail);
+    }
+
+    const uint64_t escaped = FindEscaped(masks.backslash, &prev_escaped);
+    const uint64_t quote = masks.quote & ~escaped;
+    // Set for opening quotes and string contents, but not closing quotes
+    const uint64_t in_string = PrefixXor(quote) ^ prev_in_string;
+    prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+    const uint64_t outside = ~(in_string | quote);
+    const uint64_t scalar = outside & ~(masks.op | masks.whitespace);
+    const uint64_t scalar_starts = scalar & ~(scalar << 1 | prev_scalar);
+    prev_scalar = scalar >> 63;
+
+    uint64_t structurals = (masks.op & outside) | (quote & in_string) | scalar_starts;
+
+    if (capacity - num_indices < 64) {
+      capacity *= 2;
+      indices->resize(capacity);
+    }
+    uint32_t* out = indices->data() + num_indices;
+    while (structurals != 0) {
+      *out++ = offset + BitUtil::CountTrailingZeros(structurals);
+      structurals &= structurals - 1;
+    }
+    num_indices = out - indices->data();
+  }
+
+  indices->resize(num_indices);
+  if (prev_in_string != 0) {
+    return Status::Invalid(
+        "JSON parse error: Missing a closing quotation mark in string.");
+  }
+  return Status::OK();
+}
+
+ARROW_EXPORT
+Status FindStructuralIndicesDefault(const uint8_t* data, uint32_t size,
+                                    std::vector<uint32_t>* indices);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+ARROW_EXPORT
+Status FindStructuralIndicesAvx2(const uint8_t* data, uint32_t size,
+                                 std::vector<uint32_t>* indices);
+#endif
+
+}  // namespace json
+}  // namespace arrow
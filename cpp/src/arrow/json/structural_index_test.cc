@@ -0,0 +1,316 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/json/structural_index.h"
+#include "arrow/json/structural_index_internal.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace json {
+
+using util::string_view;
+
+static bool IsOp(char c) {
+  return c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+}
+
+static bool IsWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Straightforward byte-at-a-time reference implementation
+static std::vector<uint32_t> NaiveStructuralIndices(string_view json,
+                                                    bool* ends_in_string = nullptr) {
+  std::vector<uint32_t> indices;
+  bool in_string = false, in_scalar = false;
+  for (uint32_t i = 0; i < json.size(); ++i) {
+    const char c = json[i];
+    if (in_string) {
+      if (c == '\\') {
+        ++i;
+      } else if (c == '"') {
+        in_string = false;
+      }
+      continue;
+    }
+    if (c == '"') {
+      in_string = true;
+      in_scalar = false;
+      indices.push_back(i);
+    } else if (IsOp(c)) {
+      in_scalar = false;
+      indices.push_back(i);
+    } else if (IsWhitespace(c)) {
+      in_scalar = false;
+    } else if (!in_scalar) {
+      in_scalar = true;
+      indices.push_back(i);
+    }
+    // Escaped quotes and backslashes are part of a scalar (which can't be
+    // valid JSON) even outside of strings
+    if (c == '\\' && i + 1 < json.size() && (json[i + 1] == '"' || json[i + 1] == '\\')) {
+      ++i;
+    }
+  }
+  if (ends_in_string) {
+    *ends_in_string = in_string;
+  }
+  return indices;
+}
+
+static void AssertStructuralIndices(string_view json) {
+  ARROW_SCOPED_TRACE("json = ", json);
+  const auto data = reinterpret_cast<const uint8_t*>(json.data());
+  const auto size = static_cast<uint32_t>(json.size());
+  const auto expected = NaiveStructuralIndices(json);
+
+  std::vector<uint32_t> indices;
+  ASSERT_OK(FindStructuralIndicesDefault(data, size, &indices));
+  ASSERT_EQ(indices, expected);
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  ASSERT_OK(FindStructuralIndicesAvx2(data, size, &indices));
+  ASSERT_EQ(indices, expected);
+#endif
+  ASSERT_OK(FindStructuralIndices(data, size, &indices));
+  ASSERT_EQ(indices, expected);
+}
+
+TEST(FindStructuralIndices, Basics) {
+  AssertStructuralIndices("");
+  AssertStructuralIndices("   \n");
+  AssertStructuralIndices(R"({"a": 1, "b": [true, null, -2.5e3], "c": {}})");
+  AssertStructuralIndices("{\"a\":\"{[:,]}\"}\n{\"a\" : \"x y\"}\r\n");
+  AssertStructuralIndices(R"(["\"", "\\", "\\\"", "a\\\\\"b", "\u005c"])");
+  AssertStructuralIndices("123 abc\tdef\n\"\"");
+}
+
+TEST(FindStructuralIndices, BlockBoundaries) {
+  // Escapes, strings and scalars straddling 64 byte boundaries
+  for (size_t padding = 0; padding < 70; ++padding) {
+    const std::string spaces(padding, ' ');
+    AssertStructuralIndices(spaces + R"({"a": "\\\"\\", "b": 12345678})");
+    AssertStructuralIndices(spaces + R"(["\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\"])");
+    AssertStructuralIndices(spaces + "[" + std::string(100, '1') + ", \"" +
+                            std::string(100, 'x') + "\"]");
+  }
+}
+
+TEST(FindStructuralIndices, Random) {
+  const char alphabet[] = "{}[]:, \n\"\\\"\\ab1-";
+  std::default_random_engine engine(42);
+  std::uniform_int_distribution<int> char_dist(0, sizeof(alphabet) - 2);
+  std::uniform_int_distribution<int> length_dist(0, 300);
+  for (int i = 0; i < 500; ++i) {
+    std::string json(length_dist(engine), ' ');
+    for (auto& c : json) {
+      c = alphabet[char_dist(engine)];
+    }
+    // Close any open string (the first quote appended may be escaped)
+    bool ends_in_string;
+    NaiveStructuralIndices(json, &ends_in_string);
+    while (ends_in_string) {
+      json += '"';
+      NaiveStructuralIndices(json, &ends_in_string);
+    }
+    AssertStructuralIndices(json);
+  }
+}
+
+TEST(FindStructuralIndices, UnterminatedString) {
+  for (string_view json : {R"({"a)", R"({"a": "b\")", R"(["\\", "\"])"}) {
+    std::vector<uint32_t> indices;
+    ASSERT_RAISES(Invalid,
+                  FindStructuralIndices(reinterpret_cast<const uint8_t*>(json.data()),
+                                        static_cast<uint32_t>(json.size()), &indices));
+  }
+}
+
+// Records the callbacks it receives
+class RecordingHandler {
+ public:
+  bool Null() { return Record("null"); }
+  bool Bool(bool value) { return Record(value ? "true" : "false"); }
+  bool RawNumber(const char* data, uint32_t size, bool) {
+    return Record("n:" + std::string(data, size));
+  }
+  bool String(const char* data, uint32_t size, bool) {
+    return Record("s:" + std::string(data, size));
+  }
+  bool Key(const char* data, uint32_t size, bool) {
+    return Record("k:" + std::string(data, size));
+  }
+  bool StartObject() { return Record("{"); }
+  bool EndObject(uint32_t size) { return Record("}" + std::to_string(size)); }
+  bool StartArray() { return Record("["); }
+  bool EndArray(uint32_t size) { return Record("]" + std::to_string(size)); }
+  Status Error() { return Status::Invalid("handler failed"); }
+
+  bool Record(std::string event) {
+    events_ += events_.empty() ? event : " " + event;
+    return event != fail_on_;
+  }
+
+  std::string events_;
+  std::string fail_on_;
+};
+
+static Status ParseStructural(string_view json, RecordingHandler* handler,
+                              int32_t* num_rows) {
+  const auto data = reinterpret_cast<const uint8_t*>(json.data());
+  const auto size = static_cast<uint32_t>(json.size());
+  std::vector<uint32_t> indices;
+  const Status indexed = FindStructuralIndices(data, size, &indices);
+  *num_rows = 0;
+  return StructuralReader<RecordingHandler>(data, size, indices,
+                                            /*ends_in_string=*/!indexed.ok())
+      .Parse(handler, num_rows);
+}
+
+static void AssertEvents(string_view json, int32_t expected_rows,
+                         const std::string& expected_events) {
+  RecordingHandler handler;
+  int32_t num_rows;
+  ASSERT_OK(ParseStructural(json, &handler, &num_rows));
+  ASSERT_EQ(num_rows, expected_rows);
+  ASSERT_EQ(handler.events_, expected_events);
+}
+
+static void AssertParseError(string_view json, const std::string& expected_message) {
+  RecordingHandler handler;
+  int32_t num_rows;
+  Status st = ParseStructural(json, &handler, &num_rows);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_EQ(st.message(), expected_message);
+}
+
+TEST(StructuralReader, Basics) {
+  AssertEvents("", 0, "");
+  AssertEvents(" \n ", 0, "");
+  AssertEvents(R"({"a": 1, "b": [true, null, -2.5e3], "c": {}, "d": []})", 1,
+               "{ k:a n:1 k:b [ true null n:-2.5e3 ]3 k:c { }0 k:d [ ]0 }4");
+  AssertEvents("{\"a\":\"x\"}\n{}\n{\"a\" : [[], [1]]}\n", 3,
+               "{ k:a s:x }1 { }0 { k:a [ [ ]0 [ n:1 ]1 ]2 }1");
+  AssertEvents(R"({"n": NaN, "i": -Infinity, "j": Inf, "z": 0})", 1,
+               "{ k:n n:NaN k:i n:-Infinity k:j n:Inf k:z n:0 }4");
+}
+
+TEST(StructuralReader, Strings) {
+  AssertEvents(R"({"\"a\"": "\\\/\b\f\n\r\t"})", 1,
+               "{ k:\"a\" s:\\/\b\f\n\r\t }1");
+  AssertEvents(R"({"a": "\u00e9\u5fcd\ud83d\ude00", "": ""})", 1,
+               "{ k:a s:\xc3\xa9\xe5\xbf\x8d\xf0\x9f\x98\x80 k: s: }2");
+  AssertParseError(R"({"a": "\x"})",
+                   "JSON parse error: Invalid escape character in string. in row 0");
+  AssertParseError(R"({"a": "\u12g4"})",
+                   "JSON parse error: Incorrect hex digit after \\u escape in string. "
+                   "in row 0");
+  AssertParseError(R"({"a": "\ud800\u0041"})",
+                   "JSON parse error: The surrogate pair in string is invalid. in row 0");
+  AssertParseError("{\"a\": \"\t\"}",
+                   "JSON parse error: Invalid encoding in string. in row 0");
+  AssertParseError(std::string("{\"a\": \"x\0\"}", 11),
+                   "JSON parse error: Missing a closing quotation mark in string. "
+                   "in row 0");
+}
+
+TEST(StructuralReader, UnterminatedString) {
+  // The rows preceding the string are parsed
+  RecordingHandler handler;
+  int32_t num_rows;
+  Status st = ParseStructural("{}\n{\"a\": \"b", &handler, &num_rows);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_EQ(st.message(),
+            "JSON parse error: Missing a closing quotation mark in string. in row 1");
+  ASSERT_EQ(handler.events_, "{ }0 { k:a");
+
+  AssertParseError(R"({"a": "b\u00e)",
+                   "JSON parse error: Incorrect hex digit after \\u escape in string. "
+                   "in row 0");
+  AssertParseError(R"({"a": "b\)",
+                   "JSON parse error: Invalid escape character in string. in row 0");
+  AssertParseError(R"({"a)",
+                   "JSON parse error: Missing a closing quotation mark in string. "
+                   "in row 0");
+}
+
+TEST(StructuralReader, SyntaxErrors) {
+  AssertParseError("{}\n{\"a\":}",
+                   "JSON parse error: Invalid value. in row 1");
+  AssertParseError(R"({"a" 1})",
+                   "JSON parse error: Missing a colon after a name of object member. "
+                   "in row 0");
+  AssertParseError(R"({"a": 1,})",
+                   "JSON parse error: Missing a name for object member. in row 0");
+  AssertParseError(R"({"a": [1 2]})",
+                   "JSON parse error: Missing a comma or ']' after an array element. "
+                   "in row 0");
+  AssertParseError(R"({"a": 1)",
+                   "JSON parse error: Missing a comma or '}' after an object member. "
+                   "in row 0");
+  for (string_view atom : {"tru", "-", ".5", "+1", "Na", "-Infinit", "-x"}) {
+    AssertParseError("{\"a\": " + atom.to_string() + "}",
+                     "JSON parse error: Invalid value. in row 0");
+  }
+  for (string_view atom : {"1.", "-0.e5", "Inf.", "1.5.3"}) {
+    AssertParseError("{\"a\": " + atom.to_string() + "}",
+                     atom == "1.5.3"
+                         ? "JSON parse error: Missing a comma or '}' after an object "
+                           "member. in row 0"
+                         : "JSON parse error: Miss fraction part in number. in row 0");
+  }
+  for (string_view atom : {"1e", "1.5E+", "2e-x"}) {
+    AssertParseError("{\"a\": " + atom.to_string() + "}",
+                     "JSON parse error: Miss exponent in number. in row 0");
+  }
+  // The longest valid prefix of a token is read as a value, like RapidJSON
+  for (string_view atom : {"nulll", "01", "truex", "1e5x", "NaNa", "Infinityy"}) {
+    AssertParseError("{\"a\": " + atom.to_string() + "}",
+                     "JSON parse error: Missing a comma or '}' after an object member. "
+                     "in row 0");
+    AssertParseError("[" + atom.to_string() + "]",
+                     "JSON parse error: Missing a comma or ']' after an array element. "
+                     "in row 0");
+  }
+}
+
+TEST(StructuralReader, ValuePrefixes) {
+  // At the top level, the rest of a token is the next row
+  AssertEvents("01", 2, "n:0 n:1");
+  AssertEvents("nulltrue 1.5-2", 4, "null true n:1.5 n:-2");
+  // RapidJSON admits a fraction and an exponent after NaN and Inf(inity)
+  AssertEvents("[NaN.5e1, -Infinity.0]", 1, "[ n:NaN.5e1 n:-Infinity.0 ]2");
+}
+
+TEST(StructuralReader, HandlerError) {
+  RecordingHandler handler;
+  handler.fail_on_ = "n:2";
+  int32_t num_rows;
+  Status st = ParseStructural("[1]\n[2]\n[3]", &handler, &num_rows);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_EQ(st.message(), "handler failed");
+  ASSERT_EQ(num_rows, 1);
+  ASSERT_EQ(handler.events_, "[ n:1 ]1 [ n:2");
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -1922,6 +1922,60 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int32_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, PutGetWideValues) {
+  // Values up to 64 bits wide, written at every bit offset
+  std::vector<uint8_t> buffer(1024);
+  for (int num_bits : {33, 48, 63, 64}) {
+    const uint64_t max_value =
+        num_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << num_bits) - 1;
+    std::fill(buffer.begin(), buffer.end(), 0);
+    BitUtil::BitWriter writer(buffer.data(), static_cast<int>(buffer.size()));
+    for (int i = 0; i < 64; ++i) {
+      ASSERT_TRUE(writer.PutValue(i & 1, 1));
+      ASSERT_TRUE(writer.PutValue(max_value - i, num_bits));
+    }
+    writer.Flush();
+
+    BitUtil::BitReader reader(buffer.data(), static_cast<int>(buffer.size()));
+    for (int i = 0; i < 64; ++i) {
+      uint64_t value;
+      if (i % 2 == 0) {
+        ASSERT_TRUE(reader.GetValue(1, &value));
+        ASSERT_EQ(static_cast<uint64_t>(i & 1), value);
+      } else {
+        // Skip the 1-bit value
+        ASSERT_TRUE(reader.Advance(1));
+      }
+      ASSERT_TRUE(reader.GetValue(num_bits, &value));
+      ASSERT_EQ(max_value - i, value);
+    }
+  }
+  BitUtil::BitReader reader(buffer.data(), 8);
+  ASSERT_TRUE(reader.Advance(60));
+  ASSERT_FALSE(reader.Advance(5));
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/util/simd.h"
+
+#include <stdint.h>
+#include <type_traits>
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+// Inclusive prefix sums of 32-bit and 64-bit integers, as used to rebuild
+// delta-encoded values.  Each value is replaced by
+//
+//   base + (values[0] + increment) + ... + (values[i] + increment)
+//
+// with wrapping arithmetic, and the last value is returned (or `base` if there
+// are no values).
+
+template <typename T>
+T PrefixSumScalar(T* values, int64_t length, T increment, T base) {
+  static_assert(std::is_integral<T>::value, "PrefixSum requires integers");
+  using UT = typename std::make_unsigned<T>::type;
+  UT sum = static_cast<UT>(base);
+  const UT unsigned_increment = static_cast<UT>(increment);
+  for (int64_t i = 0; i < length; ++i) {
+    sum += unsigned_increment + static_cast<UT>(values[i]);
+    values[i] = static_cast<T>(sum);
+  }
+  return static_cast<T>(sum);
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+template <typename T>
+T PrefixSumSse42(T* values, int64_t length, T increment, T base) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Invalid integer width");
+  constexpr int64_t kValuesPerVector = sizeof(__m128i) / sizeof(T);
+  const int64_t num_vectors = length / kValuesPerVector;
+
+  __m128i carry, inc;
+  if (sizeof(T) == 4) {
+    carry = _mm_set1_epi32(static_cast<int32_t>(base));
+    inc = _mm_set1_epi32(static_cast<int32_t>(increment));
+  } else {
+    carry = _mm_set1_epi64x(static_cast<int64_t>(base));
+    inc = _mm_set1_epi64x(static_cast<int64_t>(increment));
+  }
+
+  __m128i* out = reinterpret_cast<__m128i*>(values);
+  for (int64_t i = 0; i < num_vectors; ++i) {
+    __m128i x = _mm_loadu_si128(out + i);
+    if (sizeof(T) == 4) {
+      x = _mm_add_epi32(x, inc);
+      // Log-step scan within the vector, then add the running total
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+      x = _mm_add_epi32(x, carry);
+      carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+    } else {
+      x = _mm_add_epi64(x, inc);
+      x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+      x = _mm_add_epi64(x, carry);
+      carry = _mm_unpackhi_epi64(x, x);
+    }
+    _mm_storeu_si128(out + i, x);
+  }
+
+  const int64_t num_processed = num_vectors * kValuesPerVector;
+  const T last = num_processed > 0 ? values[num_processed - 1] : base;
+  return PrefixSumScalar(values + num_processed, length - num_processed, increment,
+                         last);
+}
+#endif  // ARROW_HAVE_SSE4_2
+
+#if defined(ARROW_HAVE_AVX2)
+template <typename T>
+T PrefixSumAvx2(T* values, int64_t length, T increment, T base) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Invalid integer width");
+  constexpr int64_t kValuesPerVector = sizeof(__m256i) / sizeof(T);
+  const int64_t num_vectors = length / kValuesPerVector;
+  const __m256i zero = _mm256_setzero_si256();
+
+  __m256i carry, inc;
+  if (sizeof(T) == 4) {
+    carry = _mm256_set1_epi32(static_cast<int32_t>(base));
+    inc = _mm256_set1_epi32(static_cast<int32_t>(increment));
+  } else {
+    carry = _mm256_set1_epi64x(static_cast<int64_t>(base));
+    inc = _mm256_set1_epi64x(static_cast<int64_t>(increment));
+  }
+
+  __m256i* out = reinterpret_cast<__m256i*>(values);
+  for (int64_t i = 0; i < num_vectors; ++i) {
+    __m256i x = _mm256_loadu_si256(out + i);
+    if (sizeof(T) == 4) {
+      x = _mm256_add_epi32(x, inc);
+      // Scan each 128-bit lane, then add the total of the low lane to the high lane
+      x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+      x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+      const __m256i low_total = _mm256_permute2x128_si256(
+          _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3)), zero, 0x02);
+      x = _mm256_add_epi32(x, low_total);
+      x = _mm256_add_epi32(x, carry);
+      carry = _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+    } else {
+      x = _mm256_add_epi64(x, inc);
+      x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+      const __m256i low_total =
+          _mm256_blend_epi32(zero, _mm256_permute4x64_epi64(x, 0x55), 0xF0);
+      x = _mm256_add_epi64(x, low_total);
+      x = _mm256_add_epi64(x, carry);
+      carry = _mm256_permute4x64_epi64(x, 0xFF);
+    }
+    _mm256_storeu_si256(out + i, x);
+  }
+
+  const int64_t num_processed = num_vectors * kValuesPerVector;
+  const T last = num_processed > 0 ? values[num_processed - 1] : base;
+  return PrefixSumScalar(values + num_processed, length - num_processed, increment,
+                         last);
+}
+#endif  // ARROW_HAVE_AVX2
+
+template <typename T>
+T PrefixSum(T* values, int64_t length, T increment, T base) {
+#if defined(ARROW_HAVE_AVX2)
+  return PrefixSumAvx2(values, length, increment, base);
+#elif defined(ARROW_HAVE_SSE4_2)
+  return PrefixSumSse42(values, length, increment, base);
+#else
+  return PrefixSumScalar(values, length, increment, base);
+#endif
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/prefix_sum.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+template <typename T>
+using PrefixSumFunc = T (*)(T*, int64_t, T, T);
+
+template <typename T>
+class TestPrefixSum : public ::testing::Test {
+ public:
+  // Check `func` against PrefixSumScalar on random values, lengths (including
+  // ones that aren't a multiple of the vector width) and increments
+  void CheckAgainstScalar(PrefixSumFunc<T> func) {
+    std::default_random_engine gen(42);
+    std::uniform_int_distribution<T> value_dist(std::numeric_limits<T>::min(),
+                                                std::numeric_limits<T>::max());
+    std::uniform_int_distribution<T> small_dist(-1000, 1000);
+    std::uniform_int_distribution<int64_t> length_dist(0, 100);
+
+    for (int i = 0; i < 200; ++i) {
+      // Alternate small values with full range ones, which wrap around
+      auto& dist = (i % 2 == 0) ? small_dist : value_dist;
+      const int64_t length = (i < 20) ? i : length_dist(gen);
+      const T increment = dist(gen);
+      const T base = dist(gen);
+      std::vector<T> expected(length);
+      for (auto& value : expected) {
+        value = dist(gen);
+      }
+      std::vector<T> actual = expected;
+
+      const T expected_last = PrefixSumScalar(expected.data(), length, increment, base);
+      const T actual_last = func(actual.data(), length, increment, base);
+      ASSERT_EQ(expected, actual) << "length = " << length;
+      ASSERT_EQ(expected_last, actual_last) << "length = " << length;
+    }
+  }
+};
+
+using PrefixSumTypes = ::testing::Types<int32_t, int64_t>;
+
+TYPED_TEST_SUITE(TestPrefixSum, PrefixSumTypes);
+
+TYPED_TEST(TestPrefixSum, Scalar) {
+  std::vector<TypeParam> values = {1, 2, 3, 4};
+  ASSERT_EQ(24, PrefixSumScalar<TypeParam>(values.data(), 4, /*increment=*/1,
+                                           /*base=*/10));
+  ASSERT_EQ(std::vector<TypeParam>({12, 15, 19, 24}), values);
+  ASSERT_EQ(10, PrefixSumScalar<TypeParam>(values.data(), 0, 1, 10));
+
+  // Sums wrap around
+  values = {std::numeric_limits<TypeParam>::max(), 1};
+  PrefixSumScalar<TypeParam>(values.data(), 2, /*increment=*/0, /*base=*/0);
+  ASSERT_EQ(std::vector<TypeParam>({std::numeric_limits<TypeParam>::max(),
+                                    std::numeric_limits<TypeParam>::min()}),
+            values);
+}
+
+TYPED_TEST(TestPrefixSum, Dispatch) { this->CheckAgainstScalar(PrefixSum<TypeParam>); }
+
+#if defined(ARROW_HAVE_SSE4_2)
+TYPED_TEST(TestPrefixSum, Sse42) { this->CheckAgainstScalar(PrefixSumSse42<TypeParam>); }
+#endif
+
+#if defined(ARROW_HAVE_AVX2)
+TYPED_TEST(TestPrefixSum, Avx2) { this->CheckAgainstScalar(PrefixSumAvx2<TypeParam>); }
+#endif
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -301,6 +301,12 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // Return the number of tasks either running or in the queue.
   int GetNumTasks();
 
+  // Return whether the calling thread is one of this pool's worker threads.
+  //
+  // Tasks running on the pool must not wait for other tasks of the same pool
+  // (see class comment), so this can be used to fall back to serial execution.
+  bool OwnsThisThread();
+
   // Dynamically change the number of worker threads.
   //
   // This function always returns immediately.
@@ -547,6 +547,17 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, OwnsThisThread) {
+  auto pool = this->MakeThreadPool(3);
+  auto other_pool = this->MakeThreadPool(3);
+  ASSERT_FALSE(pool->OwnsThisThread());
+
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&] { return pool->OwnsThisThread(); }));
+  ASSERT_OK_AND_EQ(true, fut.result());
+  ASSERT_OK_AND_ASSIGN(fut, pool->Submit([&] { return other_pool->OwnsThisThread(); }));
+  ASSERT_OK_AND_EQ(false, fut.result());
+}
+
 TEST_F(TestThreadPool, SubmitWithStopToken) {
   auto pool = this->MakeThreadPool(3);
   {
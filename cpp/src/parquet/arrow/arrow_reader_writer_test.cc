@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <functional>
 #include <iostream>
+#include <set>
 #include <sstream>
 #include <vector>
 
@@ -57,6 +58,7 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/test_util.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_writer.h"
 #include "parquet/test_util.h"
@@ -2216,6 +2218,188 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   AssertTablesEqual(*table, *concatenated, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowReadWrite, BloomFilter) {
+  auto table = ::arrow::TableFromJSON(
+      ::arrow::schema({::arrow::field("i", ::arrow::int64()),
+                       ::arrow::field("s", ::arrow::utf8()),
+                       ::arrow::field("d", ::arrow::float64())}),
+      {R"([{"i": 1, "s": "a", "d": 1.5}, {"i": null, "s": "b", "d": 2.5}])",
+       R"([{"i": 3, "s": null, "d": 3.5}, {"i": 4, "s": "d", "d": 4.5}])"});
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("i")
+                        ->enable_bloom_filter("s", /*fpp=*/0.01)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(
+      WriteTable(*table, ::arrow::default_memory_pool(), sink, 2, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  ASSERT_EQ(2, reader->metadata()->num_row_groups());
+  const std::vector<std::vector<int64_t>> ints = {{1}, {3, 4}};
+  const std::vector<std::vector<std::string>> strings = {{"a", "b"}, {"d"}};
+  for (int i = 0; i < 2; ++i) {
+    auto row_group = reader->RowGroup(i);
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_FALSE(row_group->metadata()->ColumnChunk(2)->has_bloom_filter());
+    ASSERT_EQ(nullptr, row_group->GetColumnBloomFilter(2));
+
+    auto int_filter = row_group->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, int_filter);
+    // Without an ndv property, sized from the distinct values of the chunk
+    ASSERT_EQ(BlockSplitBloomFilter::OptimalNumOfBits(
+                  static_cast<uint32_t>(ints[i].size()), DEFAULT_BLOOM_FILTER_FPP) /
+                  8,
+              int_filter->GetBitsetSize());
+    for (int64_t value : ints[i]) {
+      ASSERT_TRUE(int_filter->FindHash(int_filter->Hash(value)));
+    }
+    auto string_filter = row_group->GetColumnBloomFilter(1);
+    ASSERT_NE(nullptr, string_filter);
+    for (const std::string& value : strings[i]) {
+      ByteArray byte_array(value);
+      ASSERT_TRUE(string_filter->FindHash(string_filter->Hash(&byte_array)));
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, BloomFilterRepeatedValues) {
+  // Buffered hashes are deduplicated, the filter is sized from distinct values
+  constexpr int64_t kNumRows = 10000;
+  ::arrow::random::RandomArrayGenerator rag(0x5eed);
+  auto values = rag.Int64(kNumRows, /*min=*/0, /*max=*/499, /*null_probability=*/0.1);
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+  const auto& typed_values = checked_cast<const ::arrow::Int64Array&>(*values);
+  std::set<int64_t> distinct;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    if (typed_values.IsValid(i)) distinct.insert(typed_values.Value(i));
+  }
+
+  auto properties = WriterProperties::Builder().enable_bloom_filter("col")->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(
+      WriteTable(*table, ::arrow::default_memory_pool(), sink, kNumRows, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  auto filter = reader->RowGroup(0)->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, filter);
+  ASSERT_EQ(BlockSplitBloomFilter::OptimalNumOfBits(
+                static_cast<uint32_t>(distinct.size()), DEFAULT_BLOOM_FILTER_FPP) /
+                8,
+            filter->GetBitsetSize());
+  for (int64_t value : distinct) {
+    ASSERT_TRUE(filter->FindHash(filter->Hash(value)));
+  }
+}
+
+TEST(TestArrowReadWrite, BloomFilterDictionary) {
+  // Dictionary arrays keep their indices on the direct write path, the Bloom
+  // filter is fed from the hashes of the referenced dictionary values
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int8(), "[0, null, 2, 0, 2]");
+  auto dict = ::arrow::ArrayFromJSON(::arrow::utf8(), R"(["a", "b", "c"])");
+  auto dict_ty = ::arrow::dictionary(::arrow::int8(), ::arrow::utf8());
+  ASSERT_OK_AND_ASSIGN(auto values,
+                       ::arrow::DictionaryArray::FromArrays(dict_ty, indices, dict));
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("col", /*fpp=*/0.01, /*ndv=*/16)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                values->length(), properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  auto row_group = reader->RowGroup(0);
+  auto encodings = row_group->metadata()->ColumnChunk(0)->encodings();
+  ASSERT_NE(encodings.end(),
+            std::find(encodings.begin(), encodings.end(), Encoding::RLE_DICTIONARY));
+  auto filter = row_group->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, filter);
+  // Sized from the ndv property rather than from the default estimate
+  ASSERT_EQ(BlockSplitBloomFilter::OptimalNumOfBits(16, 0.01) / 8,
+            filter->GetBitsetSize());
+  for (const std::string& value : {"a", "c"}) {
+    ByteArray byte_array(value);
+    ASSERT_TRUE(filter->FindHash(filter->Hash(&byte_array)));
+  }
+}
+
+TEST(TestArrowReadWrite, PageIndex) {
+  constexpr int64_t kNumRows = 100;
+  constexpr int64_t kRowsPerPage = 10;
+  ::arrow::random::RandomArrayGenerator rag(0x5eed);
+  auto values = rag.Int64(kNumRows, /*min=*/0, /*max=*/1000, /*null_probability=*/0.1);
+  auto strings = rag.String(kNumRows, /*min_length=*/0, /*max_length=*/8,
+                            /*null_probability=*/0.1);
+  auto lists = rag.List(*rag.Int32(kNumRows * 2, 0, 10), kNumRows + 1,
+                        /*null_probability=*/0.1);
+  auto table = Table::Make(::arrow::schema({::arrow::field("i", ::arrow::int64()),
+                                            ::arrow::field("s", ::arrow::utf8()),
+                                            ::arrow::field("l", lists->type())}),
+                           {values, strings, lists});
+
+  // One page per write batch
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->write_batch_size(kRowsPerPage)
+                        ->data_pagesize(1)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, kNumRows,
+                                properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  auto row_group = reader->RowGroup(0);
+  for (int column : {0, 1}) {
+    auto column_chunk = row_group->metadata()->ColumnChunk(column);
+    ASSERT_TRUE(column_chunk->has_offset_index());
+    ASSERT_TRUE(column_chunk->has_column_index());
+    auto offset_index = row_group->GetOffsetIndex(column);
+    const auto& locations = offset_index->page_locations();
+    ASSERT_EQ(kNumRows / kRowsPerPage, static_cast<int64_t>(locations.size()));
+    for (size_t page = 0; page < locations.size(); ++page) {
+      ASSERT_EQ(static_cast<int64_t>(page) * kRowsPerPage,
+                locations[page].first_row_index);
+    }
+    auto column_index = row_group->GetColumnIndex(column);
+    ASSERT_EQ(locations.size(), column_index->null_pages().size());
+    ASSERT_TRUE(column_index->has_null_counts());
+  }
+  // Repeated columns have no page index
+  auto list_chunk = row_group->metadata()->ColumnChunk(2);
+  ASSERT_FALSE(list_chunk->has_offset_index());
+  ASSERT_FALSE(list_chunk->has_column_index());
+
+  std::unique_ptr<FileReader> arrow_reader;
+  ASSERT_OK(FileReader::Make(
+      default_memory_pool(),
+      ParquetFileReader::Open(std::make_shared<BufferReader>(buffer)), &arrow_reader));
+  const RowRanges ranges = {{0, 3}, {15, 5}, {22, 19}, {99, 1}};
+  // Flat columns are read page by page, the list column falls back to slicing
+  // the whole row group
+  for (const std::vector<int>& columns : std::vector<std::vector<int>>{{0, 1}, {0, 2}}) {
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(arrow_reader->ReadRowGroup(0, columns, ranges, &result));
+    ASSERT_OK_AND_ASSIGN(auto expected_columns, table->SelectColumns(columns));
+    std::vector<std::shared_ptr<Table>> slices;
+    for (const RowRange& range : ranges) {
+      slices.push_back(expected_columns->Slice(range.offset, range.length));
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+    ASSERT_OK(result->ValidateFull());
+    ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+  }
+
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, arrow_reader->ReadRowGroup(0, {0}, {{10, 5}, {12, 5}}, &result));
+  ASSERT_RAISES(Invalid, arrow_reader->ReadRowGroup(0, {0}, {{95, 10}}, &result));
+}
+
 //  Exercise reading table manually with nested RowGroup and Column loops, i.e.
 //
 //  for (int i = 0; i < n_row_groups; i++)
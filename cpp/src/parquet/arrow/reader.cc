@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -315,6 +316,9 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                      const RowRanges& row_ranges, std::shared_ptr<Table>* out) override;
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
@@ -1145,6 +1149,145 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
       .Then(std::move(make_table));
 }
 
+namespace {
+
+// Gather `ranges` from a column holding the rows `column_rows` of its row group,
+// which must cover them.  Both are ordered, and adjacent column_rows are merged.
+std::shared_ptr<ChunkedArray> SliceRowRanges(const std::shared_ptr<ChunkedArray>& column,
+                                             const RowRanges& column_rows,
+                                             const RowRanges& ranges) {
+  ::arrow::ArrayVector chunks;
+  size_t i = 0;
+  // Position in `column` of the first row of column_rows[i]
+  int64_t position = 0;
+  for (const RowRange& range : ranges) {
+    while (column_rows[i].offset + column_rows[i].length <= range.offset) {
+      position += column_rows[i].length;
+      ++i;
+    }
+    DCHECK_GE(range.offset, column_rows[i].offset);
+    auto slice =
+        column->Slice(position + range.offset - column_rows[i].offset, range.length);
+    chunks.insert(chunks.end(), slice->chunks().begin(), slice->chunks().end());
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), column->type());
+}
+
+}  // namespace
+
+Status FileReaderImpl::ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                    const RowRanges& row_ranges,
+                                    std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheck({i}, column_indices));
+  int64_t num_rows = 0;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  num_rows = reader_->metadata()->RowGroup(i)->num_rows();
+  END_PARQUET_CATCH_EXCEPTIONS
+  int64_t num_selected_rows = 0;
+  int64_t previous_end = 0;
+  for (const RowRange& range : row_ranges) {
+    if (range.offset < previous_end || range.length <= 0 ||
+        range.offset + range.length > num_rows) {
+      return Status::Invalid(
+          "Row ranges must be non-empty, ordered, non-overlapping and within the "
+          "row group");
+    }
+    previous_end = range.offset + range.length;
+    num_selected_rows += range.length;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                        manifest_.GetFieldIndices(column_indices));
+  const RowRanges all_rows = {{0, num_rows}};
+
+  // Pages can only be selected if each field is a single flat column whose pages
+  // are located by an offset index
+  auto pages = std::make_shared<std::unordered_map<int, std::vector<int>>>();
+  std::vector<RowRanges> column_rows(field_indices.size());
+  bool select_pages = true;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto row_group_reader = reader_->RowGroup(i);
+  for (size_t f = 0; f < field_indices.size() && select_pages; ++f) {
+    const SchemaField& field = manifest_.schema_fields[field_indices[f]];
+    if (!field.is_leaf() || field.level_info.rep_level > 0) {
+      select_pages = false;
+      break;
+    }
+    auto column_chunk = row_group_reader->metadata()->ColumnChunk(field.column_index);
+    if (!column_chunk->has_offset_index() || column_chunk->crypto_metadata()) {
+      select_pages = false;
+      break;
+    }
+    auto offset_index = row_group_reader->GetOffsetIndex(field.column_index);
+    const auto& locations = offset_index->page_locations();
+    auto selected = SelectPages(locations, num_rows, row_ranges);
+    for (int page : selected) {
+      const int64_t first_row = locations[page].first_row_index;
+      const int64_t end_row = static_cast<size_t>(page) + 1 < locations.size()
+                                  ? locations[page + 1].first_row_index
+                                  : num_rows;
+      RowRanges& rows = column_rows[f];
+      if (!rows.empty() && rows.back().offset + rows.back().length == first_row) {
+        rows.back().length += end_row - first_row;
+      } else {
+        rows.push_back({first_row, end_row - first_row});
+      }
+    }
+    (*pages)[field.column_index] = std::move(selected);
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  if (!select_pages) {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(ReadRowGroup(i, column_indices, &table));
+    ::arrow::ChunkedArrayVector columns(table->num_columns());
+    for (int c = 0; c < table->num_columns(); ++c) {
+      columns[c] = SliceRowRanges(table->column(c), all_rows, row_ranges);
+    }
+    *out = Table::Make(table->schema(), std::move(columns), num_selected_rows);
+    return Status::OK();
+  }
+
+  auto ctx = std::make_shared<ReaderContext>();
+  ctx->reader = reader_.get();
+  ctx->pool = pool_;
+  ctx->iterator_factory = [i, pages, this](int column_index, ParquetFileReader* reader) {
+    return new FileColumnIterator(column_index, reader, i, pages->at(column_index),
+                                  reader_properties_.io_context(),
+                                  reader_properties_.cache_options());
+  };
+  ctx->filter_leaves = true;
+  ctx->included_leaves = VectorToSharedSet(column_indices);
+
+  std::vector<std::unique_ptr<ColumnReaderImpl>> readers(field_indices.size());
+  ::arrow::FieldVector fields(field_indices.size());
+  for (size_t f = 0; f < field_indices.size(); ++f) {
+    RETURN_NOT_OK(GetReader(manifest_.schema_fields[field_indices[f]], ctx, &readers[f]));
+    fields[f] = readers[f]->field();
+  }
+
+  ::arrow::ChunkedArrayVector columns(field_indices.size());
+  auto read_column = [&](int f) {
+    int64_t records_to_read = 0;
+    for (const RowRange& rows : column_rows[f]) {
+      records_to_read += rows.length;
+    }
+    std::shared_ptr<ChunkedArray> column;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    RETURN_NOT_OK(readers[f]->NextBatch(records_to_read, &column));
+    END_PARQUET_CATCH_EXCEPTIONS
+    columns[f] = SliceRowRanges(column, column_rows[f], row_ranges);
+    return Status::OK();
+  };
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(field_indices.size()),
+      read_column));
+
+  *out = Table::Make(::arrow::schema(std::move(fields), manifest_.schema_metadata),
+                     std::move(columns), num_selected_rows);
+  return Status::OK();
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
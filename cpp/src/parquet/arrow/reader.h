@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -212,6 +213,16 @@ class PARQUET_EXPORT FileReader {
 
   virtual ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read only the given rows of a row group into a Table
+  ///
+  /// If the selected columns are flat and have page indexes, only the data pages
+  /// overlapping `row_ranges` are read, through a ReadRangeCache configured by
+  /// the reader properties' io_context and cache_options.  Otherwise the whole
+  /// row group is read before being sliced.
+  virtual ::arrow::Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                       const RowRanges& row_ranges,
+                                       std::shared_ptr<::arrow::Table>* out) = 0;
+
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         const std::vector<int>& column_indices,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
@@ -26,6 +26,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/io/caching.h"
+#include "arrow/io/interfaces.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
@@ -68,6 +70,18 @@ class FileColumnIterator {
         schema_(reader->metadata()->schema()),
         row_groups_(row_groups.begin(), row_groups.end()) {}
 
+  // Iterate over only the given data pages of a single row group
+  explicit FileColumnIterator(int column_index, ParquetFileReader* reader, int row_group,
+                              std::vector<int> page_indices,
+                              ::arrow::io::IOContext io_context,
+                              ::arrow::io::CacheOptions cache_options)
+      : FileColumnIterator(column_index, reader, std::vector<int>{row_group}) {
+    select_pages_ = true;
+    page_indices_ = std::move(page_indices);
+    io_context_ = std::move(io_context);
+    cache_options_ = cache_options;
+  }
+
   virtual ~FileColumnIterator() {}
 
   std::unique_ptr<::parquet::PageReader> NextChunk() {
@@ -77,6 +91,10 @@ class FileColumnIterator {
 
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
+    if (select_pages_) {
+      return row_group_reader->GetColumnPageReader(column_index_, page_indices_,
+                                                   io_context_, cache_options_);
+    }
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
@@ -93,6 +111,11 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+
+  bool select_pages_ = false;
+  std::vector<int> page_indices_;
+  ::arrow::io::IOContext io_context_;
+  ::arrow::io::CacheOptions cache_options_ = ::arrow::io::CacheOptions::Defaults();
 };
 
 using FileColumnIteratorFactory =
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -34,6 +35,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -43,12 +45,15 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/visitor_inline.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
 #include "parquet/encryption/internal_file_encryptor.h"
 #include "parquet/level_conversion.h"
 #include "parquet/metadata.h"
+#include "parquet/murmur3.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -250,13 +255,17 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       ColumnIndexBuilder* column_index_builder = nullptr,
+                       OffsetIndexBuilder* offset_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
         num_values_(0),
+        num_rows_(0),
         dictionary_page_offset_(0),
         data_page_offset_(0),
+        bloom_filter_offset_(-1),
         total_uncompressed_size_(0),
         total_compressed_size_(0),
         page_ordinal_(0),
@@ -264,7 +273,9 @@ class SerializedPageWriter : public PageWriter {
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
-        encryption_buffer_(AllocateBuffer(pool, 0)) {
+        encryption_buffer_(AllocateBuffer(pool, 0)),
+        column_index_builder_(column_index_builder),
+        offset_index_builder_(offset_index_builder) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
     }
@@ -327,10 +338,18 @@ class SerializedPageWriter : public PageWriter {
     return uncompressed_size + header_size;
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    PARQUET_ASSIGN_OR_THROW(bloom_filter_offset_, sink_->Tell());
+    bloom_filter.WriteTo(sink_.get());
+  }
+
   void Close(bool has_dictionary, bool fallback) override {
     if (meta_encryptor_ != nullptr) {
       UpdateEncryption(encryption::kColumnMetaData);
     }
+    if (bloom_filter_offset_ >= 0) {
+      metadata_->SetBloomFilterOffset(bloom_filter_offset_);
+    }
     // index_page_offset = -1 since they are not supported
     metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
@@ -403,9 +422,20 @@ class SerializedPageWriter : public PageWriter {
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
 
+    // Index builders are only given for non-repeated columns, where each value
+    // is a row
+    if (column_index_builder_ != nullptr) {
+      column_index_builder_->AddPage(page.statistics(), page.num_values());
+    }
+    if (offset_index_builder_ != nullptr) {
+      offset_index_builder_->AddPage(
+          start_pos, static_cast<int32_t>(header_size + output_data_len), num_rows_);
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
     num_values_ += page.num_values();
+    num_rows_ += page.num_values();
     ++data_encoding_stats_[page.encoding()];
     ++page_ordinal_;
     return uncompressed_size + header_size;
@@ -452,6 +482,8 @@ class SerializedPageWriter : public PageWriter {
 
   int64_t data_page_offset() { return data_page_offset_; }
 
+  int64_t bloom_filter_offset() { return bloom_filter_offset_; }
+
   int64_t total_compressed_size() { return total_compressed_size_; }
 
   int64_t total_uncompressed_size() { return total_uncompressed_size_; }
@@ -513,8 +545,10 @@ class SerializedPageWriter : public PageWriter {
   ColumnChunkMetaDataBuilder* metadata_;
   MemoryPool* pool_;
   int64_t num_values_;
+  int64_t num_rows_;
   int64_t dictionary_page_offset_;
   int64_t data_page_offset_;
+  int64_t bloom_filter_offset_;
   int64_t total_uncompressed_size_;
   int64_t total_compressed_size_;
   int16_t page_ordinal_;
@@ -536,6 +570,9 @@ class SerializedPageWriter : public PageWriter {
 
   std::map<Encoding::type, int32_t> dict_encoding_stats_;
   std::map<Encoding::type, int32_t> data_encoding_stats_;
+
+  ColumnIndexBuilder* column_index_builder_;
+  OffsetIndexBuilder* offset_index_builder_;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -546,13 +583,18 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
-      : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     ColumnIndexBuilder* column_index_builder = nullptr,
+                     OffsetIndexBuilder* offset_index_builder = nullptr)
+      : final_sink_(std::move(sink)),
+        metadata_(metadata),
+        has_dictionary_pages_(false),
+        offset_index_builder_(offset_index_builder) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), column_index_builder, offset_index_builder));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -569,6 +611,12 @@ class BufferedPageWriter : public PageWriter {
     // dictionary page offset should be 0 iff there are no dictionary pages
     auto dictionary_page_offset =
         has_dictionary_pages_ ? pager_->dictionary_page_offset() + final_position : 0;
+    if (pager_->bloom_filter_offset() >= 0) {
+      metadata_->SetBloomFilterOffset(pager_->bloom_filter_offset() + final_position);
+    }
+    if (offset_index_builder_ != nullptr) {
+      offset_index_builder_->Finish(final_position);
+    }
     metadata_->Finish(pager_->num_values(), dictionary_page_offset, -1,
                       pager_->data_page_offset() + final_position,
                       pager_->total_compressed_size(), pager_->total_uncompressed_size(),
@@ -587,6 +635,10 @@ class BufferedPageWriter : public PageWriter {
     return pager_->WriteDataPage(page);
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    pager_->WriteBloomFilter(bloom_filter);
+  }
+
   void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) override {
     pager_->Compress(src_buffer, dest_buffer);
   }
@@ -599,6 +651,7 @@ class BufferedPageWriter : public PageWriter {
   std::shared_ptr<::arrow::io::BufferOutputStream> in_memory_sink_;
   std::unique_ptr<SerializedPageWriter> pager_;
   bool has_dictionary_pages_;
+  OffsetIndexBuilder* offset_index_builder_;
 };
 
 std::unique_ptr<PageWriter> PageWriter::Open(
@@ -606,17 +659,18 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor, ColumnIndexBuilder* column_index_builder,
+    OffsetIndexBuilder* offset_index_builder) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        column_index_builder, offset_index_builder));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        column_index_builder, offset_index_builder));
   }
 }
 
@@ -683,6 +737,9 @@ class ColumnWriterImpl {
   // Merges page statistics into chunk statistics, then resets the values
   virtual void ResetPageStatistics() = 0;
 
+  // Bloom filter of the values of the whole chunk, or null if not enabled
+  virtual std::unique_ptr<BloomFilter> GetBloomFilter() = 0;
+
   // Adds Data Pages to an in memory buffer in dictionary encoding mode
   // Serializes the Data Pages in other encoding modes
   void AddDataPage();
@@ -940,13 +997,14 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                             combined->CopySlice(0, combined->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV2(
         combined, num_values, null_count, num_values, encoding_, def_levels_byte_length,
-        rep_levels_byte_length, uncompressed_size, pager_->has_compressor()));
+        rep_levels_byte_length, uncompressed_size, pager_->has_compressor(),
+        page_stats));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page_ptr));
   } else {
     DataPageV2 page(combined, num_values, null_count, num_values, encoding_,
                     def_levels_byte_length, rep_levels_byte_length, uncompressed_size,
-                    pager_->has_compressor());
+                    pager_->has_compressor(), page_stats);
     WriteDataPage(page);
   }
 }
@@ -969,6 +1027,10 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
+    std::unique_ptr<BloomFilter> bloom_filter = GetBloomFilter();
+    if (bloom_filter != nullptr) {
+      pager_->WriteBloomFilter(*bloom_filter);
+    }
     pager_->Close(has_dictionary_, fallback_);
   }
 
@@ -1026,6 +1088,30 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash a value the way BloomFilter::Hash does for the column's physical type
+template <typename T>
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor*, T value) {
+  return hasher.Hash(value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor*,
+                                const Int96& value) {
+  return hasher.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor*,
+                                const ByteArray& value) {
+  return hasher.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ColumnDescriptor* descr,
+                                const FLBA& value) {
+  return hasher.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
+// Number of buffered Bloom filter hashes at which they are first deduplicated
+constexpr size_t kMinBloomFilterHashesLimit = 1024;
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -1044,6 +1130,18 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+
+    // Encrypted columns would need an encrypted Bloom filter, which isn't
+    // supported yet
+    bloom_filter_enabled_ =
+        properties->bloom_filter_enabled(descr_->path()) &&
+        descr_->physical_type() != Type::BOOLEAN &&
+        properties->column_encryption_properties(descr_->path()->ToDotString()) ==
+            nullptr;
+    const int64_t ndv = properties->bloom_filter_ndv(descr_->path());
+    if (bloom_filter_enabled_ && ndv > 0) {
+      InitBloomFilter(ndv);
+    }
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
@@ -1192,6 +1290,19 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  std::unique_ptr<BloomFilter> GetBloomFilter() override {
+    if (bloom_filter_enabled_ && bloom_filter_ == nullptr) {
+      // Size the filter from the distinct values of the chunk
+      DeduplicateBloomFilterHashes();
+      InitBloomFilter(std::max<int64_t>(bloom_filter_hashes_.size(), 1));
+      for (uint64_t hash : bloom_filter_hashes_) {
+        bloom_filter_->InsertHash(hash);
+      }
+      std::vector<uint64_t>().swap(bloom_filter_hashes_);
+    }
+    return std::move(bloom_filter_);
+  }
+
   Type::type type() const override { return descr_->physical_type(); }
 
   const ColumnDescriptor* descr() const override { return descr_; }
@@ -1211,6 +1322,20 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
 
+  bool bloom_filter_enabled_;
+  // Bloom filter of the non-null values written to the chunk.  Allocated up
+  // front if the bloom_filter_ndv writer property is set, otherwise when the
+  // chunk is closed
+  std::unique_ptr<BlockSplitBloomFilter> bloom_filter_;
+  // If the filter isn't allocated yet, hashes of the values written to the
+  // chunk, deduplicated whenever their number reaches the limit
+  std::vector<uint64_t> bloom_filter_hashes_;
+  size_t bloom_filter_hashes_limit_ = kMinBloomFilterHashesLimit;
+  MurmurHash3 hasher_;
+  // Hashes of the values of preserved_dictionary_, so that dictionary indices
+  // can be added to the Bloom filter without materializing the values
+  std::vector<uint64_t> dictionary_hashes_;
+
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
   // subsequent array chunks to see either if materialization is required (in
@@ -1384,12 +1509,119 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  void InitBloomFilter(int64_t ndv) {
+    const auto num_bytes =
+        BlockSplitBloomFilter::OptimalNumOfBits(
+            static_cast<uint32_t>(
+                std::min<int64_t>(ndv, std::numeric_limits<uint32_t>::max())),
+            properties_->bloom_filter_fpp(descr_->path())) /
+        8;
+    bloom_filter_.reset(new BlockSplitBloomFilter());
+    bloom_filter_->Init(num_bytes);
+  }
+
+  void DeduplicateBloomFilterHashes() {
+    std::sort(bloom_filter_hashes_.begin(), bloom_filter_hashes_.end());
+    bloom_filter_hashes_.erase(
+        std::unique(bloom_filter_hashes_.begin(), bloom_filter_hashes_.end()),
+        bloom_filter_hashes_.end());
+  }
+
+  void InsertBloomFilterHash(uint64_t hash) {
+    if (bloom_filter_ != nullptr) {
+      bloom_filter_->InsertHash(hash);
+      return;
+    }
+    bloom_filter_hashes_.push_back(hash);
+    if (bloom_filter_hashes_.size() >= bloom_filter_hashes_limit_) {
+      // Keeps the buffered hashes within twice the number of distinct ones
+      DeduplicateBloomFilterHashes();
+      bloom_filter_hashes_limit_ =
+          std::max(kMinBloomFilterHashesLimit, 2 * bloom_filter_hashes_.size());
+    }
+  }
+
+  void UpdateBloomFilter(const T* values, int64_t num_values) {
+    for (int64_t i = 0; i < num_values; ++i) {
+      InsertBloomFilterHash(BloomFilterHash(hasher_, descr_, values[i]));
+    }
+  }
+
+  template <typename ArrayType>
+  void UpdateBloomFilterBinary(const ArrayType& array) {
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsValid(i)) {
+        const ByteArray value = array.GetView(i);
+        InsertBloomFilterHash(hasher_.Hash(&value));
+      }
+    }
+  }
+
+  void UpdateBloomFilterBinary(const ::arrow::Array& array) {
+    if (::arrow::is_large_binary_like(array.type_id())) {
+      UpdateBloomFilterBinary(checked_cast<const ::arrow::LargeBinaryArray&>(array));
+    } else {
+      UpdateBloomFilterBinary(checked_cast<const ::arrow::BinaryArray&>(array));
+    }
+  }
+
+  template <typename ArrayType>
+  void HashDictionary(const ArrayType& dictionary) {
+    dictionary_hashes_.resize(dictionary.length());
+    for (int64_t i = 0; i < dictionary.length(); ++i) {
+      if (dictionary.IsValid(i)) {
+        const ByteArray value = dictionary.GetView(i);
+        dictionary_hashes_[i] = hasher_.Hash(&value);
+      }
+    }
+  }
+
+  template <typename IndexType>
+  void UpdateBloomFilterIndices(const ::arrow::ArrayData& indices) {
+    const ::arrow::Array& dictionary = *preserved_dictionary_;
+    ::arrow::VisitArrayDataInline<IndexType>(
+        indices,
+        [&](typename IndexType::c_type index) {
+          if (dictionary.IsValid(index)) {
+            InsertBloomFilterHash(dictionary_hashes_[index]);
+          }
+        },
+        [] {});
+  }
+
+  void UpdateBloomFilterIndices(const ::arrow::Array& indices) {
+    switch (indices.type_id()) {
+      case ::arrow::Type::UINT8:
+        return UpdateBloomFilterIndices<::arrow::UInt8Type>(*indices.data());
+      case ::arrow::Type::INT8:
+        return UpdateBloomFilterIndices<::arrow::Int8Type>(*indices.data());
+      case ::arrow::Type::UINT16:
+        return UpdateBloomFilterIndices<::arrow::UInt16Type>(*indices.data());
+      case ::arrow::Type::INT16:
+        return UpdateBloomFilterIndices<::arrow::Int16Type>(*indices.data());
+      case ::arrow::Type::UINT32:
+        return UpdateBloomFilterIndices<::arrow::UInt32Type>(*indices.data());
+      case ::arrow::Type::INT32:
+        return UpdateBloomFilterIndices<::arrow::Int32Type>(*indices.data());
+      case ::arrow::Type::UINT64:
+        return UpdateBloomFilterIndices<::arrow::UInt64Type>(*indices.data());
+      case ::arrow::Type::INT64:
+        return UpdateBloomFilterIndices<::arrow::Int64Type>(*indices.data());
+      default:
+        throw ParquetException("Unsupported dictionary index type: ",
+                               indices.type()->ToString());
+    }
+  }
+
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
     dynamic_cast<ValueEncoderType*>(current_encoder_.get())
         ->Put(values, static_cast<int>(num_values));
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_enabled_) {
+      UpdateBloomFilter(values, num_values);
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1407,6 +1639,17 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_enabled_) {
+      if (num_values != num_spaced_values) {
+        ::arrow::internal::VisitSetBitRunsVoid(
+            valid_bits, valid_bits_offset, num_spaced_values,
+            [&](int64_t position, int64_t length) {
+              UpdateBloomFilter(values + position, length);
+            });
+      } else {
+        UpdateBloomFilter(values, num_values);
+      }
+    }
   }
 };
 
@@ -1471,6 +1714,9 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
         writeable_indices,
         MaybeReplaceValidity(writeable_indices, null_count, ctx->memory_pool));
     dict_encoder->PutIndices(*writeable_indices);
+    if (bloom_filter_enabled_) {
+      UpdateBloomFilterIndices(*writeable_indices);
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     value_offset += batch_num_spaced_values;
   };
@@ -1493,6 +1739,14 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     if (page_statistics_ != nullptr) {
       PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
     }
+    if (bloom_filter_enabled_) {
+      // DictionaryDirectWriteSupported only admits binary-like values
+      if (::arrow::is_large_binary_like(dictionary->type_id())) {
+        HashDictionary(checked_cast<const ::arrow::LargeBinaryArray&>(*dictionary));
+      } else {
+        HashDictionary(checked_cast<const ::arrow::BinaryArray&>(*dictionary));
+      }
+    }
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
@@ -1902,6 +2156,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_enabled_) {
+      UpdateBloomFilterBinary(*data_slice);
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
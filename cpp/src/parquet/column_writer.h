@@ -42,6 +42,9 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
+class ColumnIndexBuilder;
+class OffsetIndexBuilder;
 class ColumnDescriptor;
 class DataPage;
 class DictionaryPage;
@@ -83,6 +86,8 @@ class PARQUET_EXPORT PageWriter {
  public:
   virtual ~PageWriter() {}
 
+  // If given, the index builders are fed the statistics and location of each
+  // data page.  They must only be given for non-repeated columns.
   static std::unique_ptr<PageWriter> Open(
       std::shared_ptr<ArrowOutputStream> sink, Compression::type codec,
       int compression_level, ColumnChunkMetaDataBuilder* metadata,
@@ -90,13 +95,19 @@ class PARQUET_EXPORT PageWriter {
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       bool buffered_row_group = false,
       std::shared_ptr<Encryptor> header_encryptor = NULLPTR,
-      std::shared_ptr<Encryptor> data_encryptor = NULLPTR);
+      std::shared_ptr<Encryptor> data_encryptor = NULLPTR,
+      ColumnIndexBuilder* column_index_builder = NULLPTR,
+      OffsetIndexBuilder* offset_index_builder = NULLPTR);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
   // page limit
   virtual void Close(bool has_dictionary, bool fallback) = 0;
 
+  // Write the column chunk's Bloom filter after its pages and record its offset
+  // in the column chunk metadata.  Must be called before Close().
+  virtual void WriteBloomFilter(const BloomFilter& bloom_filter) = 0;
+
   // Return the number of uncompressed bytes written (including header size)
   virtual int64_t WriteDataPage(const DataPage& page) = 0;
 
@@ -39,6 +39,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/prefix_sum.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
@@ -928,6 +929,412 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   }
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoder
+
+// Values are written as a header (block size, number of miniblocks, value count
+// and first value) followed by blocks of deltas between consecutive values.  Each
+// block stores its minimum delta, then the deltas relative to that minimum,
+// bit-packed in miniblocks which each have their own bit width.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+  // Three VLQ ints and a zigzag VLQ value
+  static constexpr int kMaxHeaderSize =
+      3 * ::arrow::BitUtil::BitReader::kMaxVlqByteLength +
+      ::arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+  // The minimum delta, the bit widths and the bit-packed deltas
+  static constexpr int kMaxBlockSize =
+      ::arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64 + kMiniBlocksPerBlock +
+      kValuesPerBlock * sizeof(T);
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderSize + sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const ::arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(T),
+                                                                   this->memory_pool()));
+      T* data = reinterpret_cast<T*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<T>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  void FlushBlock();
+
+  ::arrow::BufferBuilder sink_;
+  uint32_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  // Deltas of the current block, computed with wrapping arithmetic
+  T deltas_[kValuesPerBlock];
+  uint32_t values_current_block_ = 0;
+  uint8_t block_buffer_[kMaxBlockSize];
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) return;
+  if (ARROW_PREDICT_FALSE(static_cast<int64_t>(total_value_count_) + num_values >
+                          std::numeric_limits<int32_t>::max())) {
+    throw ParquetException("Too many values for a DELTA_BINARY_PACKED page");
+  }
+
+  int i = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    i = 1;
+  }
+  total_value_count_ += num_values;
+  for (; i < num_values; ++i) {
+    deltas_[values_current_block_++] =
+        static_cast<T>(static_cast<UT>(src[i]) - static_cast<UT>(current_value_));
+    current_value_ = src[i];
+    if (values_current_block_ == kValuesPerBlock) FlushBlock();
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) return;
+
+  const T min_delta = *std::min_element(deltas_, deltas_ + values_current_block_);
+  ::arrow::BitUtil::BitWriter writer(block_buffer_, kMaxBlockSize);
+  writer.PutZigZagVlqInt(min_delta);
+  uint8_t* bit_widths = writer.GetNextBytePtr(kMiniBlocksPerBlock);
+  // The bit widths of unused miniblocks in the last block are set to zero, and
+  // their deltas omitted
+  std::fill(bit_widths, bit_widths + kMiniBlocksPerBlock, 0);
+
+  for (uint32_t start = 0, mini_block = 0; start < values_current_block_;
+       start += kValuesPerMiniBlock, ++mini_block) {
+    const uint32_t end = std::min(start + kValuesPerMiniBlock, values_current_block_);
+    UT max_delta = 0;
+    for (uint32_t j = start; j < end; ++j) {
+      max_delta = std::max(max_delta,
+                           static_cast<UT>(static_cast<UT>(deltas_[j]) -
+                                           static_cast<UT>(min_delta)));
+    }
+    const int bit_width = ::arrow::BitUtil::NumRequiredBits(max_delta);
+    bit_widths[mini_block] = static_cast<uint8_t>(bit_width);
+    for (uint32_t j = start; j < end; ++j) {
+      writer.PutValue(static_cast<UT>(static_cast<UT>(deltas_[j]) -
+                                      static_cast<UT>(min_delta)),
+                      bit_width);
+    }
+    // Miniblocks are always complete
+    for (uint32_t j = end; j < start + kValuesPerMiniBlock; ++j) {
+      writer.PutValue(0, bit_width);
+    }
+  }
+  writer.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(block_buffer_, writer.bytes_written()));
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderSize];
+  ::arrow::BitUtil::BitWriter writer(header, kMaxHeaderSize);
+  writer.PutVlqInt(kValuesPerBlock);
+  writer.PutVlqInt(kMiniBlocksPerBlock);
+  writer.PutVlqInt(total_value_count_);
+  writer.PutZigZagVlqInt(first_value_);
+  writer.Flush();
+
+  const int64_t header_size = writer.bytes_written();
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_size + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_size);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_size, sink_.data(), sink_.length());
+  }
+  sink_.Rewind(0);
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <>
+void DeltaBitPackEncoder<Int32Type>::Put(const ::arrow::Array& values) {
+  if (values.type_id() != ::arrow::Type::INT32) {
+    throw ParquetException("direct put to Int32 from " + values.type()->ToString() +
+                           " not supported");
+  }
+  const auto& data = checked_cast<const ::arrow::Int32Array&>(values);
+  PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+            data.null_count() > 0 ? data.null_bitmap_data() : NULLPTR, data.offset());
+}
+
+template <>
+void DeltaBitPackEncoder<Int64Type>::Put(const ::arrow::Array& values) {
+  if (values.type_id() != ::arrow::Type::INT64) {
+    throw ParquetException("direct put to Int64 from " + values.type()->ToString() +
+                           " not supported");
+  }
+  const auto& data = checked_cast<const ::arrow::Int64Array&>(values);
+  PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+            data.null_count() > 0 ? data.null_bitmap_data() : NULLPTR, data.offset());
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const ::arrow::Array& values) {
+  ParquetException::NYI("direct put of " + values.type()->ToString());
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY encoder
+
+// The lengths of all values are DELTA_BINARY_PACKED, followed by the
+// concatenated values.
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool),
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + length_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> encoded_lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), encoded_lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), encoded_lengths->data(), encoded_lengths->size());
+    if (sink_.length() > 0) {
+      memcpy(buffer->mutable_data() + encoded_lengths->size(), sink_.data(),
+             sink_.length());
+    }
+    sink_.Rewind(0);
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    lengths_.resize(num_values);
+    int64_t total_length = 0;
+    for (int i = 0; i < num_values; ++i) {
+      lengths_[i] = static_cast<int32_t>(src[i].len);
+      total_length += src[i].len;
+    }
+    length_encoder_.Put(lengths_.data(), num_values);
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+    for (int i = 0; i < num_values; ++i) {
+      sink_.UnsafeAppend(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBaseBinary(values);
+    if (::arrow::is_binary_like(values.type_id())) {
+      PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+    } else {
+      DCHECK(::arrow::is_large_binary_like(values.type_id()));
+      PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                               this->memory_pool()));
+      ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    lengths_.clear();
+    const int64_t total_bytes =
+        array.value_offset(array.length()) - array.value_offset(0);
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_bytes));
+
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<typename ArrayType::TypeClass>(
+        *array.data(),
+        [&](::arrow::util::string_view view) {
+          if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+            return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+          }
+          lengths_.push_back(static_cast<int32_t>(view.size()));
+          sink_.UnsafeAppend(view.data(), static_cast<int64_t>(view.size()));
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
+    length_encoder_.Put(lengths_.data(), static_cast<int>(lengths_.size()));
+  }
+
+  ::arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  ArrowPoolVector<int32_t> lengths_;
+};
+
+// ----------------------------------------------------------------------
+// DELTA_BYTE_ARRAY encoder
+
+// Each value is stored as the length of its common prefix with the previous
+// value, and its remaining suffix.  Prefix lengths are DELTA_BINARY_PACKED,
+// followed by the DELTA_LENGTH_BYTE_ARRAY encoded suffixes.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool),
+        prefix_lengths_(::arrow::stl::allocator<int32_t>(pool)),
+        suffixes_(::arrow::stl::allocator<ByteArray>(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Pages are decoded independently
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      PutValue(src[i].ptr, static_cast<int32_t>(src[i].len));
+    }
+    FlushPending();
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBaseBinary(values);
+    if (::arrow::is_binary_like(values.type_id())) {
+      PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+    } else {
+      DCHECK(::arrow::is_large_binary_like(values.type_id()));
+      PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+    }
+    FlushPending();
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                               this->memory_pool()));
+      ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<typename ArrayType::TypeClass>(
+        *array.data(),
+        [&](::arrow::util::string_view view) {
+          if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+            return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+          }
+          PutValue(reinterpret_cast<const uint8_t*>(view.data()),
+                   static_cast<int32_t>(view.size()));
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
+  }
+
+  void PutValue(const uint8_t* data, int32_t length) {
+    const int32_t max_prefix =
+        std::min(length, static_cast<int32_t>(last_value_.size()));
+    const uint8_t* last = reinterpret_cast<const uint8_t*>(last_value_.data());
+    int32_t prefix = 0;
+    // Compare 8 bytes at a time before finding the first mismatching byte
+    while (prefix + 8 <= max_prefix &&
+           ::arrow::util::SafeLoadAs<uint64_t>(data + prefix) ==
+               ::arrow::util::SafeLoadAs<uint64_t>(last + prefix)) {
+      prefix += 8;
+    }
+    while (prefix < max_prefix && data[prefix] == last[prefix]) {
+      ++prefix;
+    }
+
+    prefix_lengths_.push_back(prefix);
+    suffixes_.emplace_back(static_cast<uint32_t>(length - prefix), data + prefix);
+    last_value_.assign(reinterpret_cast<const char*>(data), length);
+  }
+
+  // Pass the prefix lengths and suffixes of the values given to Put() to the
+  // nested encoders, while the suffixes' data is still alive
+  void FlushPending() {
+    prefix_length_encoder_.Put(prefix_lengths_.data(),
+                               static_cast<int>(prefix_lengths_.size()));
+    suffix_encoder_.Put(suffixes_.data(), static_cast<int>(suffixes_.size()));
+    prefix_lengths_.clear();
+    suffixes_.clear();
+  }
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+  ArrowPoolVector<int32_t> prefix_lengths_;
+  ArrowPoolVector<ByteArray> suffixes_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -2052,22 +2459,33 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = ::arrow::default_memory_pool())
-      : DecoderImpl(descr, Encoding::DELTA_BINARY_PACKED), pool_(pool) {
+      : DecoderImpl(descr, Encoding::DELTA_BINARY_PACKED),
+        pool_(pool),
+        mini_block_values_(::arrow::stl::allocator<T>(pool)) {
     if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
       throw ParquetException("Delta bit pack encoding should only be for integer data.");
     }
   }
 
   void SetData(int num_values, const uint8_t* data, int len) override {
+    SetDecoder(num_values, std::make_shared<::arrow::BitUtil::BitReader>(data, len));
+  }
+
+  // Decode values from a bit stream shared with an enclosing decoder, which may
+  // read its own data from the stream once all values are decoded
+  void SetDecoder(int num_values, std::shared_ptr<::arrow::BitUtil::BitReader> decoder) {
     this->num_values_ = num_values;
-    decoder_ = ::arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    decoder_ = std::move(decoder);
+    InitHeader();
   }
 
+  // The number of values in the page header, excluding nulls
+  int ValidValuesCount() const { return static_cast<int>(total_value_count_); }
+
   int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
@@ -2075,100 +2493,252 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    const int values_decoded = num_values - null_count;
+    ArrowPoolVector<T> values(values_decoded, ::arrow::stl::allocator<T>(pool_));
+    if (ARROW_PREDICT_FALSE(GetInternal(values.data(), values_decoded) !=
+                            values_decoded)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    int value_index = 0;
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { out->UnsafeAppend(values[value_index++]); },
+        [&]() { out->UnsafeAppendNull(); });
+    return values_decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    const int values_decoded = num_values - null_count;
+    ArrowPoolVector<T> values(values_decoded, ::arrow::stl::allocator<T>(pool_));
+    if (ARROW_PREDICT_FALSE(GetInternal(values.data(), values_decoded) !=
+                            values_decoded)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    int value_index = 0;
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { PARQUET_THROW_NOT_OK(out->Append(values[value_index++])); },
+        [&]() { PARQUET_THROW_NOT_OK(out->AppendNull()); });
+    return values_decoded;
   }
 
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  static constexpr int kMaxDeltaBitWidth = static_cast<int>(sizeof(T) * 8);
+
+  void InitHeader() {
+    if (!decoder_->GetVlqInt(&values_per_block_) ||
+        !decoder_->GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_->GetVlqInt(&total_value_count_) ||
+        !decoder_->GetZigZagVlqInt(&last_value_)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (values_per_block_ == 0 || values_per_block_ % 128 != 0) {
+      throw ParquetException("the number of values in a block must be a multiple of ",
+                             "128, but it's ", values_per_block_);
+    }
+    if (mini_blocks_per_block_ == 0 || values_per_block_ % mini_blocks_per_block_ != 0 ||
+        (values_per_block_ / mini_blocks_per_block_) % 32 != 0) {
+      throw ParquetException("the number of values in a miniblock must be a multiple ",
+                             "of 32, but there are ", mini_blocks_per_block_,
+                             " miniblocks in a block of ", values_per_block_);
+    }
+    values_per_mini_block_ = values_per_block_ / mini_blocks_per_block_;
+    mini_block_values_.resize(values_per_mini_block_);
+    if (delta_bit_widths_ == nullptr) {
+      delta_bit_widths_ = AllocateBuffer(pool_, mini_blocks_per_block_);
+    } else {
+      PARQUET_THROW_NOT_OK(
+          delta_bit_widths_->Resize(mini_blocks_per_block_, /*shrink_to_fit=*/false));
+    }
+    total_values_remaining_ = total_value_count_;
+    first_value_read_ = false;
+    // The first block is read once the first value has been returned
+    mini_block_idx_ = mini_blocks_per_block_;
+    values_current_mini_block_ = 0;
+    delta_bit_width_ = 0;
+    mini_block_unpacked_ = false;
+  }
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+  void InitBlock() {
+    if (!decoder_->GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
-      if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
+    // The bit widths of the unused miniblocks of the last block are present but
+    // may have any value, so they are only validated when used
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
+      if (!decoder_->GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+    InitMiniBlock(bit_width_data[0]);
+  }
+
+  void InitMiniBlock(int bit_width) {
+    if (ARROW_PREDICT_FALSE(bit_width > kMaxDeltaBitWidth)) {
+      throw ParquetException("delta bit width larger than integer bit width");
+    }
+    delta_bit_width_ = bit_width;
     values_current_mini_block_ = values_per_mini_block_;
+    mini_block_unpacked_ = false;
+  }
+
+  // Unpack the next `num_values` deltas, which must start on a byte boundary
+  // so that BitReader::GetBatch uses the (possibly vectorized) bpacking
+  // routines, then turn them into values with a vectorized prefix sum
+  void UnpackMiniBlock(T* out, int num_values) {
+    if (ARROW_PREDICT_FALSE(decoder_->GetBatch(delta_bit_width_, out, num_values) !=
+                            num_values)) {
+      ParquetException::EofException();
+    }
+    last_value_ =
+        ::arrow::util::internal::PrefixSum(out, num_values, min_delta_, last_value_);
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
+    max_values = static_cast<int>(std::min<int64_t>(max_values, total_values_remaining_));
+    if (max_values == 0) return 0;
+
+    int i = 0;
+    if (ARROW_PREDICT_FALSE(!first_value_read_)) {
+      buffer[i++] = last_value_;
+      first_value_read_ = true;
+    }
+    while (i < max_values) {
       if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
         ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
+        if (mini_block_idx_ < mini_blocks_per_block_) {
+          InitMiniBlock(delta_bit_widths_->data()[mini_block_idx_]);
         } else {
           InitBlock();
-          buffer[i] = last_value_;
+        }
+      }
+
+      const int values_wanted = max_values - i;
+      if (!mini_block_unpacked_) {
+        if (static_cast<uint64_t>(values_wanted) >= values_current_mini_block_) {
+          // The whole miniblock is wanted: unpack it straight into the output
+          const int num_values = static_cast<int>(values_current_mini_block_);
+          UnpackMiniBlock(buffer + i, num_values);
+          values_current_mini_block_ = 0;
+          i += num_values;
           continue;
         }
+        // Unpack the whole miniblock rather than only the values wanted, so
+        // that the next call resumes from the buffer instead of a bit offset
+        const uint64_t page_values_left = total_values_remaining_ - i;
+        const int num_values = static_cast<int>(
+            std::min<uint64_t>(values_current_mini_block_, page_values_left));
+        UnpackMiniBlock(mini_block_values_.data(), num_values);
+        if (static_cast<uint64_t>(num_values) < values_current_mini_block_) {
+          // Skip the padding of the last miniblock, so that an enclosing
+          // decoder finds its data right after
+          if (!decoder_->Advance(static_cast<int64_t>(delta_bit_width_) *
+                                 (values_current_mini_block_ - num_values))) {
+            ParquetException::EofException();
+          }
+          values_current_mini_block_ = num_values;
+        }
+        mini_block_unpacked_ = true;
+        mini_block_offset_ = 0;
       }
 
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int num_copied = static_cast<int>(
+          std::min<uint64_t>(values_current_mini_block_, values_wanted));
+      std::copy_n(mini_block_values_.data() + mini_block_offset_, num_copied, buffer + i);
+      mini_block_offset_ += num_copied;
+      values_current_mini_block_ -= num_copied;
+      i += num_copied;
     }
+    total_values_remaining_ -= max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
 
   MemoryPool* pool_;
-  ::arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
+  std::shared_ptr<::arrow::BitUtil::BitReader> decoder_;
+  uint32_t values_per_block_;
+  uint32_t mini_blocks_per_block_;
+  uint32_t values_per_mini_block_;
+  uint32_t total_value_count_;
+
+  uint32_t total_values_remaining_;
+  bool first_value_read_;
+  uint32_t mini_block_idx_;
   uint64_t values_current_mini_block_;
+  // Whether the rest of the current miniblock is in mini_block_values_
+  bool mini_block_unpacked_;
+  int mini_block_offset_;
+  ArrowPoolVector<T> mini_block_values_;
 
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  T min_delta_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
+  int delta_bit_width_ = 0;
 
-  int32_t last_value_;
+  T last_value_;
 };
 
+// Decode the non-null values of a batch of ByteArrays, then append them to an
+// Arrow builder along with the nulls
+template <typename DecoderType>
+int DecodeByteArraysArrow(DecoderType* decoder, MemoryPool* pool, int num_values,
+                          int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  const int values_decoded = num_values - null_count;
+  ArrowPoolVector<ByteArray> values(values_decoded,
+                                    ::arrow::stl::allocator<ByteArray>(pool));
+  if (ARROW_PREDICT_FALSE(decoder->Decode(values.data(), values_decoded) !=
+                          values_decoded)) {
+    ParquetException::EofException();
+  }
+
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  int value_index = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[value_index++];
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+        }
+        return helper.Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return helper.AppendNull(); }));
+  return values_decoded;
+}
+
+template <typename DecoderType>
+int DecodeByteArraysArrow(DecoderType* decoder, MemoryPool* pool, int num_values,
+                          int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  const int values_decoded = num_values - null_count;
+  ArrowPoolVector<ByteArray> values(values_decoded,
+                                    ::arrow::stl::allocator<ByteArray>(pool));
+  if (ARROW_PREDICT_FALSE(decoder->Decode(values.data(), values_decoded) !=
+                          values_decoded)) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+  int value_index = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[value_index++];
+        return out->Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return out->AppendNull(); }));
+  return values_decoded;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2179,48 +2749,62 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = ::arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        pool_(pool),
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    auto decoder = std::make_shared<::arrow::BitUtil::BitReader>(data, len);
+    len_decoder_.SetDecoder(num_values, decoder);
+
+    // All lengths are decoded upfront to find the concatenated values after them
+    lengths_.resize(len_decoder_.ValidValuesCount());
+    const int num_lengths = static_cast<int>(lengths_.size());
+    if (len_decoder_.Decode(lengths_.data(), num_lengths) != num_lengths) {
+      ParquetException::EofException();
+    }
+    length_idx_ = 0;
+    const int bytes_left = decoder->bytes_left();
+    data_ = data + (len - bytes_left);
+    len_ = bytes_left;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
-    max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    max_values = std::min(max_values, static_cast<int>(lengths_.size()) - length_idx_);
+    const int32_t* lengths = lengths_.data() + length_idx_;
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      if (ARROW_PREDICT_FALSE(lengths[i] < 0 || lengths[i] > len_)) {
+        throw ParquetException("Invalid or truncated DELTA_LENGTH_BYTE_ARRAY data");
+      }
+      buffer[i].len = static_cast<uint32_t>(lengths[i]);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += lengths[i];
+      len_ -= lengths[i];
     }
-    this->num_values_ -= max_values;
+    length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, pool_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, pool_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
   ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2234,46 +2818,93 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        pool_(pool),
+        prefix_lengths_(::arrow::stl::allocator<int32_t>(pool)),
+        buffered_data_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
+  void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+    auto decoder = std::make_shared<::arrow::BitUtil::BitReader>(data, len);
+    prefix_len_decoder_.SetDecoder(num_values, decoder);
+
+    // All prefix lengths are decoded upfront to find the suffixes after them
+    prefix_lengths_.resize(prefix_len_decoder_.ValidValuesCount());
+    const int num_prefixes = static_cast<int>(prefix_lengths_.size());
+    if (prefix_len_decoder_.Decode(prefix_lengths_.data(), num_prefixes) !=
+        num_prefixes) {
+      ParquetException::EofException();
+    }
+    prefix_idx_ = 0;
+    const int bytes_left = decoder->bytes_left();
+    suffix_decoder_.SetData(num_prefixes, data + (len - bytes_left), bytes_left);
+    last_value_.clear();
+  }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  // The returned values point to memory owned by the decoder, which is valid
+  // until the next call to Decode() or SetData()
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values =
+        std::min(max_values, static_cast<int>(prefix_lengths_.size()) - prefix_idx_);
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    const int32_t* prefix_lengths = prefix_lengths_.data() + prefix_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(prefix_lengths[i] < 0)) {
+        throw ParquetException("negative prefix length in DELTA_BYTE_ARRAY");
+      }
+      data_size += prefix_lengths[i] + buffer[i].len;
     }
-    this->num_values_ -= max_values;
+    PARQUET_THROW_NOT_OK(buffered_data_->Resize(data_size, /*shrink_to_fit=*/false));
+
+    uint8_t* out = buffered_data_->mutable_data();
+    const uint8_t* previous = reinterpret_cast<const uint8_t*>(last_value_.data());
+    int64_t previous_len = static_cast<int64_t>(last_value_.size());
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_len = prefix_lengths[i];
+      if (ARROW_PREDICT_FALSE(prefix_len > previous_len)) {
+        throw ParquetException("prefix length too large in DELTA_BYTE_ARRAY");
+      }
+      if (prefix_len > 0) memcpy(out, previous, prefix_len);
+      if (buffer[i].len > 0) memcpy(out + prefix_len, buffer[i].ptr, buffer[i].len);
+      buffer[i].len += prefix_len;
+      buffer[i].ptr = out;
+      previous = out;
+      previous_len = buffer[i].len;
+      out += buffer[i].len;
+    }
+    if (max_values > 0) {
+      last_value_.assign(reinterpret_cast<const char*>(previous), previous_len);
+    }
+    prefix_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysArrow(this, pool_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysArrow(this, pool_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> prefix_lengths_;
+  int prefix_idx_ = 0;
+  std::shared_ptr<ResizableBuffer> buffered_data_;
+  std::string last_value_;
 };
 
 // ----------------------------------------------------------------------
@@ -2462,6 +3093,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2502,6 +3153,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -25,12 +25,14 @@
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/byte_stream_split.h"
+#include "arrow/util/prefix_sum.h"
 
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
 #include <cmath>
+#include <limits>
 #include <random>
 
 using arrow::default_memory_pool;
@@ -517,6 +519,169 @@ static void BM_DictDecodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED benchmarks
+
+// Values increasing by small random steps (as in timestamps or sorted keys),
+// or uniformly random values which need the full bit width
+template <typename T>
+static std::vector<T> MakeDeltaBitPackInput(int64_t num_values, bool sorted) {
+  std::vector<T> values(num_values);
+  std::default_random_engine gen(42);
+  if (sorted) {
+    std::uniform_int_distribution<int> step(0, 100);
+    T value = 0;
+    for (auto& v : values) {
+      value = static_cast<T>(value + step(gen));
+      v = value;
+    }
+  } else {
+    std::uniform_int_distribution<T> dist(std::numeric_limits<T>::min(),
+                                          std::numeric_limits<T>::max());
+    for (auto& v : values) {
+      v = dist(gen);
+    }
+  }
+  return values;
+}
+
+template <typename Type>
+static void BM_DeltaBitPackEncoding(benchmark::State& state, bool sorted) {
+  using T = typename Type::c_type;
+  auto values = MakeDeltaBitPackInput<T>(state.range(0), sorted);
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+// Decode all values at once, or `batch_size` values at a time as the column
+// readers do
+template <typename Type>
+static void BM_DeltaBitPackDecoding(benchmark::State& state, bool sorted,
+                                    int batch_size = 0) {
+  using T = typename Type::c_type;
+  auto values = MakeDeltaBitPackInput<T>(state.range(0), sorted);
+  const int num_values = static_cast<int>(values.size());
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), num_values);
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+  if (batch_size == 0) batch_size = num_values;
+
+  auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    decoder->SetData(num_values, buf->data(), static_cast<int>(buf->size()));
+    for (int i = 0; i < num_values; i += batch_size) {
+      decoder->Decode(values.data() + i, std::min(batch_size, num_values - i));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_DeltaBitPackEncodingInt32_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int32Type>(state, /*sorted=*/true);
+}
+
+static void BM_DeltaBitPackEncodingInt32_Random(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int32Type>(state, /*sorted=*/false);
+}
+
+static void BM_DeltaBitPackEncodingInt64_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int64Type>(state, /*sorted=*/true);
+}
+
+static void BM_DeltaBitPackEncodingInt64_Random(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int64Type>(state, /*sorted=*/false);
+}
+
+static void BM_DeltaBitPackDecodingInt32_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int32Type>(state, /*sorted=*/true);
+}
+
+static void BM_DeltaBitPackDecodingInt32_Random(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int32Type>(state, /*sorted=*/false);
+}
+
+static void BM_DeltaBitPackDecodingInt64_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int64Type>(state, /*sorted=*/true);
+}
+
+static void BM_DeltaBitPackDecodingInt64_Random(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int64Type>(state, /*sorted=*/false);
+}
+
+BENCHMARK(BM_DeltaBitPackEncodingInt32_Sorted)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackEncodingInt32_Random)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackEncodingInt64_Sorted)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackEncodingInt64_Random)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt32_Sorted)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt32_Random)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt64_Sorted)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt64_Random)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaBitPackDecodingInt32_SortedBatched(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int32Type>(state, /*sorted=*/true, /*batch_size=*/100);
+}
+
+static void BM_DeltaBitPackDecodingInt64_SortedBatched(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int64Type>(state, /*sorted=*/true, /*batch_size=*/100);
+}
+
+BENCHMARK(BM_DeltaBitPackDecodingInt32_SortedBatched)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt64_SortedBatched)->Range(MIN_RANGE, MAX_RANGE);
+
+// The prefix sum which turns deltas back into values
+template <typename T, typename PrefixSumFunc>
+static void BM_PrefixSum(benchmark::State& state, PrefixSumFunc&& prefix_sum_func) {
+  std::vector<T> values(state.range(0), 3);
+  T last = 0;
+  for (auto _ : state) {
+    last = prefix_sum_func(values.data(), static_cast<int64_t>(values.size()),
+                           /*increment=*/1, last);
+    benchmark::DoNotOptimize(last);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_PrefixSum_Int32_Scalar(benchmark::State& state) {
+  BM_PrefixSum<int32_t>(state, ::arrow::util::internal::PrefixSumScalar<int32_t>);
+}
+
+static void BM_PrefixSum_Int64_Scalar(benchmark::State& state) {
+  BM_PrefixSum<int64_t>(state, ::arrow::util::internal::PrefixSumScalar<int64_t>);
+}
+
+BENCHMARK(BM_PrefixSum_Int32_Scalar)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_PrefixSum_Int64_Scalar)->Range(MIN_RANGE, MAX_RANGE);
+
+#if defined(ARROW_HAVE_SSE4_2)
+static void BM_PrefixSum_Int32_Sse42(benchmark::State& state) {
+  BM_PrefixSum<int32_t>(state, ::arrow::util::internal::PrefixSumSse42<int32_t>);
+}
+
+static void BM_PrefixSum_Int64_Sse42(benchmark::State& state) {
+  BM_PrefixSum<int64_t>(state, ::arrow::util::internal::PrefixSumSse42<int64_t>);
+}
+
+BENCHMARK(BM_PrefixSum_Int32_Sse42)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_PrefixSum_Int64_Sse42)->Range(MIN_RANGE, MAX_RANGE);
+#endif
+
+#if defined(ARROW_HAVE_AVX2)
+static void BM_PrefixSum_Int32_Avx2(benchmark::State& state) {
+  BM_PrefixSum<int32_t>(state, ::arrow::util::internal::PrefixSumAvx2<int32_t>);
+}
+
+static void BM_PrefixSum_Int64_Avx2(benchmark::State& state) {
+  BM_PrefixSum<int64_t>(state, ::arrow::util::internal::PrefixSumAvx2<int64_t>);
+}
+
+BENCHMARK(BM_PrefixSum_Int32_Avx2)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_PrefixSum_Int64_Avx2)->Range(MIN_RANGE, MAX_RANGE);
+#endif
+
 // ----------------------------------------------------------------------
 // Shared benchmarks for decoding using arrow builders
 
@@ -675,6 +840,48 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from DELTA_BYTE_ARRAY Encoding
+class BM_ArrowBinaryDeltaByteArray : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dict)
+(benchmark::State& state) { DecodeArrowDictBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dict)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Benchmark Decoding from Dictionary Encoding
 class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
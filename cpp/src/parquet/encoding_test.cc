@@ -1243,5 +1243,279 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests.
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  using c_type = typename Type::c_type;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    // Split the input to check that blocks can span several calls to Put()
+    const int first_put = num_values_ / 3;
+    encoder->Put(draws_, first_put);
+    encoder->Put(draws_ + first_put, num_values_ - first_put);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    int values_decoded = decoder->Decode(decode_buf_, num_values_);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decode_buf_, draws_, num_values_));
+
+    // Decode again with steps which do not divide the miniblock size, so that
+    // values are returned from partially consumed miniblocks
+    for (int step : {1, 37}) {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, num_values_ - i));
+        ASSERT_NO_FATAL_FAILURE(
+            VerifyResults<c_type>(decode_buf_, &draws_[i], num_decoded));
+      }
+      ASSERT_EQ(0, decoder->Decode(decode_buf_, step));
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<c_type>(decode_buf_, draws_, num_values_,
+                                                        valid_bits, valid_bits_offset));
+  }
+
+  // Deltas between these values overflow the integer type
+  void ExecuteExtremes(int nvalues) {
+    num_values_ = nvalues;
+    input_bytes_.resize(num_values_ * sizeof(c_type));
+    output_bytes_.resize(num_values_ * sizeof(c_type));
+    draws_ = reinterpret_cast<c_type*>(input_bytes_.data());
+    decode_buf_ = reinterpret_cast<c_type*>(output_bytes_.data());
+    const c_type extremes[] = {std::numeric_limits<c_type>::min(),
+                               std::numeric_limits<c_type>::max(), 0, -1, 1};
+    for (int i = 0; i < num_values_; ++i) {
+      draws_[i] = extremes[(i * 7 + i / 5) % 5];
+    }
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+  using TestEncodingBase<Type>::input_bytes_;
+  using TestEncodingBase<Type>::output_bytes_;
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Sizes around the miniblock (32) and block (128) boundaries
+  for (int values : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  // Repeated values give zero-width miniblocks
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1, 500));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 3));
+
+  for (auto null_prob : {0.001, 0.1, 0.5, 0.9, 0.999}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, null_prob));
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 33, null_prob));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, OverflowingDeltas) {
+  for (int values : {5, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteExtremes(values));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, CheckEncode) {
+  // The example of the Parquet specification: a single block with a min delta of
+  // 1 and zero-width miniblocks
+  using c_type = typename TypeParam::c_type;
+  c_type values[] = {1, 2, 3, 4, 5};
+  const uint8_t expected[] = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00};
+
+  auto encoder = MakeTypedEncoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values, 5);
+  auto encoded = encoder->FlushValues();
+  ASSERT_EQ(encoded->size(), static_cast<int64_t>(sizeof(expected)));
+  ASSERT_EQ(0, memcmp(encoded->data(), expected, sizeof(expected)));
+
+  auto decoder = MakeTypedDecoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(5, expected, static_cast<int>(sizeof(expected)));
+  c_type decoded[5];
+  ASSERT_EQ(5, decoder->Decode(decoded, 5));
+  ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decoded, values, 5));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, InvalidHeader) {
+  using c_type = typename TypeParam::c_type;
+  c_type decoded[1];
+  auto decoder = MakeTypedDecoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+
+  // 100 values per block is not a multiple of 128
+  const uint8_t bad_block_size[] = {0x64, 0x04, 0x01, 0x00};
+  ASSERT_THROW(decoder->SetData(1, bad_block_size, sizeof(bad_block_size)),
+               ParquetException);
+  // 128 values in 8 miniblocks is not a multiple of 32 values per miniblock
+  const uint8_t bad_miniblocks[] = {0x80, 0x01, 0x08, 0x01, 0x00};
+  ASSERT_THROW(decoder->SetData(1, bad_miniblocks, sizeof(bad_miniblocks)),
+               ParquetException);
+  // Truncated header
+  const uint8_t truncated[] = {0x80, 0x01, 0x04};
+  ASSERT_THROW(decoder->SetData(1, truncated, sizeof(truncated)), ParquetException);
+  // A bit width larger than the integer type
+  const uint8_t bad_bit_width[] = {0x80, 0x01, 0x04, 0x02, 0x00, 0x00, 0x41, 0x00,
+                                   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+  decoder->SetData(2, bad_bit_width, sizeof(bad_bit_width));
+  ASSERT_EQ(1, decoder->Decode(decoded, 1));
+  ASSERT_THROW(decoder->Decode(decoded, 1), ParquetException);
+}
+
+TEST(DeltaBitPackEncodeDecode, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests.
+
+class DeltaByteArrayEncodingBase : public TestArrowBuilderDecoding {
+ public:
+  explicit DeltaByteArrayEncodingBase(Encoding::type encoding) : encoding_(encoding) {}
+
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(encoding_);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(encoding_);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      // Split the input to check that state is kept across calls to Put()
+      const int first_put = num_values_ / 3;
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), first_put));
+      ASSERT_NO_THROW(
+          encoder_->Put(input_data_.data() + first_put, num_values_ - first_put));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+
+  void CheckDecodeInSteps() {
+    InitTestCase(/*null_probability=*/0.0);
+    const int step = 37;
+    for (int i = 0; i < num_values_; i += step) {
+      std::vector<ByteArray> decoded(step);
+      const int num_decoded = decoder_->Decode(decoded.data(), step);
+      ASSERT_EQ(num_decoded, std::min(step, num_values_ - i));
+      for (int j = 0; j < num_decoded; ++j) {
+        ASSERT_EQ(input_data_[i + j], decoded[j]);
+      }
+    }
+    ASSERT_EQ(0, decoder_->values_left());
+  }
+
+ protected:
+  Encoding::type encoding_;
+};
+
+class DeltaLengthByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaLengthByteArrayEncoding()
+      : DeltaByteArrayEncodingBase(Encoding::DELTA_LENGTH_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeInSteps) { this->CheckDecodeInSteps(); }
+
+class DeltaByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaByteArrayEncoding() : DeltaByteArrayEncodingBase(Encoding::DELTA_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeInSteps) { this->CheckDecodeInSteps(); }
+
+TEST(DeltaByteArrayEncodingAdHoc, SharedPrefixes) {
+  const std::vector<std::string> values = {
+      "", "apple", "applesauce", "apply", "banana", "bandana", "band", "", "bandwidth",
+      std::string(300, 'z')};
+  std::vector<ByteArray> input;
+  for (const auto& value : values) {
+    input.emplace_back(static_cast<uint32_t>(value.size()),
+                       reinterpret_cast<const uint8_t*>(value.data()));
+  }
+
+  auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  const int num_values = static_cast<int>(input.size());
+  for (int i = 0; i < num_values; ++i) {
+    encoder->Put(&input[i], 1);
+  }
+  auto buffer = encoder->FlushValues();
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+
+  std::vector<ByteArray> decoded(num_values);
+  ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(values[i], ByteArrayToString(decoded[i]));
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
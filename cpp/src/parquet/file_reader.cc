@@ -25,6 +25,7 @@
 #include <string>
 #include <utility>
 
+#include "arrow/buffer.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
@@ -33,6 +34,7 @@
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -40,6 +42,7 @@
 #include "parquet/exception.h"
 #include "parquet/file_writer.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -126,6 +129,48 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const std::vector<int>& page_indices, const ::arrow::io::IOContext& ctx,
+    const ::arrow::io::CacheOptions& options) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnPageReader(i, page_indices, ctx, options);
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetOffsetIndex(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -247,7 +292,141 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+    if (col->crypto_metadata() != nullptr) {
+      throw ParquetException(
+          "Reading Bloom filters of encrypted columns is not supported");
+    }
+
+    // The bitset length is only known from the filter header (three uint32:
+    // bitset length, hash strategy, algorithm), so read that first
+    constexpr int64_t kHeaderLength = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset + kHeaderLength > source_size_) {
+      throw ParquetException("Invalid Bloom filter offset");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto header, source_->ReadAt(offset, kHeaderLength));
+    if (header->size() != kHeaderLength) {
+      throw ParquetException("Failed to read Bloom filter header");
+    }
+    uint32_t num_bytes;
+    std::memcpy(&num_bytes, header->data(), sizeof(uint32_t));
+    if (num_bytes > BloomFilter::kMaximumBloomFilterBytes ||
+        offset + kHeaderLength + num_bytes > source_size_) {
+      throw ParquetException("Invalid Bloom filter length");
+    }
+
+    auto stream = properties_.GetStream(source_, offset, kHeaderLength + num_bytes);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(stream.get())));
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    if (col->crypto_metadata() != nullptr) {
+      throw ParquetException(
+          "Reading page indexes of encrypted columns is not supported");
+    }
+    auto buffer = ReadPageIndex(col->column_index_location());
+    return ColumnIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    if (col->crypto_metadata() != nullptr) {
+      throw ParquetException(
+          "Reading page indexes of encrypted columns is not supported");
+    }
+    auto buffer = ReadPageIndex(col->offset_index_location());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const std::vector<int>& page_indices, const ::arrow::io::IOContext& ctx,
+      const ::arrow::io::CacheOptions& options) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (col->crypto_metadata() != nullptr) {
+      throw ParquetException(
+          "Reading selected pages of encrypted columns is not supported");
+    }
+    auto offset_index = GetOffsetIndex(i);
+    if (offset_index == nullptr) {
+      throw ParquetException("Selecting pages requires an offset index");
+    }
+    const auto& locations = offset_index->page_locations();
+    const int num_pages = static_cast<int>(locations.size());
+
+    std::vector<::arrow::io::ReadRange> ranges;
+    // The dictionary page, if any, sits between the start of the column chunk
+    // and its first data page
+    ::arrow::io::ReadRange chunk_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
+    if (num_pages > 0 && locations[0].offset > chunk_range.offset) {
+      ranges.push_back({chunk_range.offset, locations[0].offset - chunk_range.offset});
+    }
+
+    int64_t num_rows = 0;
+    int previous_page = -1;
+    for (int page : page_indices) {
+      if (page <= previous_page || page >= num_pages) {
+        throw ParquetException("Invalid or unordered page ordinal ", page);
+      }
+      previous_page = page;
+      const PageLocation& location = locations[page];
+      int64_t page_end;
+      if (location.offset < 0 || location.compressed_page_size <= 0 ||
+          AddWithOverflow(location.offset, location.compressed_page_size, &page_end) ||
+          page_end > source_size_) {
+        throw ParquetException("Invalid page location (corrupt file?)");
+      }
+      ranges.push_back({location.offset, location.compressed_page_size});
+      const int64_t next_first_row = page + 1 < num_pages
+                                         ? locations[page + 1].first_row_index
+                                         : row_group_metadata_->num_rows();
+      num_rows += next_first_row - location.first_row_index;
+    }
+
+    ::arrow::io::internal::ReadRangeCache cache(source_, ctx, options);
+    PARQUET_THROW_NOT_OK(cache.Cache(ranges));
+    ::arrow::BufferVector buffers;
+    buffers.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      PARQUET_ASSIGN_OR_THROW(auto buffer, cache.Read(range));
+      buffers.push_back(std::move(buffer));
+    }
+    PARQUET_ASSIGN_OR_THROW(
+        auto data, ::arrow::ConcatenateBuffers(buffers, properties_.memory_pool()));
+    auto stream = std::make_shared<::arrow::io::BufferReader>(std::move(data));
+    return PageReader::Open(std::move(stream), num_rows, col->compression(),
+                            properties_.memory_pool());
+  }
+
  private:
+  std::shared_ptr<::arrow::Buffer> ReadPageIndex(const IndexLocation& location) {
+    int64_t end;
+    if (location.offset < 0 || location.length <= 0 ||
+        AddWithOverflow(location.offset, static_cast<int64_t>(location.length), &end) ||
+        end > source_size_) {
+      throw ParquetException("Invalid page index location (corrupt file?)");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            source_->ReadAt(location.offset, location.length));
+    if (buffer->size() != location.length) {
+      throw ParquetException("Failed to read page index");
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -30,8 +30,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+class ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageReader;
 class RowGroupMetaData;
 
@@ -43,6 +46,12 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const std::vector<int>& page_indices, const ::arrow::io::IOContext& ctx,
+        const ::arrow::io::CacheOptions& options) = 0;
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) = 0;
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i) = 0;
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -72,6 +81,27 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Construct a PageReader over the dictionary page (if any) and only the given
+  // data pages of the indicated column, identified by their ordinal in the
+  // column chunk's OffsetIndex, in increasing order.  Only the byte ranges of
+  // those pages are read, through a ReadRangeCache so that neighbouring pages
+  // are coalesced into a single request.
+  //
+  // The column chunk must have an OffsetIndex and must not be encrypted.
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const std::vector<int>& page_indices,
+      const ::arrow::io::IOContext& ctx = ::arrow::io::default_io_context(),
+      const ::arrow::io::CacheOptions& options = ::arrow::io::CacheOptions::Defaults());
+
+  // Read the Bloom filter of the indicated row group-relative column, or
+  // return null if the column chunk was written without one.
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Read the page indexes of the indicated row group-relative column, or
+  // return null if the column chunk was written without them.
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -150,7 +180,9 @@ class PARQUET_EXPORT ParquetFileReader {
   /// If memory usage is a concern, note that data will remain
   /// buffered in memory until either \a PreBuffer() is called again,
   /// or the reader itself is destructed. Reading - and buffering -
-  /// only one row group at a time may be useful.
+  /// only one row group at a time may be useful. Alternatively, set
+  /// CacheOptions::memory_limit to only read ahead a bounded amount of
+  /// data, and drop column chunks once their page reader was created.
   ///
   /// This method may throw.
   void PreBuffer(const std::vector<int>& row_groups,
@@ -275,6 +275,30 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
 
   inline int64_t index_page_offset() const { return column_metadata_->index_page_offset; }
 
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline IndexLocation column_index_location() const {
+    return {column_->column_index_offset, column_->column_index_length};
+  }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline IndexLocation offset_index_location() const {
+    return {column_->offset_index_offset, column_->offset_index_length};
+  }
+
   inline int64_t total_compressed_size() const {
     return column_metadata_->total_compressed_size;
   }
@@ -360,6 +384,24 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+IndexLocation ColumnChunkMetaData::column_index_location() const {
+  return impl_->column_index_location();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+IndexLocation ColumnChunkMetaData::offset_index_location() const {
+  return impl_->offset_index_location();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -1313,6 +1355,10 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void SetBloomFilterOffset(int64_t offset) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -1512,6 +1558,10 @@ void ColumnChunkMetaDataBuilder::SetStatistics(const EncodedStatistics& result)
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::SetBloomFilterOffset(int64_t offset) {
+  impl_->SetBloomFilterOffset(offset);
+}
+
 int64_t ColumnChunkMetaDataBuilder::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
@@ -1645,6 +1695,32 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetPageIndexLocation(const PageIndexLocation& location) {
+    auto set_locations = [this](
+                             const std::vector<std::vector<IndexLocation>>& locations,
+                             bool is_column_index) {
+      for (size_t row_group = 0; row_group < locations.size(); ++row_group) {
+        if (row_group >= row_groups_.size()) {
+          throw ParquetException("Page index location of an unknown row group");
+        }
+        auto& columns = row_groups_[row_group].columns;
+        for (size_t column = 0; column < locations[row_group].size(); ++column) {
+          const IndexLocation& index_location = locations[row_group][column];
+          if (index_location.length == 0 || column >= columns.size()) continue;
+          if (is_column_index) {
+            columns[column].__set_column_index_offset(index_location.offset);
+            columns[column].__set_column_index_length(index_location.length);
+          } else {
+            columns[column].__set_offset_index_offset(index_location.offset);
+            columns[column].__set_offset_index_length(index_location.length);
+          }
+        }
+      }
+    };
+    set_locations(location.column_index_locations, /*is_column_index=*/true);
+    set_locations(location.offset_index_locations, /*is_column_index=*/false);
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1774,6 +1850,10 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location) {
+  impl_->SetPageIndexLocation(location);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
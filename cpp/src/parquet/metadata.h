@@ -24,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -157,6 +158,12 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t data_page_offset() const;
   bool has_index_page() const;
   int64_t index_page_offset() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  bool has_column_index() const;
+  IndexLocation column_index_location() const;
+  bool has_offset_index() const;
+  IndexLocation offset_index_location() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
@@ -395,6 +402,8 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // absolute file offset of the column chunk's Bloom filter
+  void SetBloomFilterOffset(int64_t offset);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
@@ -464,6 +473,10 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record where the page indexes of every column chunk were written.  Must be
+  // called before Finish()
+  void SetPageIndexLocation(const PageIndexLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
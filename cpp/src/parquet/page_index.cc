@@ -0,0 +1,306 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/result.h"
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// Row ranges
+
+RowRanges IntersectRowRanges(const RowRanges& left, const RowRanges& right) {
+  RowRanges out;
+  size_t i = 0, j = 0;
+  while (i < left.size() && j < right.size()) {
+    const int64_t left_end = left[i].offset + left[i].length;
+    const int64_t right_end = right[j].offset + right[j].length;
+    const int64_t start = std::max(left[i].offset, right[j].offset);
+    const int64_t end = std::min(left_end, right_end);
+    if (start < end) {
+      out.push_back({start, end - start});
+    }
+    if (left_end < right_end) {
+      ++i;
+    } else {
+      ++j;
+    }
+  }
+  return out;
+}
+
+std::vector<int> SelectPages(const std::vector<PageLocation>& page_locations,
+                             int64_t num_rows, const RowRanges& ranges) {
+  std::vector<int> pages;
+  size_t range = 0;
+  for (size_t page = 0; page < page_locations.size() && range < ranges.size();
+       ++page) {
+    const int64_t page_start = page_locations[page].first_row_index;
+    const int64_t page_end = page + 1 < page_locations.size()
+                                 ? page_locations[page + 1].first_row_index
+                                 : num_rows;
+    // Skip ranges which end before this page
+    while (range < ranges.size() &&
+           ranges[range].offset + ranges[range].length <= page_start) {
+      ++range;
+    }
+    if (range < ranges.size() && ranges[range].offset < page_end) {
+      pages.push_back(static_cast<int>(page));
+    }
+  }
+  return pages;
+}
+
+// ----------------------------------------------------------------------
+// Reading
+
+namespace {
+
+class OffsetIndexImpl : public OffsetIndex {
+ public:
+  explicit OffsetIndexImpl(const format::OffsetIndex& offset_index) {
+    page_locations_.reserve(offset_index.page_locations.size());
+    for (const auto& location : offset_index.page_locations) {
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+class ColumnIndexImpl : public ColumnIndex {
+ public:
+  explicit ColumnIndexImpl(format::ColumnIndex column_index)
+      : column_index_(std::move(column_index)) {
+    const size_t num_pages = column_index_.null_pages.size();
+    if (column_index_.min_values.size() != num_pages ||
+        column_index_.max_values.size() != num_pages ||
+        (column_index_.__isset.null_counts &&
+         column_index_.null_counts.size() != num_pages)) {
+      throw ParquetException("Invalid column index: page count mismatch");
+    }
+  }
+
+  const std::vector<bool>& null_pages() const override {
+    return column_index_.null_pages;
+  }
+
+  const std::vector<std::string>& encoded_min_values() const override {
+    return column_index_.min_values;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const override {
+    return column_index_.max_values;
+  }
+
+  BoundaryOrder::type boundary_order() const override {
+    // Unknown values from corrupt or newer files are treated as unordered
+    switch (internal::LoadEnumRaw(&column_index_.boundary_order)) {
+      case format::BoundaryOrder::ASCENDING:
+        return BoundaryOrder::ASCENDING;
+      case format::BoundaryOrder::DESCENDING:
+        return BoundaryOrder::DESCENDING;
+      default:
+        return BoundaryOrder::UNORDERED;
+    }
+  }
+
+  bool has_null_counts() const override { return column_index_.__isset.null_counts; }
+
+  const std::vector<int64_t>& null_counts() const override {
+    return column_index_.null_counts;
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+};
+
+}  // namespace
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+  return std::unique_ptr<OffsetIndex>(new OffsetIndexImpl(offset_index));
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+  return std::unique_ptr<ColumnIndex>(new ColumnIndexImpl(std::move(column_index)));
+}
+
+// ----------------------------------------------------------------------
+// Writing
+
+namespace {
+
+class ColumnIndexBuilderImpl : public ColumnIndexBuilder {
+ public:
+  explicit ColumnIndexBuilderImpl(const ColumnDescriptor* descr)
+      // Min and max are meaningless without a known sort order
+      : valid_(descr->sort_order() != SortOrder::UNKNOWN), has_null_counts_(true) {}
+
+  void AddPage(const EncodedStatistics& stats, int64_t num_values) override {
+    if (!valid_) return;
+
+    const bool null_page = stats.has_null_count && stats.null_count == num_values;
+    if (!null_page && !(stats.has_min && stats.has_max)) {
+      valid_ = false;
+      return;
+    }
+    column_index_.null_pages.push_back(null_page);
+    column_index_.min_values.push_back(null_page ? "" : stats.min());
+    column_index_.max_values.push_back(null_page ? "" : stats.max());
+    column_index_.null_counts.push_back(stats.null_count);
+    has_null_counts_ &= stats.has_null_count;
+  }
+
+  int64_t WriteTo(ArrowOutputStream* sink) const override {
+    if (!valid_ || column_index_.null_pages.empty()) return 0;
+
+    format::ColumnIndex column_index = column_index_;
+    column_index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+    if (has_null_counts_) {
+      column_index.__isset.null_counts = true;
+    } else {
+      column_index.null_counts.clear();
+    }
+    ThriftSerializer serializer;
+    return serializer.Serialize(&column_index, sink);
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+  bool valid_;
+  bool has_null_counts_;
+};
+
+class OffsetIndexBuilderImpl : public OffsetIndexBuilder {
+ public:
+  void AddPage(int64_t offset, int32_t compressed_page_size,
+               int64_t first_row_index) override {
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    location.__set_first_row_index(first_row_index);
+    offset_index_.page_locations.push_back(std::move(location));
+  }
+
+  void Finish(int64_t final_position) override {
+    for (auto& location : offset_index_.page_locations) {
+      location.__set_offset(location.offset + final_position);
+    }
+  }
+
+  int64_t WriteTo(ArrowOutputStream* sink) const override {
+    ThriftSerializer serializer;
+    return serializer.Serialize(&offset_index_, sink);
+  }
+
+ private:
+  format::OffsetIndex offset_index_;
+};
+
+class PageIndexBuilderImpl : public PageIndexBuilder {
+ public:
+  explicit PageIndexBuilderImpl(const SchemaDescriptor* schema) : schema_(schema) {}
+
+  void AppendRowGroup() override {
+    const int num_columns = schema_->num_columns();
+    column_index_builders_.emplace_back(num_columns);
+    offset_index_builders_.emplace_back(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      const ColumnDescriptor* descr = schema_->Column(i);
+      if (descr->max_repetition_level() > 0) continue;
+      column_index_builders_.back()[i] = ColumnIndexBuilder::Make(descr);
+      offset_index_builders_.back()[i] = OffsetIndexBuilder::Make();
+    }
+  }
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(int i) override {
+    DCHECK(!column_index_builders_.empty());
+    return column_index_builders_.back()[i].get();
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int i) override {
+    DCHECK(!offset_index_builders_.empty());
+    return offset_index_builders_.back()[i].get();
+  }
+
+  void WriteTo(ArrowOutputStream* sink, PageIndexLocation* location) const override {
+    location->column_index_locations = WriteIndexes(sink, column_index_builders_);
+    location->offset_index_locations = WriteIndexes(sink, offset_index_builders_);
+  }
+
+ private:
+  template <typename Builder>
+  static std::vector<std::vector<IndexLocation>> WriteIndexes(
+      ArrowOutputStream* sink,
+      const std::vector<std::vector<std::unique_ptr<Builder>>>& builders) {
+    std::vector<std::vector<IndexLocation>> locations(builders.size());
+    for (size_t row_group = 0; row_group < builders.size(); ++row_group) {
+      locations[row_group].resize(builders[row_group].size(), IndexLocation{0, 0});
+      for (size_t column = 0; column < builders[row_group].size(); ++column) {
+        const auto& builder = builders[row_group][column];
+        if (builder == nullptr) continue;
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+        const int64_t length = builder->WriteTo(sink);
+        locations[row_group][column] = {offset, static_cast<int32_t>(length)};
+      }
+    }
+    return locations;
+  }
+
+  const SchemaDescriptor* schema_;
+  std::vector<std::vector<std::unique_ptr<ColumnIndexBuilder>>> column_index_builders_;
+  std::vector<std::vector<std::unique_ptr<OffsetIndexBuilder>>> offset_index_builders_;
+};
+
+}  // namespace
+
+std::unique_ptr<ColumnIndexBuilder> ColumnIndexBuilder::Make(
+    const ColumnDescriptor* descr) {
+  return std::unique_ptr<ColumnIndexBuilder>(new ColumnIndexBuilderImpl(descr));
+}
+
+std::unique_ptr<OffsetIndexBuilder> OffsetIndexBuilder::Make() {
+  return std::unique_ptr<OffsetIndexBuilder>(new OffsetIndexBuilderImpl());
+}
+
+std::unique_ptr<PageIndexBuilder> PageIndexBuilder::Make(const SchemaDescriptor* schema) {
+  return std::unique_ptr<PageIndexBuilder>(new PageIndexBuilderImpl(schema));
+}
+
+}  // namespace parquet
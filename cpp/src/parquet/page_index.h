@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Page indexes (ColumnIndex and OffsetIndex) as described in the Parquet
+// format's PageIndex.md.  They are stored between the last row group and the
+// footer, and allow readers to skip individual data pages of a column chunk.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class EncodedStatistics;
+class SchemaDescriptor;
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief Location of a data page in the file
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief Location of a serialized ColumnIndex or OffsetIndex in the file
+struct PARQUET_EXPORT IndexLocation {
+  int64_t offset;
+  int32_t length;
+};
+
+/// \brief A contiguous range of rows within a row group
+struct PARQUET_EXPORT RowRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \brief Sorted, non-overlapping and non-adjacent ranges of rows
+using RowRanges = std::vector<RowRange>;
+
+/// \brief Return the rows present in both `left` and `right`
+PARQUET_EXPORT
+RowRanges IntersectRowRanges(const RowRanges& left, const RowRanges& right);
+
+/// \brief Return the ordinals of the pages containing at least one row of `ranges`
+///
+/// `page_locations` must be ordered by first_row_index, as in an OffsetIndex.
+PARQUET_EXPORT
+std::vector<int> SelectPages(const std::vector<PageLocation>& page_locations,
+                             int64_t num_rows, const RowRanges& ranges);
+
+/// \brief The byte locations of each data page of a column chunk
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  virtual ~OffsetIndex() = default;
+
+  /// \brief Deserialize an OffsetIndex read from the file
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  /// \brief The data pages of the column chunk, in file order
+  virtual const std::vector<PageLocation>& page_locations() const = 0;
+};
+
+/// \brief The min/max statistics of each data page of a column chunk
+///
+/// Min and max values are PLAIN encoded, like those of EncodedStatistics, and
+/// empty for pages which only contain nulls.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  virtual ~ColumnIndex() = default;
+
+  /// \brief Deserialize a ColumnIndex read from the file
+  static std::unique_ptr<ColumnIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  /// \brief Whether each page only contains null values
+  virtual const std::vector<bool>& null_pages() const = 0;
+
+  virtual const std::vector<std::string>& encoded_min_values() const = 0;
+
+  virtual const std::vector<std::string>& encoded_max_values() const = 0;
+
+  /// \brief Whether min values (and max values) are sorted across pages
+  virtual BoundaryOrder::type boundary_order() const = 0;
+
+  virtual bool has_null_counts() const = 0;
+
+  virtual const std::vector<int64_t>& null_counts() const = 0;
+};
+
+/// \brief Accumulate the ColumnIndex of a column chunk as its pages are written
+class PARQUET_EXPORT ColumnIndexBuilder {
+ public:
+  virtual ~ColumnIndexBuilder() = default;
+
+  static std::unique_ptr<ColumnIndexBuilder> Make(const ColumnDescriptor* descr);
+
+  /// \brief Add the statistics of the next data page
+  ///
+  /// If a page with non-null values has no min or max, the column chunk gets
+  /// no ColumnIndex at all.
+  virtual void AddPage(const EncodedStatistics& stats, int64_t num_values) = 0;
+
+  /// \brief Serialize the index, returning the number of bytes written or 0 if
+  /// the column chunk has no valid index
+  virtual int64_t WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Accumulate the OffsetIndex of a column chunk as its pages are written
+class PARQUET_EXPORT OffsetIndexBuilder {
+ public:
+  virtual ~OffsetIndexBuilder() = default;
+
+  static std::unique_ptr<OffsetIndexBuilder> Make();
+
+  /// \brief Add the location of the next data page
+  virtual void AddPage(int64_t offset, int32_t compressed_page_size,
+                       int64_t first_row_index) = 0;
+
+  /// \brief Shift the recorded offsets of pages which were buffered in memory
+  /// before being written to the file at `final_position`
+  virtual void Finish(int64_t final_position) = 0;
+
+  /// \brief Serialize the index, returning the number of bytes written
+  virtual int64_t WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Locations of the serialized page indexes of a file, indexed by row
+/// group then by column.  A length of 0 means the index was not written.
+struct PARQUET_EXPORT PageIndexLocation {
+  std::vector<std::vector<IndexLocation>> column_index_locations;
+  std::vector<std::vector<IndexLocation>> offset_index_locations;
+};
+
+/// \brief Collect the page indexes of all column chunks of a file while it is
+/// being written, then write them out before the footer
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  virtual ~PageIndexBuilder() = default;
+
+  static std::unique_ptr<PageIndexBuilder> Make(const SchemaDescriptor* schema);
+
+  /// \brief Start collecting the indexes of a new row group
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief The builders of column i of the current row group
+  ///
+  /// Return null for repeated columns, whose pages may start in the middle of
+  /// a row and therefore cannot be located by row index.
+  virtual ColumnIndexBuilder* GetColumnIndexBuilder(int i) = 0;
+  virtual OffsetIndexBuilder* GetOffsetIndexBuilder(int i) = 0;
+
+  /// \brief Write all column indexes, then all offset indexes
+  virtual void WriteTo(ArrowOutputStream* sink, PageIndexLocation* location) const = 0;
+};
+
+}  // namespace parquet
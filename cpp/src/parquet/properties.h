@@ -109,6 +109,11 @@ static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
+// Size Bloom filters from the distinct values of each column chunk
+static constexpr int64_t DEFAULT_BLOOM_FILTER_NDV = 0;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
@@ -125,7 +130,10 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP),
+        bloom_filter_ndv_(DEFAULT_BLOOM_FILTER_NDV) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -147,6 +155,14 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_fpp(double fpp) { bloom_filter_fpp_ = fpp; }
+
+  void set_bloom_filter_ndv(int64_t ndv) { bloom_filter_ndv_ = ndv; }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -159,6 +175,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
+  int64_t bloom_filter_ndv() const { return bloom_filter_ndv_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -166,6 +188,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  double bloom_filter_fpp_;
+  int64_t bloom_filter_ndv_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -180,7 +205,8 @@ class PARQUET_EXPORT WriterProperties {
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_1_0),
           data_page_version_(ParquetDataPageVersion::V1),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -363,6 +389,20 @@ class PARQUET_EXPORT WriterProperties {
       return this->compression_level(path->ToDotString(), compression_level);
     }
 
+    /// Write a ColumnIndex and an OffsetIndex for each column chunk, letting
+    /// readers skip the data pages whose statistics exclude a filter.
+    ///
+    /// Page indexes are not written for repeated columns nor for encrypted files.
+    Builder* enable_write_page_index() {
+      page_index_enabled_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      page_index_enabled_ = false;
+      return this;
+    }
+
     Builder* encryption(
         std::shared_ptr<FileEncryptionProperties> file_encryption_properties) {
       file_encryption_properties_ = std::move(file_encryption_properties);
@@ -397,6 +437,51 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// \brief Write a Bloom filter for the column described by path.
+    ///
+    /// Each column chunk then carries a split block Bloom filter of its
+    /// distinct non-null values, so that membership queries yield false
+    /// positives with probability about fpp.  Readers can use it to skip row
+    /// groups for equality predicates.  Bloom filters are not written for
+    /// encrypted columns.
+    ///
+    /// If ndv is 0, the hashes of the distinct values of a chunk are kept
+    /// while it is written, 8 bytes each, and the filter is sized from their
+    /// number when the chunk is closed.  Otherwise a filter of
+    /// BlockSplitBloomFilter::OptimalNumOfBits(ndv, fpp) / 8 bytes is
+    /// allocated up front for each chunk, and the false positive rate exceeds
+    /// fpp if a chunk holds more than ndv distinct values.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP,
+                                 int64_t ndv = DEFAULT_BLOOM_FILTER_NDV) {
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException(
+            "Bloom filter false positive probability must be in (0, 1)");
+      }
+      if (ndv < 0) {
+        throw ParquetException("Bloom filter number of distinct values must be >= 0");
+      }
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_fpp_[path] = fpp;
+      bloom_filter_ndv_[path] = ndv;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP,
+                                 int64_t ndv = DEFAULT_BLOOM_FILTER_NDV) {
+      return this->enable_bloom_filter(path->ToDotString(), fpp, ndv);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -415,11 +500,18 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_fpp_)
+        get(item.first).set_bloom_filter_fpp(item.second);
+      for (const auto& item : bloom_filter_ndv_)
+        get(item.first).set_bloom_filter_ndv(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
           pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_));
+          default_column_properties_, column_properties, data_page_version_,
+          page_index_enabled_));
     }
 
    private:
@@ -431,6 +523,7 @@ class PARQUET_EXPORT WriterProperties {
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
+    bool page_index_enabled_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -441,6 +534,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, double> bloom_filter_fpp_;
+    std::unordered_map<std::string, int64_t> bloom_filter_ndv_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -461,6 +557,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool write_page_index() const { return page_index_enabled_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -508,6 +606,18 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
+  int64_t bloom_filter_ndv(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_ndv();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -529,7 +639,7 @@ class PARQUET_EXPORT WriterProperties {
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
-      ParquetDataPageVersion data_page_version)
+      ParquetDataPageVersion data_page_version, bool page_index_enabled)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
@@ -538,6 +648,7 @@ class PARQUET_EXPORT WriterProperties {
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        page_index_enabled_(page_index_enabled),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -550,6 +661,7 @@ class PARQUET_EXPORT WriterProperties {
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool page_index_enabled_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 